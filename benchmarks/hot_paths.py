@@ -0,0 +1,258 @@
+'''
+    Microbenchmarks of the binding hot paths across payload sizes.
+
+    Runs on any OpenGL 3.3 driver including llvmpipe, or without a driver on the null backend
+    to measure the overhead of moderngl alone. The results are written as JSON
+    and compared between commits, for example:
+
+        python benchmarks/hot_paths.py --backend null --json base.json
+        python benchmarks/hot_paths.py --backend null --json head.json --compare base.json --tolerance 0.1
+'''
+
+import argparse
+import json
+import math
+import os
+import platform
+import statistics
+import subprocess
+import sys
+import time
+
+import moderngl
+
+VERTEX_SHADER = '''
+    #version 330
+    in vec2 in_vert;
+    %s
+    void main() {
+        gl_Position = vec4(in_vert%s, 0.0, 1.0);
+    }
+'''
+
+FRAGMENT_SHADER = '''
+    #version 330
+    out vec4 f_color;
+    void main() {
+        f_color = vec4(1.0);
+    }
+'''
+
+
+def uniform_shader(count):
+    '''
+        A vertex shader using ``count`` float uniforms.
+    '''
+
+    declarations = '\n'.join('uniform float u%d;' % i for i in range(count))
+    usage = ''.join(' + u%d' % i for i in range(count))
+    return VERTEX_SHADER % (declarations, usage)
+
+
+def buffer_write(ctx, size):
+    buffer = ctx.buffer(reserve=size)
+    data = b'\x00' * size
+
+    def run():
+        buffer.write(data)
+
+    return run, size, buffer.release
+
+
+def vertex_array_render(ctx, vertices):
+    prog = ctx.program(vertex_shader=VERTEX_SHADER % ('', ''), fragment_shader=FRAGMENT_SHADER)
+    vbo = ctx.buffer(reserve=vertices * 8)
+    vao = ctx.simple_vertex_array(prog, vbo, 'in_vert')
+    fbo = ctx.simple_framebuffer((64, 64))
+    fbo.use()
+
+    def run():
+        vao.render(moderngl.POINTS)
+
+    def release():
+        for obj in (vao, vbo, prog, fbo):
+            obj.release()
+
+    return run, 0, release
+
+
+def uniform_value(ctx, kind):
+    declaration, usage, value = {
+        'float': ('uniform float value;', ' * value', 1.0),
+        'vec4': ('uniform vec4 value;', ' * value.x', (1.0, 2.0, 3.0, 4.0)),
+        'mat4': ('uniform mat4 value;', ' * value[0].x', tuple(float(i) for i in range(16))),
+        'float[64]': ('uniform float value[64];', ' * value[gl_VertexID % 64]', [float(i) for i in range(64)]),
+    }[kind]
+
+    prog = ctx.program(vertex_shader=VERTEX_SHADER % (declaration, usage), fragment_shader=FRAGMENT_SHADER)
+    uniform = prog['value']
+
+    def run():
+        uniform.value = value
+
+    return run, 0, prog.release
+
+
+def framebuffer_read(ctx, size):
+    fbo = ctx.simple_framebuffer((size, size))
+
+    def run():
+        fbo.read(components=4)
+
+    return run, size * size * 4, fbo.release
+
+
+def context_program(ctx, uniforms):
+    vertex_shader = uniform_shader(uniforms)
+
+    def run():
+        ctx.program(vertex_shader=vertex_shader, fragment_shader=FRAGMENT_SHADER).release()
+
+    return run, 0, None
+
+
+WORKLOADS = [
+    ('buffer.write', buffer_write, [64, 4096, 262144, 4194304]),
+    ('vertex_array.render', vertex_array_render, [3, 3000, 300000]),
+    ('uniform.value', uniform_value, ['float', 'vec4', 'mat4', 'float[64]']),
+    ('framebuffer.read', framebuffer_read, [16, 256, 1024]),
+    ('context.program', context_program, [1, 16, 64]),
+]
+
+
+def measure(ctx, run, repeat, min_time):
+    '''
+        The time of a single call in nanoseconds for every repeat.
+        The calls are batched until a batch takes ``min_time`` seconds, like ``timeit``.
+    '''
+
+    run()
+    ctx.finish()
+
+    number = 1
+    while True:
+        start = time.perf_counter_ns()
+        for _ in range(number):
+            run()
+        ctx.finish()
+        elapsed = time.perf_counter_ns() - start
+        if elapsed >= min_time * 1e9 or number >= 1 << 20:
+            break
+        number *= 2 if elapsed == 0 else max(2, min(10, math.ceil(min_time * 1e9 / elapsed)))
+
+    times = [elapsed / number]
+    for _ in range(repeat - 1):
+        start = time.perf_counter_ns()
+        for _ in range(number):
+            run()
+        ctx.finish()
+        times.append((time.perf_counter_ns() - start) / number)
+
+    return number, times
+
+
+def metadata(ctx, backend):
+    commit = None
+    try:
+        root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+        commit = subprocess.check_output(['git', 'rev-parse', 'HEAD'], cwd=root, stderr=subprocess.DEVNULL)
+        commit = commit.decode().strip()
+    except Exception:
+        pass
+
+    return {
+        'moderngl': moderngl.__version__,
+        'commit': commit,
+        'backend': backend,
+        'renderer': ctx.info['GL_RENDERER'],
+        'version': ctx.info['GL_VERSION'],
+        'python': sys.version.split()[0],
+        'platform': platform.platform(),
+    }
+
+
+def compare(results, path, tolerance):
+    '''
+        Print the ratio of the median times to a previous run.
+        Returns the number of workloads slower than the tolerance.
+    '''
+
+    with open(path) as f:
+        base = {(r['name'], r['param']): r for r in json.load(f)['results']}
+
+    regressions = 0
+    print()
+    print('%-22s %12s %14s %14s %8s' % ('compared to', 'param', 'base (ns)', 'head (ns)', 'ratio'))
+
+    for result in results:
+        old = base.get((result['name'], result['param']))
+        if old is None:
+            continue
+        ratio = result['median_ns'] / old['median_ns'] if old['median_ns'] else float('inf')
+        slower = ratio > 1.0 + tolerance
+        regressions += slower
+        print('%-22s %12s %14.0f %14.0f %7.2fx%s' % (
+            result['name'], result['param'], old['median_ns'], result['median_ns'], ratio, ' !' if slower else '',
+        ))
+
+    return regressions
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(prog='hot_paths')
+    parser.add_argument('--backend', choices=['default', 'null'], default='default')
+    parser.add_argument('--filter', nargs='+', default=None, help='run the workloads with these names only')
+    parser.add_argument('--repeat', type=int, default=5)
+    parser.add_argument('--min-time', type=float, default=0.05, help='the minimum time of a batch in seconds')
+    parser.add_argument('--json', default=None, help='write the results to a JSON file')
+    parser.add_argument('--compare', default=None, help='compare the median times to a previous JSON file')
+    parser.add_argument('--tolerance', type=float, default=0.1, help='the allowed slowdown when comparing')
+    args = parser.parse_args(argv)
+
+    settings = {'backend': 'null'} if args.backend == 'null' else {}
+    ctx = moderngl.create_standalone_context(**settings)
+
+    print('renderer:', ctx.info['GL_RENDERER'])
+    print('%-22s %12s %10s %14s %14s %12s' % ('workload', 'param', 'number', 'min (ns)', 'median (ns)', 'MB/s'))
+
+    results = []
+
+    for name, setup, params in WORKLOADS:
+        if args.filter and name not in args.filter:
+            continue
+
+        for param in params:
+            run, size, release = setup(ctx, param)
+            number, times = measure(ctx, run, args.repeat, args.min_time)
+
+            if release is not None:
+                release()
+
+            result = {
+                'name': name,
+                'param': str(param),
+                'number': number,
+                'repeat': args.repeat,
+                'bytes': size,
+                'min_ns': min(times),
+                'median_ns': statistics.median(times),
+                'mean_ns': statistics.mean(times),
+                'stdev_ns': statistics.stdev(times) if len(times) > 1 else 0.0,
+            }
+            results.append(result)
+
+            throughput = '%12.1f' % (size / result['median_ns'] * 1e3) if size else '%12s' % '-'
+            print('%-22s %12s %10d %14.0f %14.0f %s' % (
+                name, param, number, result['min_ns'], result['median_ns'], throughput,
+            ))
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({'meta': metadata(ctx, args.backend), 'results': results}, f, indent=4)
+
+    if args.compare and compare(results, args.compare, args.tolerance):
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,88 @@
+'''
+    Benchmark of the GPU parallel primitives.
+
+    Runs on any OpenGL 4.3 driver including llvmpipe, for example:
+
+        python benchmarks/parallel_primitives.py --sizes 65536 1048576 --repeat 5
+'''
+
+import argparse
+import random
+import struct
+import time
+
+import moderngl
+
+
+def measure(ctx, repeat, func):
+    func()
+    ctx.finish()
+
+    best = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        func()
+        ctx.finish()
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+
+    return best
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(prog='parallel_primitives')
+    parser.add_argument('--sizes', type=int, nargs='+', default=[1 << 16, 1 << 20])
+    parser.add_argument('--repeat', type=int, default=3)
+    parser.add_argument('--group-size', type=int, default=None)
+    parser.add_argument('--check', action='store_true', default=False)
+    args = parser.parse_args(argv)
+
+    ctx = moderngl.create_standalone_context(require=430)
+    prims = ctx.parallel_primitives(group_size=args.group_size)
+
+    print('renderer:', ctx.info['GL_RENDERER'])
+    print('group size:', prims.group_size)
+    print('%-10s %12s %12s %14s' % ('primitive', 'elements', 'time (ms)', 'Melements/s'))
+
+    rng = random.Random(0)
+
+    for size in args.sizes:
+        keys = [rng.randrange(0, 1 << 32) for _ in range(size)]
+        flags = [rng.randrange(0, 2) for _ in range(size)]
+
+        src = ctx.buffer(struct.pack('%dI' % size, *keys))
+        dst = ctx.buffer(reserve=size * 4)
+        flag_buffer = ctx.buffer(struct.pack('%dI' % size, *flags))
+        counter = ctx.buffer(reserve=4)
+        sort_keys = ctx.buffer(reserve=size * 4)
+        sort_values = ctx.buffer(reserve=size * 4)
+
+        def sort():
+            ctx.copy_buffer(sort_keys, src)
+            ctx.copy_buffer(sort_values, src)
+            prims.sort(sort_keys, sort_values)
+
+        cases = [
+            ('reduce', lambda: prims.reduce(src, 'max', dtype='u4', dst=counter)),
+            ('scan', lambda: prims.scan(dst, src, dtype='u4')),
+            ('compact', lambda: prims.compact(dst, src, flag_buffer, dtype='u4', counter=counter)),
+            ('sort', sort),
+        ]
+
+        for name, func in cases:
+            elapsed = measure(ctx, args.repeat, func)
+            print('%-10s %12d %12.3f %14.2f' % (name, size, elapsed * 1e3, size / elapsed / 1e6))
+
+        if args.check:
+            sort()
+            assert list(struct.unpack('%dI' % size, sort_keys.read())) == sorted(keys)
+            assert prims.compact(dst, src, flag_buffer, dtype='u4') == sum(flags)
+
+        for buffer in (src, dst, flag_buffer, counter, sort_keys, sort_values):
+            buffer.release()
+
+    prims.release()
+
+
+if __name__ == '__main__':
+    main()
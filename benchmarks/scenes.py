@@ -0,0 +1,335 @@
+'''
+    End-to-end benchmark of the examples rendered headless.
+
+    Every scene is an example of the examples directory. Its render loop runs for a fixed
+    number of frames against a standalone context in a separate process. The frame times
+    are measured without instrumentation, the OpenGL calls and bytes are counted by
+    :py:meth:`Context.gl_stats` in a second pass of the same frames. These and the peak resident
+    memory are reported and compared to a stored baseline, for example:
+
+        python benchmarks/scenes.py --backend null --frames 300 --json base.json
+        python benchmarks/scenes.py --backend null --frames 300 --compare base.json --tolerance 0.1
+
+    The examples are written for a window, ``example_window`` is replaced by a stub that
+    renders into a framebuffer of the window size with a time of ``frame / fps``.
+    Scenes depending on missing modules are skipped.
+'''
+
+import argparse
+import json
+import math
+import os
+import platform
+import random
+import runpy
+import statistics
+import subprocess
+import sys
+import time
+import types
+
+import moderngl
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+EXAMPLES = os.path.join(ROOT, 'examples')
+
+SCENES = [
+    '07_multiple_instance_rendering',
+    'conways_game_of_life',
+    'conways_game_of_life_labyrinth',
+    'instanced_rendering',
+    'instanced_rendering_crates',
+    'julia_fractal',
+    'mandelbrot_set',
+    'multi_texture_terrain',
+    'particle_system',
+    'wireframe_terrain',
+]
+
+
+class WindowInfo:
+    '''
+        The window of ``example_window`` without a window.
+    '''
+
+    def __init__(self, size):
+        self.size = size
+        self.mouse = (0, 0)
+        self.wheel = 0
+        self.time = 0.0
+        self.ratio = size[0] / size[1]
+        self.viewport = (0, 0) + tuple(size)
+        self.keys = [False] * 256
+        self.old_keys = list(self.keys)
+
+    def key_down(self, key):
+        return self.keys[key]
+
+    def key_pressed(self, key):
+        return self.keys[key] and not self.old_keys[key]
+
+    def key_released(self, key):
+        return not self.keys[key] and self.old_keys[key]
+
+
+class Example:
+    WINDOW_SIZE = (1280, 720)
+    wnd = None
+
+    def render(self):
+        pass
+
+
+def load_scene(name):
+    '''
+        Run the example module with the ``example_window`` stub and return its example class.
+    '''
+
+    examples = []
+
+    stub = types.ModuleType('example_window')
+    stub.WindowInfo = WindowInfo
+    stub.Example = Example
+    stub.run_example = examples.append
+
+    sys.modules['example_window'] = stub
+    sys.path.insert(0, EXAMPLES)
+    runpy.run_path(os.path.join(EXAMPLES, name + '.py'), run_name='__scene__')
+
+    if not examples:
+        raise RuntimeError('%s does not call run_example' % name)
+
+    return examples[-1]
+
+
+def percentile(values, percent):
+    ordered = sorted(values)
+    return ordered[max(math.ceil(len(ordered) * percent / 100.0) - 1, 0)]
+
+
+def peak_rss():
+    '''
+        The peak resident memory of the process in kilobytes.
+    '''
+
+    try:
+        import resource
+    except ImportError:
+        return None
+
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    return peak // 1024 if sys.platform == 'darwin' else peak
+
+
+def run_scene(name, settings, frames, warmup, fps):
+    '''
+        Render a scene in the current process.
+    '''
+
+    random.seed(0)
+
+    try:
+        import numpy as np
+        np.random.seed(0)
+    except ImportError:
+        pass
+
+    example = load_scene(name)
+
+    ctx = moderngl.create_standalone_context(**settings)
+    size = example.WINDOW_SIZE
+    example.wnd = WindowInfo(size)
+
+    fbo = ctx.simple_framebuffer(size)
+    fbo.use()
+
+    ctx.gl_instrumentation = True
+
+    create_context = moderngl.create_context
+    moderngl.create_context = lambda *args, **kwargs: ctx
+
+    try:
+        scene = example()
+    finally:
+        moderngl.create_context = create_context
+
+    ctx.finish()
+    setup = ctx.gl_stats(reset=True)
+    ctx.gl_instrumentation = False
+
+    # The frames are timed without the instrumentation, its wrappers would add to every call.
+
+    times = []
+    for frame in range(warmup + frames):
+        example.wnd.time = frame / fps
+        start = time.perf_counter_ns()
+        scene.render()
+        ctx.finish()
+        elapsed = time.perf_counter_ns() - start
+
+        if frame >= warmup:
+            times.append(elapsed / 1e6)
+
+    # The calls and bytes are counted in a second pass over the same frame times.
+
+    ctx.gl_instrumentation = True
+
+    for frame in range(warmup, warmup + frames):
+        example.wnd.time = frame / fps
+        scene.render()
+        ctx.finish()
+        ctx.mark_frame()
+
+    stats = ctx.gl_stats(reset=True)
+    ctx.gl_instrumentation = False
+
+    return {
+        'name': name,
+        'frames': frames,
+        'size': list(size),
+        'frame_ms': {
+            'min': min(times),
+            'median': statistics.median(times),
+            'mean': statistics.mean(times),
+            'p90': percentile(times, 90),
+            'p99': percentile(times, 99),
+            'max': max(times),
+        },
+        'calls_per_frame': stats['calls'] / frames,
+        'upload_bytes_per_frame': stats['upload_bytes'] / frames,
+        'readback_bytes_per_frame': stats['readback_bytes'] / frames,
+        'setup': {
+            'calls': setup['calls'],
+            'upload_bytes': setup['upload_bytes'],
+            'readback_bytes': setup['readback_bytes'],
+        },
+        'functions': {function: values['calls'] for function, values in stats['functions'].items()},
+        'histogram': stats['histogram'],
+        'peak_rss_kb': peak_rss(),
+    }
+
+
+def spawn_scene(name, args):
+    '''
+        Render a scene in a separate process for its own peak memory.
+        Returns the result or the reason for skipping the scene.
+    '''
+
+    command = [
+        sys.executable, os.path.abspath(__file__), '--run', name, '--backend', args.backend,
+        '--frames', str(args.frames), '--warmup', str(args.warmup), '--fps', str(args.fps),
+    ]
+
+    process = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
+
+    if process.returncode:
+        lines = process.stderr.strip().splitlines()
+        return None, lines[-1] if lines else 'exit code %d' % process.returncode
+
+    return json.loads(process.stdout.strip().splitlines()[-1]), None
+
+
+def metadata(backend):
+    commit = None
+    try:
+        commit = subprocess.check_output(['git', 'rev-parse', 'HEAD'], cwd=ROOT, stderr=subprocess.DEVNULL)
+        commit = commit.decode().strip()
+    except Exception:
+        pass
+
+    return {
+        'moderngl': moderngl.__version__,
+        'commit': commit,
+        'backend': backend,
+        'python': sys.version.split()[0],
+        'platform': platform.platform(),
+    }
+
+
+def compare(results, path, tolerance):
+    '''
+        Print the ratios of the median frame time, the calls and bytes per frame and the peak memory
+        to a previous run. Returns the number of scenes with a ratio above the tolerance.
+    '''
+
+    with open(path) as f:
+        base = {r['name']: r for r in json.load(f)['results']}
+
+    def ratio(new, old):
+        if not old:
+            return 1.0 if not new else float('inf')
+        return new / old
+
+    regressions = 0
+    print()
+    print('%-32s %10s %10s %10s %10s' % ('compared to', 'frame', 'calls', 'upload', 'rss'))
+
+    for result in results:
+        old = base.get(result['name'])
+        if old is None:
+            continue
+
+        ratios = [
+            ratio(result['frame_ms']['median'], old['frame_ms']['median']),
+            ratio(result['calls_per_frame'], old['calls_per_frame']),
+            ratio(result['upload_bytes_per_frame'], old['upload_bytes_per_frame']),
+            ratio(result['peak_rss_kb'] or 0, old['peak_rss_kb'] or 0),
+        ]
+
+        slower = any(value > 1.0 + tolerance for value in ratios)
+        regressions += slower
+        print('%-32s %9.2fx %9.2fx %9.2fx %9.2fx%s' % ((result['name'],) + tuple(ratios) + (' !' if slower else '',)))
+
+    return regressions
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(prog='scenes')
+    parser.add_argument('--backend', choices=['default', 'null'], default='default')
+    parser.add_argument('--scenes', nargs='+', default=SCENES, help='the names of the examples to render')
+    parser.add_argument('--frames', type=int, default=300)
+    parser.add_argument('--warmup', type=int, default=10, help='the frames rendered before measuring')
+    parser.add_argument('--fps', type=float, default=60.0, help='the frame rate of the example time')
+    parser.add_argument('--json', default=None, help='write the results to a JSON file')
+    parser.add_argument('--compare', default=None, help='compare the results to a previous JSON file')
+    parser.add_argument('--tolerance', type=float, default=0.1, help='the allowed increase when comparing')
+    parser.add_argument('--run', default=None, help=argparse.SUPPRESS)
+    args = parser.parse_args(argv)
+
+    settings = {'backend': 'null'} if args.backend == 'null' else {}
+
+    if args.run:
+        print(json.dumps(run_scene(args.run, settings, args.frames, args.warmup, args.fps)))
+        return
+
+    print('%-32s %10s %10s %10s %12s %12s %10s' % (
+        'scene', 'median ms', 'p99 ms', 'calls', 'upload B', 'readback B', 'rss KB',
+    ))
+
+    results = []
+    skipped = {}
+
+    for name in args.scenes:
+        result, reason = spawn_scene(name, args)
+
+        if result is None:
+            skipped[name] = reason
+            print('%-32s skipped: %s' % (name, reason))
+            continue
+
+        results.append(result)
+        print('%-32s %10.3f %10.3f %10.1f %12.0f %12.0f %10s' % (
+            name, result['frame_ms']['median'], result['frame_ms']['p99'], result['calls_per_frame'],
+            result['upload_bytes_per_frame'], result['readback_bytes_per_frame'], result['peak_rss_kb'],
+        ))
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({'meta': metadata(args.backend), 'results': results, 'skipped': skipped}, f, indent=4)
+
+    if args.compare and compare(results, args.compare, args.tolerance):
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
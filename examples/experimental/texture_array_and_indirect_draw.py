@@ -55,9 +55,9 @@ shapes = [
 
 vbo = ctx.buffer(b''.join(shape.tobytes() for shape in shapes))
 dbo = ctx.buffer(np.array([
-    3, 1, 0, 0, 0,
-    4, 1, 3, 0, 0,
-    5, 1, 7, 0, 0,
+    3, 1, 0, 0,
+    4, 1, 3, 0,
+    5, 1, 7, 0,
 ], dtype='i4'))
 
 images = [
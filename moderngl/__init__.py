@@ -9,21 +9,31 @@ if os.environ.get('READTHEDOCS') == 'True':
     from .mock import mgl
     sys.modules['moderngl.mgl'] = mgl
 
+from .append_buffer import *
+from .block_compression import *
+from .block_writer import *
 from .buffer import *
 from .compute_shader import *
 from .conditional_render import *
 from .context import *
+from .culling import *
 from .framebuffer import *
+from .indirect_buffer import *
 from .mock import *
+from .parallel import *
+from .profiler import *
 from .program import *
 from .program_members import *
+from .program_pipeline import *
 from .query import *
+from .query_pool import *
 from .renderbuffer import *
 from .scope import *
 from .texture import *
 from .texture_3d import *
 from .texture_array import *
 from .texture_cube import *
+from .uniform_ring import *
 from .vertex_array import *
 from .sampler import *
 
@@ -4,6 +4,7 @@
 
 import argparse
 import json
+import math
 import os
 import subprocess
 import sys
@@ -11,6 +12,50 @@ import sys
 import moderngl
 
 
+def percentile(values, q):
+    '''
+        The nearest rank percentile of sorted values.
+    '''
+
+    return values[max(math.ceil(q * len(values)) - 1, 0)]
+
+
+def replay(ctx, args):
+    '''
+        Replay a trace and print the statistics of its frames.
+    '''
+
+    frames, calls, skipped = [], 0, 0
+
+    for _ in range(args.repeat):
+        result = ctx.replay_trace(args.path, finish=not args.no_finish)
+        frames += result['frames']
+        calls += result['calls']
+        skipped += result['skipped']
+
+    times = sorted(frames) or [0]
+    stats = {
+        'frames': len(frames),
+        'calls': calls,
+        'skipped': skipped,
+        'mean': sum(times) / len(times),
+        'median': percentile(times, 0.5),
+        'p95': percentile(times, 0.95),
+        'min': times[0],
+        'max': times[-1],
+    }
+
+    if args.json:
+        print(json.dumps(stats, sort_keys=True, indent=4))
+        return
+
+    print('trace:', args.path)
+    print('renderer:', ctx.info['GL_RENDERER'])
+    print('frames: %d calls: %d skipped: %d' % (len(frames), calls, skipped))
+    for key in ('mean', 'median', 'p95', 'min', 'max'):
+        print('%s: %.3f ms' % (key, stats[key] / 1e6))
+
+
 def main(argv=None):
     '''
         main
@@ -28,11 +73,22 @@ def main(argv=None):
     parser = argparse.ArgumentParser(prog='moderngl')
     parser.add_argument('-v', '--version', action='version', version=version)
     parser.add_argument('--info', action='store_true', default=False)
+    parser.add_argument('command', nargs='?', choices=['replay'], help='replay a trace of Context.begin_trace')
+    parser.add_argument('path', nargs='?', help='the trace file')
+    parser.add_argument('--repeat', type=int, default=1, help='replay the trace multiple times')
+    parser.add_argument('--no-finish', action='store_true', default=False, help='do not wait for the GPU per frame')
+    parser.add_argument('--json', action='store_true', default=False, help='print the statistics as json')
     args = parser.parse_args(argv)
 
+    if args.command == 'replay' and not args.path:
+        parser.error('the replay command requires the path of a trace')
+
     ctx = moderngl.create_standalone_context()
 
-    if args.info:
+    if args.command == 'replay':
+        replay(ctx, args)
+
+    elif args.info:
         print(json.dumps(ctx.info, sort_keys=True, indent=4))
 
     else:
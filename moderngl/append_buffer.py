@@ -0,0 +1,173 @@
+import struct
+
+__all__ = ['AppendBuffer']
+
+
+ATOMIC_COUNTER_BARRIER_BIT = 0x1000
+BUFFER_UPDATE_BARRIER_BIT = 0x0200
+SHADER_STORAGE_BARRIER_BIT = 0x2000
+
+# Clamps the counter to the capacity without reading it back.
+CLAMP_COUNT = '''
+    #version 430
+
+    layout (local_size_x = 1) in;
+
+    layout (std430, binding = 0) readonly buffer Counter {
+        uint counter;
+    };
+
+    layout (std430, binding = 1) writeonly buffer Clamped {
+        uint clamped;
+    };
+
+    uniform uint capacity;
+
+    void main() {
+        clamped = min(counter, capacity);
+    }
+'''
+
+
+class AppendBuffer:
+    '''
+        An AppendBuffer is a storage buffer of fixed size items with an atomic counter
+        for variable length outputs of shaders.
+
+        Appending shaders reserve an item with ``atomicCounterIncrement`` and write it
+        if the returned index is below the capacity.
+        Consuming shaders take items with ``atomicCounterDecrement`` and read the returned index.
+        The counter never leaves the GPU unless :py:attr:`count` is read,
+        :py:meth:`copy_count` feeds it into an indirect draw or dispatch command.
+
+        Use :py:meth:`Context.append_buffer` to create one.
+    '''
+
+    __slots__ = ['_data', '_counter', '_capacity', '_item_size', '_clamp', '_clamped', 'ctx', 'extra']
+
+    def __init__(self):
+        self._data = None
+        self._counter = None
+        self._capacity = None
+        self._item_size = None
+        self._clamp = None
+        self._clamped = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<AppendBuffer: %d>' % self._data.glo
+
+    @property
+    def data(self) -> 'Buffer':
+        '''
+            Buffer: The storage buffer of the items.
+        '''
+
+        return self._data
+
+    @property
+    def counter(self) -> 'Buffer':
+        '''
+            Buffer: The buffer of the atomic counter, a single ``'u4'``.
+        '''
+
+        return self._counter
+
+    @property
+    def capacity(self) -> int:
+        '''
+            int: The maximum number of items.
+        '''
+
+        return self._capacity
+
+    @property
+    def item_size(self) -> int:
+        '''
+            int: The size of an item in bytes.
+        '''
+
+        return self._item_size
+
+    @property
+    def count(self) -> int:
+        '''
+            int: The number of items, at most the capacity.
+            Reading it waits for the shaders writing the counter.
+        '''
+
+        self.ctx.memory_barrier(BUFFER_UPDATE_BARRIER_BIT | ATOMIC_COUNTER_BARRIER_BIT)
+        return min(struct.unpack('I', self._counter.read())[0], self._capacity)
+
+    def bind(self, binding=0, counter_binding=0) -> None:
+        '''
+            Bind the items to a shader storage buffer and the counter to an atomic counter buffer.
+
+            Args:
+                binding (int): The shader storage binding.
+                counter_binding (int): The atomic counter buffer binding.
+        '''
+
+        self._data.bind_to_storage_buffer(binding)
+        self._counter.bind_to_atomic_counter(counter_binding)
+
+    def reset(self, count=0) -> None:
+        '''
+            Set the counter without waiting for the GPU.
+
+            Args:
+                count (int): The new value of the counter.
+                             Consuming shaders start from a counter set to the number of items.
+        '''
+
+        self._counter.write(struct.pack('I', count))
+
+    def copy_count(self, dst, offset=0) -> None:
+        '''
+            Copy the counter clamped to the capacity into another buffer on the GPU.
+
+            For example into the instance count of an indirect draw command at offset ``4``
+            or the work group count of an indirect dispatch command.
+            The clamping runs a single compute shader invocation that uses
+            the shader storage bindings ``0`` and ``1``.
+
+            Args:
+                dst (Buffer): The destination buffer.
+                offset (int): The byte offset in the destination buffer.
+        '''
+
+        if self._clamp is None:
+            self._clamp = self.ctx.compute_shader(CLAMP_COUNT)
+            self._clamp['capacity'].value = self._capacity
+            self._clamped = self.ctx.buffer(reserve=4)
+
+        self.ctx.memory_barrier(SHADER_STORAGE_BARRIER_BIT | ATOMIC_COUNTER_BARRIER_BIT)
+        self._counter.bind_to_storage_buffer(0)
+        self._clamped.bind_to_storage_buffer(1)
+        self._clamp.run()
+        self.ctx.memory_barrier(BUFFER_UPDATE_BARRIER_BIT)
+        self.ctx.copy_buffer(dst, self._clamped, 4, write_offset=offset)
+
+    def read(self) -> bytes:
+        '''
+            Read the items appended so far.
+
+            Returns:
+                bytes
+        '''
+
+        return self._data.read(self.count * self._item_size)
+
+    def release(self) -> None:
+        '''
+            Release the buffers.
+        '''
+
+        self._data.release()
+        self._counter.release()
+
+        if self._clamp is not None:
+            self._clamp.release()
+            self._clamped.release()
@@ -0,0 +1,35 @@
+from . import mgl
+from .buffer import Buffer
+
+__all__ = ['compress']
+
+
+def compress(data, size, format, quality=1, *, components=4, buffer=None, offset=0, threads=0) -> bytes:
+    '''
+        Encode pixels into a block compressed format on the CPU.
+
+        The blocks are encoded in parallel, the rows of blocks are split between the threads.
+        The result can be uploaded with :py:meth:`Texture.write_compressed`
+        or with the ``data`` of a texture created with the same ``compression``.
+
+        Args:
+            data (bytes): The pixels, one byte per component, without row padding.
+            size (tuple): The width and height of the image.
+            format (str): The compressed format ``'bc1'``, ``'bc3'``, ``'bc4'``, ``'bc5'`` or ``'bc7'``.
+            quality (int): ``0`` uses the bounding box of the blocks, ``1`` the principal axis,
+                           ``2`` and ``3`` also refine the endpoints with a least squares fit.
+
+        Keyword Args:
+            components (int): The number of components of the pixels.
+            buffer (Buffer): Encode the blocks straight into this buffer.
+            offset (int): The write offset in the buffer.
+            threads (int): The number of threads. Value 0 uses every available core.
+
+        Returns:
+            bytes: The compressed blocks or ``None`` when a buffer is given.
+    '''
+
+    if type(buffer) is Buffer:
+        buffer = buffer.mglo
+
+    return mgl.compress(data, tuple(size), format, quality, components, buffer, offset, threads)
@@ -0,0 +1,67 @@
+__all__ = ['BlockWriter']
+
+
+class BlockWriter:
+    '''
+        A BlockWriter packs values into the memory layout of a :py:class:`UniformBlock`
+        or a :py:class:`StorageBlock`, including the std140 and std430 padding.
+
+        Values can be numbers, nested sequences or objects supporting the buffer protocol.
+        Buffer protocol objects (such as numpy arrays) must be tightly packed and
+        store matrices in column major order, they are spread to the array and matrix strides natively.
+
+        Use :py:meth:`UniformBlock.writer` or :py:meth:`StorageBlock.writer` to create one.
+    '''
+
+    __slots__ = ['mglo', '_size', 'extra']
+
+    def __init__(self):
+        self.mglo = None
+        self._size = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<BlockWriter: %d>' % self._size
+
+    def __setitem__(self, key, value):
+        self.mglo.set(key, value)
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The size of the packed block in bytes.
+        '''
+
+        return self._size
+
+    def update(self, values) -> None:
+        '''
+            Set several members at once.
+
+            Args:
+                values (dict): The values keyed by member name.
+        '''
+
+        self.mglo.update(values)
+
+    def write_to(self, buffer, offset=0) -> None:
+        '''
+            Write the packed block into a buffer.
+
+            Args:
+                buffer (Buffer): The buffer.
+                offset (int): The offset in the buffer.
+        '''
+
+        self.mglo.write_to(buffer.mglo, offset)
+
+    def read(self) -> bytes:
+        '''
+            Read the packed block.
+
+            Returns:
+                bytes
+        '''
+
+        return self.mglo.read()
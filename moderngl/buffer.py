@@ -196,6 +196,20 @@ class Buffer:
 
         self.mglo.bind_to_storage_buffer(binding, offset, size)
 
+    def bind_to_atomic_counter(self, binding=0, *, offset=0, size=-1) -> None:
+        '''
+            Bind the buffer to an atomic counter buffer binding.
+
+            Args:
+                binding (int): The atomic counter buffer binding.
+
+            Keyword Args:
+                offset (int): The offset, a multiple of 4.
+                size (int): The size. Value ``-1`` means all.
+        '''
+
+        self.mglo.bind_to_atomic_counter(binding, offset, size)
+
     def orphan(self) -> None:
         '''
             Orphan the buffer.
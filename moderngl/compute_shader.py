@@ -12,12 +12,13 @@ class ComputeShader:
         While it can do rendering, it is generally used for tasks not directly related to drawing.
     '''
 
-    __slots__ = ['mglo', '_members', '_glo', 'ctx', 'extra']
+    __slots__ = ['mglo', '_members', '_glo', '_group_size', 'ctx', 'extra']
 
     def __init__(self):
         self.mglo = None
         self._members = {}
         self._glo = None
+        self._group_size = None
         self.ctx = None
         self.extra = None  #: Any - Attribute for storing user defined objects
         raise TypeError()
@@ -42,6 +43,14 @@ class ComputeShader:
 
         return self.mglo.source
 
+    @property
+    def group_size(self) -> Tuple[int, int, int]:
+        '''
+            tuple: The local work group size declared in the compute shader.
+        '''
+
+        return self._group_size
+
     @property
     def glo(self) -> int:
         '''
@@ -63,6 +72,20 @@ class ComputeShader:
 
         return self.mglo.run(group_x, group_y, group_z)
 
+    def run_indirect(self, buffer, offset=0) -> None:
+        '''
+            Run the compute shader with the number of work groups read from a buffer.
+
+            The buffer holds three unsigned integers at the offset,
+            the number of work groups in the X, Y and Z dimensions.
+
+            Args:
+                buffer (Buffer): The buffer containing the dispatch command.
+                offset (int): The byte offset of the command, a multiple of 4.
+        '''
+
+        return self.mglo.run_indirect(buffer.mglo, offset)
+
     def get(self, key, default) -> Union[Uniform, UniformBlock, Subroutine, Attribute, Varying]:
         '''
             Returns a Uniform, UniformBlock, Subroutine, Attribute or Varying.
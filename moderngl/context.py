@@ -1,3 +1,4 @@
+import collections
 import os
 import warnings
 from typing import Dict, Tuple
@@ -8,9 +9,12 @@ from .compute_shader import ComputeShader
 from .conditional_render import ConditionalRender
 from .framebuffer import Framebuffer
 from .program import Program, detect_format
-from .program_members import (Attribute, Subroutine, Uniform, UniformBlock,
-                              Varying)
+from .program_pipeline import PIPELINE_STAGES, ProgramPipeline
+from .program_members import (Attribute, StorageBlock, Subroutine, Uniform,
+                              UniformBlock, Varying)
 from .query import Query
+from .query_pool import QUERY_KINDS, QueryPool
+from .profiler import Profiler
 from .renderbuffer import Renderbuffer
 from .scope import Scope
 from .texture import Texture
@@ -19,12 +23,22 @@ from .texture_array import TextureArray
 from .texture_cube import TextureCube
 from .vertex_array import VertexArray
 from .sampler import Sampler
+from .uniform_ring import UniformRing
+from .parallel import ParallelPrimitives
+from .append_buffer import AppendBuffer
+from .culling import InstanceCulling
+from .indirect_buffer import IndirectBuffer
 
 __all__ = ['Context', 'create_context', 'create_standalone_context',
            'NOTHING', 'BLEND', 'DEPTH_TEST', 'CULL_FACE', 'RASTERIZER_DISCARD',
            'ZERO', 'ONE', 'SRC_COLOR', 'ONE_MINUS_SRC_COLOR', 'SRC_ALPHA', 'ONE_MINUS_SRC_ALPHA', 'DST_ALPHA',
            'ONE_MINUS_DST_ALPHA', 'DST_COLOR', 'ONE_MINUS_DST_COLOR',
            'DEFAULT_BLENDING', 'PREMULTIPLIED_ALPHA',
+           'VERTEX_ATTRIB_ARRAY_BARRIER_BIT', 'ELEMENT_ARRAY_BARRIER_BIT', 'UNIFORM_BARRIER_BIT',
+           'TEXTURE_FETCH_BARRIER_BIT', 'SHADER_IMAGE_ACCESS_BARRIER_BIT', 'COMMAND_BARRIER_BIT',
+           'PIXEL_BUFFER_BARRIER_BIT', 'TEXTURE_UPDATE_BARRIER_BIT', 'BUFFER_UPDATE_BARRIER_BIT',
+           'FRAMEBUFFER_BARRIER_BIT', 'TRANSFORM_FEEDBACK_BARRIER_BIT', 'ATOMIC_COUNTER_BARRIER_BIT',
+           'SHADER_STORAGE_BARRIER_BIT', 'ALL_BARRIER_BITS',
            'Error']
 
 
@@ -54,6 +68,22 @@ DEFAULT_BLENDING = (SRC_ALPHA, ONE_MINUS_SRC_ALPHA)
 PREMULTIPLIED_ALPHA = (SRC_ALPHA, ONE)
 
 
+VERTEX_ATTRIB_ARRAY_BARRIER_BIT = 0x0001
+ELEMENT_ARRAY_BARRIER_BIT = 0x0002
+UNIFORM_BARRIER_BIT = 0x0004
+TEXTURE_FETCH_BARRIER_BIT = 0x0008
+SHADER_IMAGE_ACCESS_BARRIER_BIT = 0x0020
+COMMAND_BARRIER_BIT = 0x0040
+PIXEL_BUFFER_BARRIER_BIT = 0x0080
+TEXTURE_UPDATE_BARRIER_BIT = 0x0100
+BUFFER_UPDATE_BARRIER_BIT = 0x0200
+FRAMEBUFFER_BARRIER_BIT = 0x0400
+TRANSFORM_FEEDBACK_BARRIER_BIT = 0x0800
+ATOMIC_COUNTER_BARRIER_BIT = 0x1000
+SHADER_STORAGE_BARRIER_BIT = 0x2000
+ALL_BARRIER_BITS = 0xFFFFFFFF
+
+
 class Context:
     '''
         Class exposing OpenGL features.
@@ -288,6 +318,48 @@ class Context:
     def patch_vertices(self, value):
         self.mglo.patch_vertices = value
 
+    @property
+    def compute_barrier(self) -> int:
+        '''
+            int: The memory barrier bits issued after every compute shader dispatch.
+            The value ``0`` disables the automatic barrier.
+
+            Example::
+
+                # Storage buffer writes are visible to the next draw call
+                ctx.compute_barrier = moderngl.SHADER_STORAGE_BARRIER_BIT | moderngl.VERTEX_ATTRIB_ARRAY_BARRIER_BIT
+        '''
+
+        return self.mglo.compute_barrier
+
+    @compute_barrier.setter
+    def compute_barrier(self, value):
+        self.mglo.compute_barrier = value
+
+    @property
+    def gpu_time(self) -> int:
+        '''
+            int: The current GPU time in nanoseconds, the clock of the ``'timestamp'`` queries.
+            Reading it does not wait for the GPU.
+        '''
+
+        return self.mglo.gpu_time
+
+    @property
+    def gl_instrumentation(self) -> bool:
+        '''
+            bool: Count and time every OpenGL call of the context, see :py:meth:`gl_stats`.
+
+            The OpenGL functions of the context are replaced by wrappers while it is enabled.
+            Only a single context can be instrumented at a time.
+        '''
+
+        return self.mglo.gl_instrumentation
+
+    @gl_instrumentation.setter
+    def gl_instrumentation(self, value):
+        self.mglo.gl_instrumentation = value
+
     @property
     def error(self) -> str:
         '''
@@ -483,6 +555,116 @@ class Context:
 
         self.mglo.finish()
 
+    def mark_frame(self) -> None:
+        '''
+            Mark the end of a frame for the per frame numbers of :py:meth:`gl_stats`
+            and in the trace recorded by :py:meth:`begin_trace`.
+        '''
+
+        self.mglo.mark_frame()
+
+    def gl_stats(self, *, reset=False) -> dict:
+        '''
+            The OpenGL calls recorded while :py:attr:`gl_instrumentation` was enabled.
+
+            The calls, the CPU time spent in the driver in nanoseconds and the bytes
+            uploaded from and read back to client memory are counted in total, per function
+            and per frame. The frames are ended by :py:meth:`mark_frame`, only the
+            last 4096 frames are kept.
+
+            The ``histogram`` counts the frames by their number of calls
+            rounded up to a power of two.
+
+            Keyword Args:
+                reset (bool): Start counting again after reading the numbers.
+
+            Returns:
+                dict: ``calls``, ``time``, ``upload_bytes``, ``readback_bytes``, ``functions``,
+                ``frames`` and ``histogram``.
+        '''
+
+        functions, frames = self.mglo.gl_stats(reset)
+        keys = ('calls', 'time', 'upload_bytes', 'readback_bytes')
+
+        stats = {key: sum(values[i] for values in functions.values()) for i, key in enumerate(keys)}
+        stats['functions'] = {name: dict(zip(keys, values)) for name, values in sorted(functions.items())}
+        stats['frames'] = [dict(zip(keys, values)) for values in frames]
+
+        histogram = {}
+        for calls, *_ in frames:
+            bucket = 1 << max(calls - 1, 0).bit_length()
+            histogram[bucket] = histogram.get(bucket, 0) + 1
+
+        stats['histogram'] = dict(sorted(histogram.items()))
+        return stats
+
+    def begin_trace(self, path) -> None:
+        '''
+            Record the OpenGL calls of the context into a binary trace file.
+
+            The trace holds the arguments of the calls and the data uploaded from client memory,
+            the frames are ended by :py:meth:`mark_frame`.
+            Begin the trace right after the creation of the context,
+            the objects created before the trace are missing from the replay.
+            Only one context can be traced at a time and not while :py:attr:`gl_instrumentation` is enabled.
+
+            Args:
+                path (str): The path of the trace file.
+        '''
+
+        self.mglo.begin_trace(path)
+
+    def end_trace(self) -> None:
+        '''
+            Stop recording the trace and close its file.
+        '''
+
+        self.mglo.end_trace()
+
+    def replay_trace(self, path, *, finish=True) -> dict:
+        '''
+            Replay a trace recorded by :py:meth:`begin_trace` and measure its frames.
+
+            The object names and the uniform locations of the trace are mapped to the objects
+            created by the replay. Calls with client memory the trace does not understand
+            are recorded as unsupported and skipped. Calls with pointers that do not fit the method,
+            or with less stored data than the call touches, are skipped too. The replay is also available as
+            ``python -m moderngl replay trace.bin``.
+
+            Args:
+                path (str): The path of the trace file.
+
+            Keyword Args:
+                finish (bool): Wait for the GPU at the end of every frame.
+
+            Returns:
+                dict: ``frames`` the time of every frame in nanoseconds, ``calls`` the number of calls
+                replayed and ``skipped`` the number of unsupported calls.
+        '''
+
+        with open(path, 'rb') as f:
+            data = f.read()
+
+        frames, calls, skipped = self.mglo.replay_trace(data, finish)
+        return {'frames': frames, 'calls': calls, 'skipped': skipped}
+
+    def memory_barrier(self, barriers=None, *, by_region=False) -> None:
+        '''
+            Order the memory writes of shaders before the operations selected by the barrier bits.
+
+            Args:
+                barriers (int): The barrier bits, for example :py:data:`moderngl.SHADER_STORAGE_BARRIER_BIT`.
+                    Value ``None`` means :py:data:`moderngl.ALL_BARRIER_BITS`.
+
+            Keyword Args:
+                by_region (bool): Only order the writes of fragment shaders in the same framebuffer region.
+        '''
+
+        if barriers is None:
+            barriers = ALL_BARRIER_BITS
+
+        self.mglo.memory_barrier(barriers, by_region)
+
     def copy_buffer(self, dst, src, size=-1, *, read_offset=0, write_offset=0) -> None:
         '''
             Copy buffer content.
@@ -517,6 +699,32 @@ class Context:
 
         self.mglo.copy_framebuffer(dst.mglo, src.mglo)
 
+    def copy_texture(self, dst, src, src_region=None, dst_offset=(0, 0, 0), *,
+                     src_level=0, dst_level=0, levels=1) -> None:
+        '''
+            Copy texels between two textures on the GPU with ``glCopyImageSubData``.
+
+            The destination storage is not reallocated and no framebuffer is needed.
+            The textures may have different types, the third coordinate selects
+            the layer of arrays, the face of cube maps and the slice of 3D textures.
+            The texel sizes must match, compressed textures copy whole blocks.
+
+            Args:
+                dst (Texture): Destination texture, texture array, cube map or 3D texture.
+                src (Texture): Source texture, texture array, cube map or 3D texture.
+                src_region (tuple): The ``(x, y, width, height)`` or ``(x, y, z, width, height, depth)``
+                                    of the source. Defaults to the whole source level.
+                dst_offset (tuple): The ``(x, y)`` or ``(x, y, z)`` of the destination.
+
+            Keyword Args:
+                src_level (int): The first source level.
+                dst_level (int): The first destination level.
+                levels (int): The number of levels to copy. Copying several levels copies them whole.
+        '''
+
+        dst_offset = tuple(dst_offset) + (0,) * (3 - len(dst_offset))
+        self.mglo.copy_texture(dst.mglo, src.mglo, src_region, dst_offset, src_level, dst_level, levels)
+
     def detect_framebuffer(self, glo=None) -> 'Framebuffer':
         '''
             Detect framebuffer.
@@ -561,7 +769,61 @@ class Context:
         res.extra = None
         return res
 
-    def texture(self, size, components, data=None, *, samples=0, alignment=1, dtype='f1') -> 'Texture':
+    def append_buffer(self, capacity, item_size, *, dynamic=False) -> 'AppendBuffer':
+        '''
+            Create an :py:class:`AppendBuffer` object with the counter set to zero.
+
+            Args:
+                capacity (int): The maximum number of items.
+                item_size (int): The size of an item in bytes.
+
+            Keyword Args:
+                dynamic (bool): Treat the buffers as dynamic.
+
+            Returns:
+                :py:class:`AppendBuffer` object
+        '''
+
+        if self.version_code < 430:
+            raise Error('OpenGL 4.3 is required')
+
+        res = AppendBuffer.__new__(AppendBuffer)
+        res._data = self.buffer(reserve=capacity * item_size, dynamic=dynamic)
+        res._counter = self.buffer(b'\x00' * 4, dynamic=True)
+        res._capacity = capacity
+        res._item_size = item_size
+        res._clamp = None
+        res._clamped = None
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def indirect_buffer(self, capacity, *, indexed=False, dynamic=False) -> 'IndirectBuffer':
+        '''
+            Create an :py:class:`IndirectBuffer` object without commands.
+
+            Args:
+                capacity (int): The maximum number of commands.
+
+            Keyword Args:
+                indexed (bool): The commands are for vertex arrays with an index buffer.
+                dynamic (bool): Treat the buffer as dynamic.
+
+            Returns:
+                :py:class:`IndirectBuffer` object
+        '''
+
+        res = IndirectBuffer.__new__(IndirectBuffer)
+        res._buffer = self.buffer(reserve=capacity * (20 if indexed else 16), dynamic=dynamic)
+        res._indexed = indexed
+        res._capacity = capacity
+        res._count = 0
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def texture(self, size, components, data=None, *, samples=0, alignment=1, dtype='f1',
+                levels=1, immutable=False, compression=None) -> 'Texture':
         '''
             Create a :py:class:`Texture` object.
 
@@ -574,13 +836,17 @@ class Context:
                 samples (int): The number of samples. Value 0 means no multisample format.
                 alignment (int): The byte alignment 1, 2, 4 or 8.
                 dtype (str): Data type.
+                levels (int): The number of mipmap levels to allocate. Value -1 allocates the full chain.
+                immutable (bool): Allocate every level with ``glTexStorage``. The size and format cannot change later.
+                compression (str): A block compressed format such as ``'bc1'``, ``'bc7'`` or ``'etc2'``.
+                                   The data must contain the compressed blocks, ``dtype`` is only used by :py:meth:`read`.
 
             Returns:
                 :py:class:`Texture` object
         '''
 
         res = Texture.__new__(Texture)
-        res.mglo, res._glo = self.mglo.texture(size, components, data, samples, alignment, dtype)
+        res.mglo, res._glo = self.mglo.texture(size, components, data, samples, alignment, dtype, levels, immutable, compression)
         res._size = size
         res._components = components
         res._samples = samples
@@ -590,7 +856,8 @@ class Context:
         res.extra = None
         return res
 
-    def texture_array(self, size, components, data=None, *, alignment=1, dtype='f1') -> 'TextureArray':
+    def texture_array(self, size, components, data=None, *, alignment=1, dtype='f1',
+                      levels=1, immutable=False, compression=None) -> 'TextureArray':
         '''
             Create a :py:class:`TextureArray` object.
 
@@ -603,13 +870,17 @@ class Context:
             Keyword Args:
                 alignment (int): The byte alignment 1, 2, 4 or 8.
                 dtype (str): Data type.
+                levels (int): The number of mipmap levels to allocate. Value -1 allocates the full chain.
+                immutable (bool): Allocate every level with ``glTexStorage``. The size and format cannot change later.
+                compression (str): A block compressed format such as ``'bc1'``, ``'bc7'`` or ``'etc2'``.
+                                   The data must contain the compressed blocks, ``dtype`` is only used by :py:meth:`read`.
 
             Returns:
                 :py:class:`Texture3D` object
         '''
 
         res = TextureArray.__new__(TextureArray)
-        res.mglo, res._glo = self.mglo.texture_array(size, components, data, alignment, dtype)
+        res.mglo, res._glo = self.mglo.texture_array(size, components, data, alignment, dtype, levels, immutable, compression)
         res._size = size
         res._components = components
         res._dtype = dtype
@@ -617,7 +888,8 @@ class Context:
         res.extra = None
         return res
 
-    def texture3d(self, size, components, data=None, *, alignment=1, dtype='f1') -> 'Texture3D':
+    def texture3d(self, size, components, data=None, *, alignment=1, dtype='f1',
+                  levels=1, immutable=False) -> 'Texture3D':
         '''
             Create a :py:class:`Texture3D` object.
 
@@ -629,18 +901,21 @@ class Context:
             Keyword Args:
                 alignment (int): The byte alignment 1, 2, 4 or 8.
                 dtype (str): Data type.
+                levels (int): The number of mipmap levels to allocate. Value -1 allocates the full chain.
+                immutable (bool): Allocate every level with ``glTexStorage``. The size and format cannot change later.
 
             Returns:
                 :py:class:`Texture3D` object
         '''
 
         res = Texture3D.__new__(Texture3D)
-        res.mglo, res._glo = self.mglo.texture3d(size, components, data, alignment, dtype)
+        res.mglo, res._glo = self.mglo.texture3d(size, components, data, alignment, dtype, levels, immutable)
         res.ctx = self
         res.extra = None
         return res
 
-    def texture_cube(self, size, components, data=None, *, alignment=1, dtype='f1') -> 'TextureCube':
+    def texture_cube(self, size, components, data=None, *, alignment=1, dtype='f1',
+                     levels=1, immutable=False, compression=None) -> 'TextureCube':
         '''
             Create a :py:class:`TextureCube` object.
 
@@ -652,13 +927,57 @@ class Context:
             Keyword Args:
                 alignment (int): The byte alignment 1, 2, 4 or 8.
                 dtype (str): Data type.
+                levels (int): The number of mipmap levels to allocate. Value -1 allocates the full chain.
+                immutable (bool): Allocate every level with ``glTexStorage``. The size and format cannot change later.
+                compression (str): A block compressed format such as ``'bc1'``, ``'bc7'`` or ``'etc2'``.
+                                   The data must contain the compressed blocks, ``dtype`` is only used by :py:meth:`read`.
 
             Returns:
                 :py:class:`TextureCube` object
         '''
 
         res = TextureCube.__new__(TextureCube)
-        res.mglo, res._glo = self.mglo.texture_cube(size, components, data, alignment, dtype)
+        res.mglo, res._glo = self.mglo.texture_cube(size, components, data, alignment, dtype, levels, immutable, compression)
+        res._size = size
+        res._components = components
+        res._dtype = dtype
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def load_texture(self, path, *, immutable=False):
+        '''
+            Load a KTX2 or DDS file into a new texture.
+
+            The file is memory mapped and every level is uploaded straight from the mapping.
+            The texture type follows the file: 2D files create a :py:class:`Texture`,
+            array files a :py:class:`TextureArray`, cube maps a :py:class:`TextureCube`
+            and volume files a :py:class:`Texture3D`. Block compressed files keep their format.
+
+            Args:
+                path (str): The path of the file.
+
+            Keyword Args:
+                immutable (bool): Allocate every level with ``glTexStorage``.
+
+            Returns:
+                :py:class:`Texture`, :py:class:`TextureArray`, :py:class:`TextureCube` or :py:class:`Texture3D` object
+        '''
+
+        kind, mglo, glo, size, components, dtype = self.mglo.load_texture(str(path), immutable)
+
+        if kind == 'texture':
+            res = Texture.__new__(Texture)
+            res._samples = 0
+            res._depth = False
+        elif kind == 'texture_array':
+            res = TextureArray.__new__(TextureArray)
+        elif kind == 'texture_cube':
+            res = TextureCube.__new__(TextureCube)
+        else:
+            res = Texture3D.__new__(Texture3D)
+
+        res.mglo, res._glo = mglo, glo
         res._size = size
         res._components = components
         res._dtype = dtype
@@ -699,7 +1018,7 @@ class Context:
             Create a :py:class:`VertexArray` object.
 
             Args:
-                program (Program): The program used when rendering.
+                program (Program): The program or :py:class:`ProgramPipeline` used when rendering.
                 content (list): A list of (buffer, format, attributes).
                 index_buffer (Buffer): An index buffer.
 
@@ -766,15 +1085,80 @@ class Context:
                 :py:class:`Program` object
         '''
 
+        shaders = (vertex_shader, fragment_shader, geometry_shader, tess_control_shader, tess_evaluation_shader)
+        return self._program(shaders, varyings, False)
+
+    def separable_program(self, stage, source, *, varyings=()) -> 'Program':
+        '''
+            Create a separable :py:class:`Program` object with a single shader stage.
+            Separable programs are combined with :py:meth:`Context.program_pipeline`,
+            so every vertex stage can be used with every fragment stage without linking them together.
+
+            Args:
+                stage (str): ``'vertex'``, ``'fragment'``, ``'geometry'``,
+                             ``'tess_control'`` or ``'tess_evaluation'``.
+                source (str): The source of the shader.
+
+            Keyword Args:
+                varyings (list): A list of varying names.
+
+            Returns:
+                :py:class:`Program` object
+        '''
+
+        if stage not in PIPELINE_STAGES:
+            raise ValueError('invalid stage %r' % stage)
+
+        shaders = tuple(source if x == stage else None for x in PIPELINE_STAGES)
+        return self._program(shaders, varyings, True)
+
+    def program_pipeline(self, *, vertex=None, fragment=None, geometry=None,
+                         tess_control=None, tess_evaluation=None) -> 'ProgramPipeline':
+        '''
+            Create a :py:class:`ProgramPipeline` object from separable programs.
+            The pipeline can be used in place of a :py:class:`Program` when creating a :py:class:`VertexArray`.
+
+            Keyword Args:
+                vertex (Program): The separable program for the vertex stage.
+                fragment (Program): The separable program for the fragment stage.
+                geometry (Program): The separable program for the geometry stage.
+                tess_control (Program): The separable program for the tessellation control stage.
+                tess_evaluation (Program): The separable program for the tessellation evaluation stage.
+
+            Returns:
+                :py:class:`ProgramPipeline` object
+        '''
+
+        stages = dict(zip(PIPELINE_STAGES, (vertex, fragment, geometry, tess_control, tess_evaluation)))
+        stages = {key: value for key, value in stages.items() if value is not None}
+
+        members = {}
+        for program in reversed(list(stages.values())):
+            members.update(program._members)
+
+        res = ProgramPipeline.__new__(ProgramPipeline)
+        res.mglo, res._glo = self.mglo.program_pipeline(
+            tuple(stages[x].mglo if x in stages else None for x in PIPELINE_STAGES)
+        )
+        res._stages = stages
+        res._members = members
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def _program(self, shaders, varyings, separable) -> 'Program':
+        '''
+            For internal use only.
+        '''
+
         if type(varyings) is str:
             varyings = (varyings,)
 
         varyings = tuple(varyings)
 
         res = Program.__new__(Program)
-        res.mglo, ls1, ls2, ls3, ls4, ls5, res._subroutines, res._geom, res._glo = self.mglo.program(
-            vertex_shader, fragment_shader, geometry_shader, tess_control_shader, tess_evaluation_shader,
-            varyings
+        res.mglo, ls1, ls2, ls3, ls4, ls5, ls6, res._subroutines, res._geom, res._glo = self.mglo.program(
+            *shaders, varyings, separable
         )
 
         members = {}
@@ -800,6 +1184,11 @@ class Context:
             members[obj.name] = obj
 
         for item in ls5:
+            obj = StorageBlock.__new__(StorageBlock)
+            obj.mglo, obj._index, obj._size, obj._name = item
+            members[obj.name] = obj
+
+        for item in ls6:
             obj = Subroutine.__new__(Subroutine)
             obj._index, obj._name = item
             members[obj.name] = obj
@@ -809,7 +1198,8 @@ class Context:
         res.extra = None
         return res
 
-    def query(self, *, samples=False, any_samples=False, time=False, primitives=False) -> 'Query':
+    def query(self, *, samples=False, any_samples=False, time=False, primitives=False,
+              statistics=False) -> 'Query':
         '''
             Create a :py:class:`Query` object.
 
@@ -818,10 +1208,12 @@ class Context:
                 any_samples (bool): Query ``GL_ANY_SAMPLES_PASSED`` or not.
                 time (bool): Query ``GL_TIME_ELAPSED`` or not.
                 primitives (bool): Query ``GL_PRIMITIVES_GENERATED`` or not.
+                statistics (bool): Query the pipeline statistics or not.
+                                   Requires OpenGL 4.6 or ``GL_ARB_pipeline_statistics_query``.
         '''
 
         res = Query.__new__(Query)
-        res.mglo = self.mglo.query(samples, any_samples, time, primitives)
+        res.mglo = self.mglo.query(samples, any_samples, time, primitives, statistics)
         res.crender = None
 
         if samples or any_samples:
@@ -832,7 +1224,66 @@ class Context:
         res.extra = None
         return res
 
-    def scope(self, framebuffer, enable_only=None, *, textures=(), uniform_buffers=(), storage_buffers=()) -> 'Scope':
+    def query_pool(self, size, *, kind='any_samples') -> 'QueryPool':
+        '''
+            Create a :py:class:`QueryPool` object.
+
+            Args:
+                size (int): The number of queries.
+
+            Keyword Args:
+                kind (str): ``'samples'``, ``'any_samples'``, ``'any_samples_conservative'``,
+                            ``'primitives'``, ``'time'``, ``'timestamp'``
+                            or a pipeline statistic of :py:attr:`Query.statistics`.
+
+            Returns:
+                :py:class:`QueryPool` object
+        '''
+
+        if kind not in QUERY_KINDS:
+            raise ValueError('invalid kind %r' % kind)
+
+        if kind == 'any_samples_conservative' and self.version_code < 430:
+            raise Error('OpenGL 4.3 is required')
+
+        res = QueryPool.__new__(QueryPool)
+        res.mglo = self.mglo.query_pool(size, QUERY_KINDS[kind])
+        res._size = size
+        res._kind = kind
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def profiler(self, *, frames=3, capacity=256, history=120) -> 'Profiler':
+        '''
+            Create a :py:class:`Profiler` object.
+
+            Keyword Args:
+                frames (int): The number of frames in flight, the results of a frame are read this many frames later.
+                capacity (int): The maximum number of queries in a frame, two per scope.
+                history (int): The number of collected frames kept.
+
+            Returns:
+                :py:class:`Profiler` object
+        '''
+
+        if frames < 1 or capacity < 2:
+            raise ValueError('at least a frame and a capacity of 2 are required')
+
+        res = Profiler.__new__(Profiler)
+        res._queries = self.query_pool(frames * capacity, kind='timestamp')
+        res._frames = frames
+        res._capacity = capacity
+        res._frame = 0
+        res._slots = [None] * frames
+        res._stack = []
+        res._history = collections.deque(maxlen=history)
+        res._dropped = 0
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def scope(self, framebuffer, enable_only=None, *, textures=(), uniform_buffers=(), storage_buffers=(), images=()) -> 'Scope':
         '''
             Create a :py:class:`Scope` object.
 
@@ -844,14 +1295,16 @@ class Context:
                 textures (list): List of (texture, binding) tuples.
                 uniform_buffers (list): List of (buffer, binding) tuples.
                 storage_buffers (list): List of (buffer, binding) tuples.
+                images (list): List of (texture, unit) tuples bound as read-write images.
         '''
 
         textures = tuple((tex.mglo, idx) for tex, idx in textures)
         uniform_buffers = tuple((buf.mglo, idx) for buf, idx in uniform_buffers)
         storage_buffers = tuple((buf.mglo, idx) for buf, idx in storage_buffers)
+        images = tuple((tex.mglo, idx) for tex, idx in images)
 
         res = Scope.__new__(Scope)
-        res.mglo = self.mglo.scope(framebuffer.mglo, enable_only, textures, uniform_buffers, storage_buffers)
+        res.mglo = self.mglo.scope(framebuffer.mglo, enable_only, textures, uniform_buffers, storage_buffers, images)
         res.ctx = self
         res.extra = None
         return res
@@ -972,7 +1425,7 @@ class Context:
         '''
 
         res = ComputeShader.__new__(ComputeShader)
-        res.mglo, ls1, ls2, ls3, ls4, res._glo = self.mglo.compute_shader(source)
+        res.mglo, ls1, ls2, ls3, ls4, ls5, res._glo, res._group_size = self.mglo.compute_shader(source)
 
         members = {}
 
@@ -986,6 +1439,11 @@ class Context:
             obj.mglo, obj._index, obj._size, obj._name = item
             members[obj.name] = obj
 
+        for item in ls3:
+            obj = StorageBlock.__new__(StorageBlock)
+            obj.mglo, obj._index, obj._size, obj._name = item
+            members[obj.name] = obj
+
         res._members = members
         res.ctx = self
         res.extra = None
@@ -1028,6 +1486,91 @@ class Context:
         res.extra = None
         return res
 
+    def uniform_ring(self, block_size, count, *, binding=0) -> 'UniformRing':
+        '''
+            Create a :py:class:`UniformRing` object for per-draw uniform data.
+
+            Args:
+                block_size (int): The size of the data of a single draw.
+                count (int): The number of slots.
+
+            Keyword Args:
+                binding (int): The uniform buffer binding.
+
+            Returns:
+                :py:class:`UniformRing` object
+        '''
+
+        res = UniformRing.__new__(UniformRing)
+        res.mglo, res._stride, res._glo = self.mglo.uniform_ring(block_size, count, binding)
+        res._block_size = block_size
+        res._count = count
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def parallel_primitives(self, *, group_size=None) -> 'ParallelPrimitives':
+        '''
+            Create a :py:class:`ParallelPrimitives` object for reductions, scans, compaction and sorting on the GPU.
+
+            Keyword Args:
+                group_size (int): The work group size, a power of two of at least 16.
+                                  Value ``None`` chooses it from the device limits.
+
+            Returns:
+                :py:class:`ParallelPrimitives` object
+        '''
+
+        if self.version_code < 430:
+            raise Error('OpenGL 4.3 is required')
+
+        info = self.info
+        max_invocations = min(info['GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS'], info['GL_MAX_COMPUTE_WORK_GROUP_SIZE'][0])
+
+        if group_size is None:
+            group_size = 16
+            while group_size * 2 <= min(max_invocations, 256):
+                group_size *= 2
+
+        if group_size < 16 or group_size > max_invocations or group_size & (group_size - 1):
+            raise ValueError('the group size must be a power of two between 16 and %d' % max_invocations)
+
+        res = ParallelPrimitives.__new__(ParallelPrimitives)
+        res._group_size = group_size
+        res._max_groups = info['GL_MAX_COMPUTE_WORK_GROUP_COUNT'][0]
+        res._shaders = {}
+        res._scratch = {}
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def instance_culling(self, *, group_size=64) -> 'InstanceCulling':
+        '''
+            Create an :py:class:`InstanceCulling` object for frustum and occlusion culling on the GPU.
+
+            Keyword Args:
+                group_size (int): The number of instances tested by a work group.
+
+            Returns:
+                :py:class:`InstanceCulling` object
+        '''
+
+        if self.version_code < 430:
+            raise Error('OpenGL 4.3 is required')
+
+        max_invocations = self.info['GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS']
+
+        if group_size < 1 or group_size > max_invocations:
+            raise ValueError('the group size must be between 1 and %d' % max_invocations)
+
+        res = InstanceCulling.__new__(InstanceCulling)
+        res._group_size = group_size
+        res._shaders = {}
+        res._pyramid = None
+        res.ctx = self
+        res.extra = None
+        return res
+
     def clear_samplers(self, start=0, end=-1):
         '''
             Unbinds samplers from texture units.
@@ -1124,8 +1667,24 @@ def create_standalone_context(require=None, **settings) -> 'Context':
             # Require at least OpenGL 4.3
             ctx = moderngl.create_context(require=430)
 
+            # Run without a driver
+            ctx = moderngl.create_standalone_context(backend='null')
+
         Keyword Arguments:
             require (int): OpenGL version code.
+            backend (str): ``'null'`` selects the null backend, the ``MODERNGL_BACKEND``
+                environment variable overrides it.
+            size (tuple): The size of the default framebuffer of the null backend.
+
+        The null backend implements OpenGL 4.6 on the host without a driver.
+        Object names, buffer contents, bindings, uniform values and the times of
+        ``time`` and ``timestamp`` queries are recorded, programs are reflected from
+        the attribute, uniform and uniform block declarations of their shaders.
+        Draws, clears, compute dispatches and texture uploads do nothing and
+        framebuffer and texture reads return zeros.
+        It measures the overhead of moderngl itself, for example with :py:meth:`Context.gl_stats`,
+        and runs logic tests on machines without a GPU.
+        Every null context shares the same objects.
 
         Returns:
             :py:class:`Context` object
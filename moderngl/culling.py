@@ -0,0 +1,412 @@
+from .indirect_buffer import IndirectBuffer
+from .texture import NEAREST
+
+__all__ = ['InstanceCulling']
+
+
+SHADER_IMAGE_ACCESS_BARRIER_BIT = 0x0020
+
+DEPTH_COPY = '''
+    #version 430
+
+    layout (local_size_x = 8, local_size_y = 8) in;
+
+    layout (r32f, binding = 0) writeonly uniform image2D dst;
+
+    uniform sampler2D depth;
+
+    void main() {
+        ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+        if (any(greaterThanEqual(texel, imageSize(dst)))) {
+            return;
+        }
+
+        imageStore(dst, texel, vec4(texelFetch(depth, texel, 0).r));
+    }
+'''
+
+# Every texel keeps the farthest depth of the texels it covers.
+# The last row and column also cover the extra texel of an odd sized level.
+
+DEPTH_REDUCE = '''
+    #version 430
+
+    layout (local_size_x = 8, local_size_y = 8) in;
+
+    layout (r32f, binding = 0) readonly uniform image2D src;
+    layout (r32f, binding = 1) writeonly uniform image2D dst;
+
+    void main() {
+        ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+        ivec2 size = imageSize(dst);
+        if (any(greaterThanEqual(texel, size))) {
+            return;
+        }
+
+        ivec2 src_size = imageSize(src);
+        ivec2 first = texel * 2;
+        ivec2 last = min(texel * 2 + 1, src_size - 1);
+        last.x = texel.x == size.x - 1 ? src_size.x - 1 : last.x;
+        last.y = texel.y == size.y - 1 ? src_size.y - 1 : last.y;
+
+        float depth = 0.0;
+        for (int y = first.y; y <= last.y; ++y) {
+            for (int x = first.x; x <= last.x; ++x) {
+                depth = max(depth, imageLoad(src, ivec2(x, y)).r);
+            }
+        }
+
+        imageStore(dst, texel, vec4(depth));
+    }
+'''
+
+CULL = '''
+    #version 430
+
+    layout (local_size_x = %(group_size)d) in;
+
+    layout (std430, binding = 0) readonly buffer Transforms {
+        mat4 transforms[];
+    };
+
+    #if SHARED_BOUNDS
+    uniform vec4 mesh_bounds;
+    #else
+    layout (std430, binding = 1) readonly buffer Bounds {
+        vec4 bounds[];
+    };
+    #endif
+
+    layout (std430, binding = 2) buffer Commands {
+        uint commands[];
+    };
+
+    #if WRITE_INDICES
+    layout (std430, binding = 3) writeonly buffer VisibleIndices {
+        uint visible_indices[];
+    };
+    #endif
+
+    #if WRITE_TRANSFORMS
+    layout (std430, binding = 4) writeonly buffer VisibleTransforms {
+        mat4 visible_transforms[];
+    };
+    #endif
+
+    uniform mat4 view_projection;
+    uniform uint count;
+    uniform uint instance_count_index;
+
+    #if OCCLUSION
+    uniform sampler2D depth_pyramid;
+    uniform int pyramid_levels;
+
+    bool occluded(vec3 center, float radius) {
+        // The screen space rectangle and the nearest depth of the bounding box of the sphere.
+
+        vec3 rect_min = vec3(1.0);
+        vec3 rect_max = vec3(0.0);
+
+        for (int i = 0; i < 8; ++i) {
+            vec3 direction = vec3(ivec3(i, i >> 1, i >> 2) & 1) * 2.0 - 1.0;
+            vec3 corner = center + radius * direction;
+            vec4 clip = view_projection * vec4(corner, 1.0);
+            if (clip.w <= 0.0) {
+                return false;
+            }
+            vec3 screen = clip.xyz / clip.w * 0.5 + 0.5;
+            rect_min = min(rect_min, screen);
+            rect_max = max(rect_max, screen);
+        }
+
+        // The level where the rectangle covers at most 2x2 texels.
+
+        vec2 size = vec2(textureSize(depth_pyramid, 0));
+        vec2 first = clamp(rect_min.xy, 0.0, 1.0) * size;
+        vec2 last = clamp(rect_max.xy, 0.0, 1.0) * size;
+        float extent = max(last.x - first.x, last.y - first.y);
+        int level = clamp(int(ceil(log2(max(extent, 1.0)))), 0, pyramid_levels - 1);
+
+        ivec2 level_last = textureSize(depth_pyramid, level) - 1;
+        ivec2 texel_first = min(ivec2(first) >> level, level_last);
+        ivec2 texel_last = min(ivec2(min(last, size - 1.0)) >> level, level_last);
+
+        float depth = 0.0;
+        for (int y = texel_first.y; y <= texel_last.y; ++y) {
+            for (int x = texel_first.x; x <= texel_last.x; ++x) {
+                depth = max(depth, texelFetch(depth_pyramid, ivec2(x, y), level).r);
+            }
+        }
+
+        return rect_min.z > depth;
+    }
+    #endif
+
+    void main() {
+        uint index = gl_GlobalInvocationID.x;
+        if (index >= count) {
+            return;
+        }
+
+        mat4 transform = transforms[index];
+
+        #if SHARED_BOUNDS
+        vec4 sphere = mesh_bounds;
+        #else
+        vec4 sphere = bounds[index];
+        #endif
+
+        vec3 center = (transform * vec4(sphere.xyz, 1.0)).xyz;
+        float scale = max(max(length(transform[0].xyz), length(transform[1].xyz)), length(transform[2].xyz));
+        float radius = sphere.w * scale;
+
+        // The frustum planes from the rows of the view projection matrix.
+
+        mat4 rows = transpose(view_projection);
+        for (int i = 0; i < 6; ++i) {
+            vec4 plane = rows[3] + ((i & 1) != 0 ? -rows[i / 2] : rows[i / 2]);
+            if (dot(plane.xyz, center) + plane.w < -radius * length(plane.xyz)) {
+                return;
+            }
+        }
+
+        #if OCCLUSION
+        if (occluded(center, radius)) {
+            return;
+        }
+        #endif
+
+        uint slot = atomicAdd(commands[instance_count_index], 1u);
+
+        #if WRITE_INDICES
+        visible_indices[slot] = index;
+        #endif
+
+        #if WRITE_TRANSFORMS
+        visible_transforms[slot] = transform;
+        #endif
+    }
+'''
+
+
+class InstanceCulling:
+    '''
+        InstanceCulling tests the bounding spheres of instances against the view frustum
+        and optionally a depth pyramid on the GPU and writes the visible instances
+        and their number into an indirect draw command of an :py:class:`IndirectBuffer`.
+
+        The instances are 4x4 column major float transforms in a :py:class:`Buffer`.
+        The visible instances are written as ``'u4'`` instance indices, as copies of their transforms or both.
+        The order of the visible instances is not deterministic.
+
+        The depth pyramid is built from the depth attachment of a :py:class:`Framebuffer`,
+        for example the depth of the previous frame or of the occluders drawn first.
+        Every level keeps the farthest depth of the texels it covers.
+
+        The culling uses the shader storage buffer bindings 0 to 4, the image units 0 and 1
+        and the texture unit 0 and issues the memory barriers for the following draws.
+
+        Requires OpenGL 4.3. Use :py:meth:`Context.instance_culling` to create one.
+    '''
+
+    __slots__ = ['_group_size', '_shaders', '_pyramid', 'ctx', 'extra']
+
+    def __init__(self):
+        self._group_size = None
+        self._shaders = None
+        self._pyramid = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<InstanceCulling: %d>' % self._group_size
+
+    @property
+    def group_size(self) -> int:
+        '''
+            int: The number of instances tested by a work group.
+        '''
+
+        return self._group_size
+
+    @property
+    def pyramid(self) -> 'Texture':
+        '''
+            Texture: The depth pyramid built by the last call of :py:meth:`build_depth_pyramid`
+            or ``None``. A single component ``'f4'`` texture with a full mipmap chain.
+        '''
+
+        return self._pyramid
+
+    def build_depth_pyramid(self, framebuffer) -> 'Texture':
+        '''
+            Build the depth pyramid from the depth attachment of a framebuffer.
+
+            The texture of the pyramid is kept and rebuilt only when the size changes.
+
+            Args:
+                framebuffer (Framebuffer): A framebuffer with a depth texture attachment.
+                                           The depth texture may also be passed directly.
+
+            Returns:
+                :py:class:`Texture`: The depth pyramid.
+        '''
+
+        depth = getattr(framebuffer, 'depth_attachment', framebuffer)
+
+        if depth is None or not getattr(depth, 'depth', False) or not hasattr(depth, 'compare_func'):
+            raise ValueError('the depth attachment must be a depth Texture')
+
+        if depth.samples:
+            raise ValueError('multisample depth textures are not supported')
+
+        width, height = depth.size
+
+        if self._pyramid is None or self._pyramid.size != (width, height):
+            if self._pyramid is not None:
+                self._pyramid.release()
+            self._pyramid = self.ctx.texture((width, height), 1, dtype='f4', levels=-1, immutable=True)
+            self._pyramid.filter = (NEAREST, NEAREST)
+
+        pyramid = self._pyramid
+        copy = self._shader('copy')
+
+        # The comparison mode makes fetching the depth undefined.
+
+        compare_func = depth.compare_func
+        depth.compare_func = ''
+        depth.use(0)
+        copy['depth'].value = 0
+        pyramid.bind_to_image(0, read=False, write=True)
+        copy.run((width + 7) // 8, (height + 7) // 8)
+        depth.compare_func = compare_func
+
+        reduce = self._shader('reduce')
+
+        for level in range(1, pyramid.levels):
+            self.ctx.memory_barrier(SHADER_IMAGE_ACCESS_BARRIER_BIT)
+            pyramid.bind_to_image(0, read=True, write=False, level=level - 1)
+            pyramid.bind_to_image(1, read=False, write=True, level=level)
+            level_width, level_height = max(width >> level, 1), max(height >> level, 1)
+            reduce.run((level_width + 7) // 8, (level_height + 7) // 8)
+
+        self.ctx.memory_barrier()
+        return pyramid
+
+    def cull(self, commands, transforms, bounds, view_projection, *, count=-1, command=0,
+             indices=None, visible_transforms=None, occlusion=False) -> None:
+        '''
+            Cull the instances and write the number of visible instances into the instance count of a command.
+
+            The other fields of the command are kept, :py:meth:`IndirectBuffer.write` sets them.
+            The vertex shader of the draw reads ``indices[gl_InstanceID]``
+            or uses ``visible_transforms`` as a per instance attribute.
+
+            Args:
+                commands (IndirectBuffer): The draw commands.
+                transforms (Buffer): The model transforms of the instances, 16 floats each.
+                bounds: The object space bounding spheres ``(x, y, z, radius)``.
+                        A single sphere shared by every instance or a :py:class:`Buffer` of 4 floats per instance.
+                view_projection: The view projection matrix, 16 floats in column major order or bytes.
+
+            Keyword Args:
+                count (int): The number of instances. Value ``-1`` means every transform in the buffer.
+                command (int): The index of the command in ``commands``.
+                indices (Buffer): The indices of the visible instances, room for ``count`` ``'u4'`` values.
+                visible_transforms (Buffer): The transforms of the visible instances, room for ``count`` transforms.
+                occlusion (bool): Test against the depth pyramid of :py:meth:`build_depth_pyramid` too.
+        '''
+
+        if not isinstance(commands, IndirectBuffer):
+            raise ValueError('the commands must be an IndirectBuffer')
+
+        if command < 0 or command >= commands.capacity:
+            raise ValueError('invalid command %d' % command)
+
+        if count < 0:
+            count = transforms.size // 64
+
+        if count * 64 > transforms.size:
+            raise ValueError('the transforms buffer holds less than %d instances' % count)
+
+        shared_bounds = not hasattr(bounds, 'mglo')
+
+        if not shared_bounds and count * 16 > bounds.size:
+            raise ValueError('the bounds buffer holds less than %d spheres' % count)
+
+        if indices is not None and count * 4 > indices.size:
+            raise ValueError('the indices buffer holds less than %d values' % count)
+
+        if visible_transforms is not None and count * 64 > visible_transforms.size:
+            raise ValueError('the visible_transforms buffer holds less than %d transforms' % count)
+
+        if occlusion and self._pyramid is None:
+            raise ValueError('occlusion requires a depth pyramid, call build_depth_pyramid first')
+
+        shader = self._shader('cull', shared_bounds, indices is not None, visible_transforms is not None, occlusion)
+
+        if isinstance(view_projection, (bytes, bytearray, memoryview)):
+            shader['view_projection'].write(view_projection)
+        else:
+            shader['view_projection'].value = tuple(view_projection)
+
+        if shared_bounds:
+            shader['mesh_bounds'].value = tuple(bounds)
+        else:
+            bounds.bind_to_storage_buffer(1)
+
+        instance_count_offset = command * commands.stride + 4
+        commands.buffer.write(b'\x00' * 4, offset=instance_count_offset)
+
+        shader['count'].value = count
+        shader['instance_count_index'].value = instance_count_offset // 4
+
+        transforms.bind_to_storage_buffer(0)
+        commands.buffer.bind_to_storage_buffer(2)
+
+        if indices is not None:
+            indices.bind_to_storage_buffer(3)
+
+        if visible_transforms is not None:
+            visible_transforms.bind_to_storage_buffer(4)
+
+        if occlusion:
+            self._pyramid.use(0)
+            shader['depth_pyramid'].value = 0
+            shader['pyramid_levels'].value = self._pyramid.levels
+
+        if count:
+            shader.run((count + self._group_size - 1) // self._group_size)
+
+        self.ctx.memory_barrier()
+
+    def release(self) -> None:
+        '''
+            Release the depth pyramid.
+        '''
+
+        if self._pyramid is not None:
+            self._pyramid.release()
+            self._pyramid = None
+
+    def _shader(self, kind, *args):
+        key = (kind,) + args
+        shader = self._shaders.get(key)
+
+        if shader is None:
+            if kind == 'copy':
+                source = DEPTH_COPY
+
+            elif kind == 'reduce':
+                source = DEPTH_REDUCE
+
+            else:
+                defines = zip(('SHARED_BOUNDS', 'WRITE_INDICES', 'WRITE_TRANSFORMS', 'OCCLUSION'), args)
+                header = ''.join('#define %s %d\n' % (name, int(value)) for name, value in defines)
+                source = (CULL % {'group_size': self._group_size}).replace('#version 430\n', '#version 430\n' + header, 1)
+
+            shader = self.ctx.compute_shader(source)
+            self._shaders[key] = shader
+
+        return shader
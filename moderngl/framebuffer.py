@@ -196,7 +196,7 @@ class Framebuffer:
             Read the content of the framebuffer into a buffer.
 
             Args:
-                buffer (bytearray): The buffer that will receive the pixels.
+                buffer (bytearray): The buffer that will receive the pixels. Strided views are filled in place.
                 viewport (tuple): The viewport.
                 components (int): The number of components to read.
 
@@ -0,0 +1,133 @@
+from . import mgl
+
+__all__ = ['IndirectBuffer']
+
+
+class IndirectBuffer:
+    '''
+        An IndirectBuffer holds the draw commands of :py:meth:`VertexArray.render_indirect`.
+
+        The commands of indexed draws are 5 integers
+        ``(count, instanceCount, firstIndex, baseVertex, baseInstance)``,
+        the commands of array draws are 4 integers ``(count, instanceCount, first, baseInstance)``.
+        Passing an IndirectBuffer to :py:meth:`VertexArray.render_indirect` uses the right
+        stride and draws the commands written so far.
+
+        Use :py:meth:`Context.indirect_buffer` to create one.
+    '''
+
+    __slots__ = ['_buffer', '_indexed', '_capacity', '_count', 'ctx', 'extra']
+
+    def __init__(self):
+        self._buffer = None
+        self._indexed = None
+        self._capacity = None
+        self._count = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<IndirectBuffer: %d>' % self._buffer.glo
+
+    @property
+    def buffer(self) -> 'Buffer':
+        '''
+            Buffer: The buffer of the commands.
+            Shaders may write the commands directly.
+        '''
+
+        return self._buffer
+
+    @property
+    def indexed(self) -> bool:
+        '''
+            bool: The commands are for indexed draws.
+        '''
+
+        return self._indexed
+
+    @property
+    def stride(self) -> int:
+        '''
+            int: The size of a command in bytes.
+        '''
+
+        return 20 if self._indexed else 16
+
+    @property
+    def capacity(self) -> int:
+        '''
+            int: The maximum number of commands.
+        '''
+
+        return self._capacity
+
+    @property
+    def count(self) -> int:
+        '''
+            int: The number of commands drawn by default.
+            :py:meth:`write` extends it to the last command written.
+        '''
+
+        return self._count
+
+    @count.setter
+    def count(self, value):
+        if value < 0 or value > self._capacity:
+            raise ValueError('count must be between 0 and %d' % self._capacity)
+
+        self._count = value
+
+    def write(self, counts, instances=1, firsts=0, base_vertices=0, base_instances=0, *, offset=0) -> int:
+        '''
+            Pack and write commands.
+
+            Every argument is a single integer shared by all the commands,
+            a sequence or a buffer of 4 or 8 byte integers such as a numpy array.
+
+            Args:
+                counts: The number of vertices or indices.
+                instances: The number of instances.
+                firsts: The first vertex or the first index.
+                base_vertices: The value added to the indices. Only for indexed draws.
+                base_instances: The first instance.
+
+            Keyword Args:
+                offset (int): The index of the first command to write.
+
+            Returns:
+                int: The number of commands written.
+        '''
+
+        if self._indexed:
+            fields = (counts, instances, firsts, base_vertices, base_instances)
+        else:
+            if not isinstance(base_vertices, int) or base_vertices != 0:
+                raise ValueError('base_vertices is only supported for indexed draws')
+
+            fields = (counts, instances, firsts, base_instances)
+
+        data = mgl.pack_indirect(self._indexed, fields)
+        written = len(data) // self.stride
+
+        if offset < 0 or offset + written > self._capacity:
+            raise ValueError('the commands %d to %d do not fit in the buffer' % (offset, offset + written - 1))
+
+        self._buffer.write(data, offset=offset * self.stride)
+        self._count = max(self._count, offset + written)
+        return written
+
+    def clear(self) -> None:
+        '''
+            Set the count to zero.
+        '''
+
+        self._count = 0
+
+    def release(self) -> None:
+        '''
+            Release the buffer.
+        '''
+
+        self._buffer.release()
@@ -0,0 +1,691 @@
+import struct
+
+__all__ = ['ParallelPrimitives']
+
+
+BUFFER_UPDATE_BARRIER_BIT = 0x0200
+SHADER_STORAGE_BARRIER_BIT = 0x2000
+
+TYPES = {
+    'u4': 'uint',
+    'i4': 'int',
+    'f4': 'float',
+}
+
+IDENTITIES = {
+    ('sum', 'u4'): '0u',
+    ('sum', 'i4'): '0',
+    ('sum', 'f4'): '0.0',
+    ('min', 'u4'): '0xffffffffu',
+    ('min', 'i4'): '0x7fffffff',
+    ('min', 'f4'): 'uintBitsToFloat(0x7f800000u)',
+    ('max', 'u4'): '0u',
+    ('max', 'i4'): 'int(0x80000000u)',
+    ('max', 'f4'): 'uintBitsToFloat(0xff800000u)',
+}
+
+COMBINE = {
+    'sum': 'a + b',
+    'min': 'min(a, b)',
+    'max': 'max(a, b)',
+}
+
+# The keys are sorted by their bits, signed integers and floats are mapped to unsigned integers first.
+
+SORTABLE = {
+    'u4': 'bits',
+    'i4': 'bits ^ 0x80000000u',
+    'f4': 'bits ^ ((bits & 0x80000000u) != 0u ? 0xffffffffu : 0x80000000u)',
+}
+
+HEADER = '''
+    #version 430
+
+    #define GROUP_SIZE %(group_size)du
+    #define SYNC() memoryBarrierShared(); barrier()
+
+    layout (local_size_x = GROUP_SIZE) in;
+
+    uniform uint count;
+    uniform uint groups;
+
+    // The second dispatch row is rounded up, the work groups past the requested number write nothing.
+    // The shaders with barriers keep running them, a return before a barrier is not allowed.
+
+    uint group_index() {
+        return gl_WorkGroupID.x + gl_WorkGroupID.y * gl_NumWorkGroups.x;
+    }
+'''
+
+REDUCE = '''
+    #define T %(type)s
+    #define ITEMS 4u
+
+    layout (std430, binding = 0) readonly buffer Input {
+        T src[];
+    };
+
+    layout (std430, binding = 1) writeonly buffer Output {
+        T dst[];
+    };
+
+    shared T values[GROUP_SIZE];
+
+    T combine(T a, T b) {
+        return %(combine)s;
+    }
+
+    void main() {
+        uint lid = gl_LocalInvocationID.x;
+        uint group = group_index();
+        uint base = group * GROUP_SIZE * ITEMS + lid;
+
+        T value = %(identity)s;
+        for (uint i = 0u; i < ITEMS; ++i) {
+            if (base + i * GROUP_SIZE < count) {
+                value = combine(value, src[base + i * GROUP_SIZE]);
+            }
+        }
+
+        values[lid] = value;
+        SYNC();
+
+        for (uint stride = GROUP_SIZE / 2u; stride > 0u; stride >>= 1u) {
+            if (lid < stride) {
+                values[lid] = combine(values[lid], values[lid + stride]);
+            }
+            SYNC();
+        }
+
+        if (lid == 0u && group < groups) {
+            dst[group] = values[0];
+        }
+    }
+'''
+
+SCAN = '''
+    #define T %(type)s
+    #define S %(source)s
+
+    layout (std430, binding = 0) readonly buffer Input {
+        S src[];
+    };
+
+    layout (std430, binding = 1) writeonly buffer Output {
+        T dst[];
+    };
+
+    layout (std430, binding = 2) writeonly buffer Sums {
+        T sums[];
+    };
+
+    uniform uint inclusive;
+
+    shared T values[GROUP_SIZE];
+
+    void main() {
+        uint lid = gl_LocalInvocationID.x;
+        uint group = group_index();
+        uint index = group * GROUP_SIZE + lid;
+
+        values[lid] = index < count ? %(load)s : T(0);
+        SYNC();
+
+        for (uint offset = 1u; offset < GROUP_SIZE; offset <<= 1u) {
+            T other = lid >= offset ? values[lid - offset] : T(0);
+            SYNC();
+            values[lid] += other;
+            SYNC();
+        }
+
+        if (index < count) {
+            if (inclusive != 0u) {
+                dst[index] = values[lid];
+            } else {
+                dst[index] = lid > 0u ? values[lid - 1u] : T(0);
+            }
+        }
+
+        if (lid == GROUP_SIZE - 1u && group < groups) {
+            sums[group] = values[lid];
+        }
+    }
+'''
+
+ADD = '''
+    #define T %(type)s
+
+    layout (std430, binding = 1) buffer Output {
+        T dst[];
+    };
+
+    layout (std430, binding = 2) readonly buffer Offsets {
+        T offsets[];
+    };
+
+    void main() {
+        uint group = group_index();
+        uint index = group * GROUP_SIZE + gl_LocalInvocationID.x;
+
+        if (group >= groups) {
+            return;
+        }
+
+        if (index < count) {
+            dst[index] += offsets[group];
+        }
+    }
+'''
+
+COMPACT = '''
+    #define T %(type)s
+    #define F %(flag)s
+
+    layout (std430, binding = 0) readonly buffer Input {
+        T src[];
+    };
+
+    layout (std430, binding = 1) readonly buffer Flags {
+        F flags[];
+    };
+
+    layout (std430, binding = 2) readonly buffer Indices {
+        uint indices[];
+    };
+
+    layout (std430, binding = 3) writeonly buffer Output {
+        T dst[];
+    };
+
+    layout (std430, binding = 4) writeonly buffer Counter {
+        uint counter[];
+    };
+
+    uniform uint counter_index;
+
+    void main() {
+        uint group = group_index();
+        uint index = group * GROUP_SIZE + gl_LocalInvocationID.x;
+
+        if (group >= groups) {
+            return;
+        }
+
+        if (index < count) {
+            bool keep = flags[index] != F(0);
+
+            if (keep) {
+                dst[indices[index]] = src[index];
+            }
+
+            if (index == count - 1u) {
+                counter[counter_index] = indices[index] + (keep ? 1u : 0u);
+            }
+        }
+    }
+'''
+
+SORT_DIGIT = '''
+    uniform uint shift;
+    uniform uint blocks;
+
+    uint digit(uint bits) {
+        return ((%(sortable)s) >> shift) & 15u;
+    }
+'''
+
+HISTOGRAM = '''
+    layout (std430, binding = 0) readonly buffer Keys {
+        uint keys[];
+    };
+
+    layout (std430, binding = 1) writeonly buffer Histogram {
+        uint histogram[];
+    };
+
+    shared uint counts[16];
+
+    void main() {
+        uint lid = gl_LocalInvocationID.x;
+        uint group = group_index();
+        uint index = group * GROUP_SIZE + lid;
+
+        if (lid < 16u) {
+            counts[lid] = 0u;
+        }
+        SYNC();
+
+        if (index < count) {
+            atomicAdd(counts[digit(keys[index])], 1u);
+        }
+        SYNC();
+
+        // Digit major order, the exclusive scan of the histogram is the first output index of every block and digit.
+
+        if (lid < 16u && group < groups) {
+            histogram[lid * blocks + group] = counts[lid];
+        }
+    }
+'''
+
+SCATTER = '''
+    layout (std430, binding = 0) readonly buffer KeysIn {
+        uint keys_in[];
+    };
+
+    layout (std430, binding = 1) readonly buffer ValuesIn {
+        uint values_in[];
+    };
+
+    layout (std430, binding = 2) readonly buffer Offsets {
+        uint offsets[];
+    };
+
+    layout (std430, binding = 3) writeonly buffer KeysOut {
+        uint keys_out[];
+    };
+
+    layout (std430, binding = 4) writeonly buffer ValuesOut {
+        uint values_out[];
+    };
+
+    uniform uint has_values;
+
+    // Sixteen 16 bit counters, one for every digit, packed into two uvec4.
+
+    shared uvec4 lo[GROUP_SIZE];
+    shared uvec4 hi[GROUP_SIZE];
+
+    void main() {
+        uint lid = gl_LocalInvocationID.x;
+        uint group = group_index();
+        uint index = group * GROUP_SIZE + lid;
+
+        bool valid = group < groups && index < count;
+        uint key = valid ? keys_in[index] : 0u;
+        uint d = digit(key);
+        uint bit = 1u << ((d & 1u) * 16u);
+
+        uvec4 a = uvec4(0u);
+        uvec4 b = uvec4(0u);
+
+        if (valid) {
+            if (d < 8u) {
+                a[d >> 1u] = bit;
+            } else {
+                b[(d - 8u) >> 1u] = bit;
+            }
+        }
+
+        lo[lid] = a;
+        hi[lid] = b;
+        SYNC();
+
+        for (uint offset = 1u; offset < GROUP_SIZE; offset <<= 1u) {
+            uvec4 other_lo = uvec4(0u);
+            uvec4 other_hi = uvec4(0u);
+
+            if (lid >= offset) {
+                other_lo = lo[lid - offset];
+                other_hi = hi[lid - offset];
+            }
+
+            SYNC();
+            lo[lid] += other_lo;
+            hi[lid] += other_hi;
+            SYNC();
+        }
+
+        // The rank among the elements of the block with the same digit keeps the sort stable.
+
+        if (valid) {
+            uint word = d < 8u ? lo[lid][d >> 1u] : hi[lid][(d - 8u) >> 1u];
+            uint rank = ((word >> ((d & 1u) * 16u)) & 0xffffu) - 1u;
+            uint target = offsets[d * blocks + group] + rank;
+
+            keys_out[target] = key;
+
+            if (has_values != 0u) {
+                values_out[target] = values_in[index];
+            }
+        }
+    }
+'''
+
+
+class ParallelPrimitives:
+    '''
+        ParallelPrimitives runs reductions, prefix scans, stream compaction and radix sort
+        over the elements of :py:class:`Buffer` objects with compute shaders.
+
+        The elements are 4 byte unsigned integers ``'u4'``, signed integers ``'i4'`` or floats ``'f4'``.
+        The work group size is chosen from the device limits, the compute shaders are compiled on first use
+        and the temporary buffers are kept between calls.
+
+        The primitives use the shader storage buffer bindings 0 to 4 and issue the memory barriers between their passes.
+        The results are visible to every following operation, including :py:meth:`Buffer.read`
+        and :py:meth:`ComputeShader.run_indirect`.
+
+        Requires OpenGL 4.3. Use :py:meth:`Context.parallel_primitives` to create one.
+    '''
+
+    __slots__ = ['_group_size', '_max_groups', '_shaders', '_scratch', 'ctx', 'extra']
+
+    def __init__(self):
+        self._group_size = None
+        self._max_groups = None
+        self._shaders = None
+        self._scratch = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<ParallelPrimitives: %d>' % self._group_size
+
+    @property
+    def group_size(self) -> int:
+        '''
+            int: The number of invocations in a work group, a power of two.
+        '''
+
+        return self._group_size
+
+    def reduce(self, src, op='sum', *, dtype='f4', count=-1, dst=None, offset=0):
+        '''
+            Combine the elements of a buffer into a single value.
+
+            Args:
+                src (Buffer): The elements.
+                op (str): ``'sum'``, ``'min'`` or ``'max'``.
+
+            Keyword Args:
+                dtype (str): The type of the elements ``'u4'``, ``'i4'`` or ``'f4'``.
+                count (int): The number of elements. Value ``-1`` means the whole buffer.
+                dst (Buffer): Write the result into this buffer instead of reading it back.
+                offset (int): The byte offset of the result in ``dst``, a multiple of 4.
+
+            Returns:
+                The result when ``dst`` is not given, otherwise ``None``.
+        '''
+
+        self._check_dtype(dtype)
+        if op not in COMBINE:
+            raise ValueError('invalid op %r' % op)
+
+        count = self._count(src, count)
+        shader = self._shader('reduce', dtype, op)
+        items = self._group_size * 4
+
+        # Every pass combines the elements handled by a work group into a single partial result.
+
+        level = 0
+        while True:
+            groups = max((count + items - 1) // items, 1)
+            partials = self._buffer('reduce%d' % level, groups * 4)
+            src.bind_to_storage_buffer(0)
+            partials.bind_to_storage_buffer(1)
+            shader['count'].value = count
+            self._dispatch(shader, groups)
+            if groups == 1:
+                break
+            self.ctx.memory_barrier(SHADER_STORAGE_BARRIER_BIT)
+            src, count, level = partials, groups, level + 1
+
+        if dst is None:
+            self.ctx.memory_barrier()
+            return self._unpack(dtype, partials.read(4))
+
+        # The copy reads the result written by the last pass through the buffer update path.
+
+        self.ctx.memory_barrier(BUFFER_UPDATE_BARRIER_BIT | SHADER_STORAGE_BARRIER_BIT)
+        self.ctx.copy_buffer(dst, partials, 4, write_offset=offset)
+        self.ctx.memory_barrier()
+
+    def scan(self, dst, src, *, dtype='f4', count=-1, inclusive=False) -> None:
+        '''
+            Compute the prefix sums of the elements of a buffer.
+
+            The destination may be the source buffer.
+
+            Args:
+                dst (Buffer): The prefix sums.
+                src (Buffer): The elements.
+
+            Keyword Args:
+                dtype (str): The type of the elements ``'u4'``, ``'i4'`` or ``'f4'``.
+                count (int): The number of elements. Value ``-1`` means the whole source buffer.
+                inclusive (bool): Include the element itself in its sum.
+        '''
+
+        self._check_dtype(dtype)
+        count = self._count(src, count)
+        self._scan(dst, src, count, dtype, 'scan', dtype, inclusive)
+        self.ctx.memory_barrier()
+
+    def compact(self, dst, src, flags=None, *, dtype='f4', count=-1, counter=None, counter_offset=0):
+        '''
+            Copy the selected elements of a buffer to the front of another buffer keeping their order.
+
+            Args:
+                dst (Buffer): The selected elements.
+                src (Buffer): The elements.
+                flags (Buffer): Non-zero ``'u4'`` values select the elements with the same index.
+                                Value ``None`` selects the non-zero elements.
+
+            Keyword Args:
+                dtype (str): The type of the elements ``'u4'``, ``'i4'`` or ``'f4'``.
+                count (int): The number of elements. Value ``-1`` means the whole source buffer.
+                counter (Buffer): Write the number of selected elements as ``'u4'`` into this buffer
+                                  instead of reading it back.
+                counter_offset (int): The byte offset of the number in ``counter``, a multiple of 4.
+
+            Returns:
+                int: The number of selected elements when ``counter`` is not given, otherwise ``None``.
+        '''
+
+        self._check_dtype(dtype)
+        count = self._count(src, count)
+
+        flag_dtype = dtype if flags is None else 'u4'
+        if flags is None:
+            flags = src
+
+        if counter_offset % 4:
+            raise ValueError('the counter offset must be a multiple of 4')
+
+        target = counter if counter is not None else self._buffer('counter', 4)
+        target_offset = counter_offset if counter is not None else 0
+
+        if count == 0:
+            target.write(b'\x00' * 4, offset=target_offset)
+        else:
+            indices = self._buffer('indices', count * 4)
+            self._scan(indices, flags, count, 'u4', 'flags', flag_dtype, False)
+
+            shader = self._shader('compact', dtype, flag_dtype)
+            src.bind_to_storage_buffer(0)
+            flags.bind_to_storage_buffer(1)
+            indices.bind_to_storage_buffer(2)
+            dst.bind_to_storage_buffer(3)
+            target.bind_to_storage_buffer(4)
+            shader['count'].value = count
+            shader['counter_index'].value = target_offset // 4
+            self._dispatch(shader, self._groups(count))
+
+        self.ctx.memory_barrier()
+
+        if counter is None:
+            return self._unpack('u4', target.read(4))
+
+    def sort(self, keys, values=None, *, dtype='u4', count=-1) -> None:
+        '''
+            Sort the elements of a buffer in ascending order in place.
+
+            The sort is a stable least significant digit radix sort of 4 bits per pass.
+            Floats are ordered by value with ``-0.0`` before ``0.0``.
+
+            Args:
+                keys (Buffer): The keys.
+                values (Buffer): Optional 4 byte values reordered with the keys.
+
+            Keyword Args:
+                dtype (str): The type of the keys ``'u4'``, ``'i4'`` or ``'f4'``.
+                count (int): The number of keys. Value ``-1`` means the whole buffer.
+        '''
+
+        self._check_dtype(dtype)
+        count = self._count(keys, count)
+
+        if count < 2:
+            return
+
+        blocks = self._groups(count)
+        histogram = self._buffer('histogram', blocks * 16 * 4)
+        histogram_shader = self._shader('histogram', dtype)
+        scatter_shader = self._shader('scatter', dtype)
+
+        src = (keys, values if values is not None else keys)
+        dst = (self._buffer('keys', count * 4), self._buffer('values', count * 4) if values is not None else keys)
+
+        # There is an even number of passes, the last one writes back to the original buffers.
+
+        for shift in range(0, 32, 4):
+            src[0].bind_to_storage_buffer(0)
+            histogram.bind_to_storage_buffer(1)
+            histogram_shader['count'].value = count
+            histogram_shader['shift'].value = shift
+            histogram_shader['blocks'].value = blocks
+            self._dispatch(histogram_shader, blocks)
+            self.ctx.memory_barrier(SHADER_STORAGE_BARRIER_BIT)
+
+            self._scan(histogram, histogram, blocks * 16, 'u4', 'scan', 'u4', False)
+
+            src[0].bind_to_storage_buffer(0)
+            src[1].bind_to_storage_buffer(1)
+            histogram.bind_to_storage_buffer(2)
+            dst[0].bind_to_storage_buffer(3)
+            dst[1].bind_to_storage_buffer(4)
+            scatter_shader['count'].value = count
+            scatter_shader['shift'].value = shift
+            scatter_shader['blocks'].value = blocks
+            scatter_shader['has_values'].value = int(values is not None)
+            self._dispatch(scatter_shader, blocks)
+            self.ctx.memory_barrier(SHADER_STORAGE_BARRIER_BIT)
+
+            src, dst = dst, src
+
+        self.ctx.memory_barrier()
+
+    def release(self) -> None:
+        '''
+            Release the temporary buffers.
+        '''
+
+        for buffer in self._scratch.values():
+            buffer.release()
+
+        self._scratch.clear()
+
+    def _scan(self, dst, src, count, dtype, kind, source_dtype, inclusive, level=0):
+        # The blocks are scanned separately, the exclusive scan of their sums is added to every block.
+        # The flags kind counts the non-zero source elements.
+
+        groups = self._groups(count)
+        sums = self._buffer('sums%d' % level, groups * 4)
+        shader = self._shader(kind, dtype, source_dtype)
+
+        src.bind_to_storage_buffer(0)
+        dst.bind_to_storage_buffer(1)
+        sums.bind_to_storage_buffer(2)
+        shader['count'].value = count
+        shader['inclusive'].value = int(inclusive)
+        self._dispatch(shader, groups)
+        self.ctx.memory_barrier(SHADER_STORAGE_BARRIER_BIT)
+
+        if groups > 1:
+            self._scan(sums, sums, groups, dtype, 'scan', dtype, False, level + 1)
+
+            shader = self._shader('add', dtype)
+            dst.bind_to_storage_buffer(1)
+            sums.bind_to_storage_buffer(2)
+            shader['count'].value = count
+            self._dispatch(shader, groups)
+            self.ctx.memory_barrier(SHADER_STORAGE_BARRIER_BIT)
+
+    def _shader(self, kind, dtype, arg=None):
+        key = (kind, dtype, arg)
+        shader = self._shaders.get(key)
+
+        if shader is None:
+            params = {
+                'group_size': self._group_size,
+                'type': TYPES[dtype],
+            }
+
+            if kind == 'reduce':
+                params.update(combine=COMBINE[arg], identity=IDENTITIES[(arg, dtype)])
+                source = REDUCE
+
+            elif kind == 'scan':
+                params.update(source=TYPES[arg], load='src[index]')
+                source = SCAN
+
+            elif kind == 'flags':
+                params.update(source=TYPES[arg], load='(src[index] != S(0) ? T(1) : T(0))')
+                source = SCAN
+
+            elif kind == 'add':
+                source = ADD
+
+            elif kind == 'compact':
+                params['flag'] = TYPES[arg]
+                source = COMPACT
+
+            else:
+                params['sortable'] = SORTABLE[dtype]
+                source = SORT_DIGIT + (HISTOGRAM if kind == 'histogram' else SCATTER)
+
+            shader = self.ctx.compute_shader((HEADER + source) % params)
+            self._shaders[key] = shader
+
+        return shader
+
+    def _buffer(self, name, size):
+        buffer = self._scratch.get(name)
+
+        if buffer is None or buffer.size < size:
+            if buffer is not None:
+                buffer.release()
+            buffer = self.ctx.buffer(reserve=max(size, 4))
+            self._scratch[name] = buffer
+
+        return buffer
+
+    def _groups(self, count):
+        return max((count + self._group_size - 1) // self._group_size, 1)
+
+    def _dispatch(self, shader, groups):
+        # Work groups beyond the limit of the first dimension continue in the second one.
+
+        x = min(groups, self._max_groups)
+        shader['groups'].value = groups
+        shader.run(x, (groups + x - 1) // x)
+
+    def _count(self, buffer, count):
+        if count < 0:
+            count = buffer.size // 4
+
+        if count * 4 > buffer.size:
+            raise ValueError('the buffer holds less than %d elements' % count)
+
+        return count
+
+    @staticmethod
+    def _check_dtype(dtype):
+        if dtype not in TYPES:
+            raise ValueError('invalid dtype %r, expected u4, i4 or f4' % dtype)
+
+    @staticmethod
+    def _unpack(dtype, data):
+        return struct.unpack({'u4': 'I', 'i4': 'i', 'f4': 'f'}[dtype], data)[0]
@@ -0,0 +1,369 @@
+import collections
+import json
+import struct
+import time
+
+__all__ = ['Profiler']
+
+
+ProfilerEvent = collections.namedtuple('ProfilerEvent', 'name depth gpu_start gpu_end cpu_start cpu_end')
+ProfilerFrame = collections.namedtuple('ProfilerFrame', 'index events')
+
+BINARY_MAGIC = b'MGLPROF1'
+BINARY_EVENT = struct.Struct('<IH4q')
+
+try:
+    perf_counter_ns = time.perf_counter_ns
+except AttributeError:  # pragma: no cover
+    def perf_counter_ns():
+        return int(time.perf_counter() * 1e9)
+
+
+class ProfilerScope:
+    __slots__ = ['profiler', 'name']
+
+    def __init__(self, profiler, name):
+        self.profiler = profiler
+        self.name = name
+
+    def __enter__(self):
+        self.profiler.push(self.name)
+
+    def __exit__(self, *args):
+        self.profiler.pop()
+
+
+class Profiler:
+    '''
+        A Profiler measures named and nested scopes of a frame on the GPU timeline
+        with ``'timestamp'`` queries and on the CPU timeline with ``time.perf_counter_ns``.
+
+        The queries of a frame are read a few frames later, when the GPU has finished them,
+        so profiling does not stall the pipeline.
+        The GPU times are converted to the clock of the CPU times.
+
+        The collected frames are exported as Chrome trace JSON for ``chrome://tracing``
+        and Perfetto, or in a compact binary format read by :py:meth:`load`.
+
+        Use :py:meth:`Context.profiler` to create one.
+    '''
+
+    __slots__ = ['_queries', '_frames', '_capacity', '_frame', '_slots', '_stack', '_history', '_dropped',
+                 'ctx', 'extra']
+
+    def __init__(self):
+        self._queries = None
+        self._frames = None
+        self._capacity = None
+        self._frame = None
+        self._slots = None
+        self._stack = None
+        self._history = None
+        self._dropped = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<Profiler: %d>' % self._frame
+
+    @property
+    def frame(self) -> int:
+        '''
+            int: The index of the next frame.
+        '''
+
+        return self._frame
+
+    @property
+    def frames(self) -> list:
+        '''
+            list: The collected frames, the oldest first.
+            A frame is an ``(index, events)`` named tuple,
+            the events are ``(name, depth, gpu_start, gpu_end, cpu_start, cpu_end)`` named tuples
+            in the order of their scopes with the times in nanoseconds.
+        '''
+
+        return list(self._history)
+
+    @property
+    def dropped(self) -> int:
+        '''
+            int: The number of scopes not recorded because a frame had more scopes than the capacity.
+        '''
+
+        return self._dropped
+
+    def begin_frame(self, name='frame') -> None:
+        '''
+            Begin a frame and its root scope.
+
+            If the GPU is further behind than the number of frames of the profiler
+            the oldest frame is waited for.
+
+            Args:
+                name (str): The name of the root scope.
+        '''
+
+        if self._stack:
+            raise ValueError('the frame %d is not finished' % (self._frame - 1))
+
+        slot = self._frame % self._frames
+
+        if self._slots[slot] is not None:
+            self.collect(wait=True)
+
+        self._slots[slot] = {
+            'frame': self._frame,
+            'events': [],
+            'used': 0,
+            'cpu_origin': perf_counter_ns(),
+            'gpu_origin': self.ctx.gpu_time,
+        }
+
+        self._frame += 1
+        self._stack.append(slot)
+        self.push(name)
+
+    def end_frame(self) -> None:
+        '''
+            End the root scope of the frame and collect the finished frames without waiting.
+        '''
+
+        if len(self._stack) != 2:
+            raise ValueError('every scope must be closed before the end of the frame')
+
+        self.pop()
+        self._stack.pop()
+        self.collect()
+
+    def push(self, name) -> None:
+        '''
+            Begin a scope in the current frame.
+
+            Args:
+                name (str): The name of the scope.
+        '''
+
+        if not self._stack:
+            raise ValueError('scopes must be inside a frame')
+
+        slot = self._stack[0]
+        state = self._slots[slot]
+
+        if state['used'] + 2 > self._capacity:
+            self._dropped += 1
+            self._stack.append(None)
+            return
+
+        # The query of the end is reserved with the query of the start, closing a scope never runs out of queries.
+
+        index = slot * self._capacity + state['used']
+        self._queries.timestamp(index)
+        state['used'] += 2
+
+        event = [name, len(self._stack) - 1, index, index + 1, perf_counter_ns(), 0]
+        state['events'].append(event)
+        self._stack.append(event)
+
+    def pop(self) -> None:
+        '''
+            End the last scope.
+        '''
+
+        if len(self._stack) < 2:
+            raise ValueError('there is no scope to end')
+
+        event = self._stack.pop()
+
+        if event is None:
+            return
+
+        event[5] = perf_counter_ns()
+        self._queries.timestamp(event[3])
+
+    def scope(self, name) -> 'ProfilerScope':
+        '''
+            A scope for the ``with`` statement.
+
+            Args:
+                name (str): The name of the scope.
+        '''
+
+        return ProfilerScope(self, name)
+
+    def collect(self, *, wait=False) -> int:
+        '''
+            Collect the finished frames.
+            Frames are collected in order, a pending frame holds back the later ones.
+
+            Keyword Args:
+                wait (bool): Wait for every ended frame.
+
+            Returns:
+                int: The number of frames collected.
+        '''
+
+        current = self._stack[0] if self._stack else None
+        pending = sorted((state['frame'], slot) for slot, state in enumerate(self._slots)
+                         if state is not None and slot != current)
+
+        collected = 0
+
+        for _, slot in pending:
+            state = self._slots[slot]
+            first, used = slot * self._capacity, state['used']
+
+            if not wait and not self._queries.ready(first, used):
+                break
+
+            times = struct.unpack('%dq' % used, self._queries.read(first, used, wait=True))
+            offset = state['cpu_origin'] - state['gpu_origin']
+
+            events = []
+            for name, depth, begin, end, cpu_start, cpu_end in state['events']:
+                gpu_start = times[begin - first] + offset
+                gpu_end = times[end - first] + offset
+                events.append(ProfilerEvent(name, depth, gpu_start, gpu_end, cpu_start, cpu_end))
+
+            self._history.append(ProfilerFrame(state['frame'], events))
+            self._slots[slot] = None
+            collected += 1
+
+        return collected
+
+    def clear(self) -> None:
+        '''
+            Forget the collected frames.
+        '''
+
+        self._history.clear()
+
+    def chrome_trace(self) -> dict:
+        '''
+            The collected frames in the Chrome trace event format.
+            The CPU and GPU scopes are on separate threads.
+
+            Returns:
+                dict: The trace, ready for ``json.dump``.
+        '''
+
+        events = [
+            {'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': 1, 'args': {'name': 'CPU'}},
+            {'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': 2, 'args': {'name': 'GPU'}},
+        ]
+
+        for frame in self._history:
+            for event in frame.events:
+                args = {'frame': frame.index}
+                for tid, start, end in ((1, event.cpu_start, event.cpu_end), (2, event.gpu_start, event.gpu_end)):
+                    events.append({
+                        'name': event.name,
+                        'ph': 'X',
+                        'pid': 1,
+                        'tid': tid,
+                        'ts': start / 1000.0,
+                        'dur': (end - start) / 1000.0,
+                        'args': args,
+                    })
+
+        return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+    def save_chrome_trace(self, path) -> None:
+        '''
+            Write the collected frames as a Chrome trace JSON file.
+
+            Args:
+                path (str): The path of the file.
+        '''
+
+        with open(path, 'w') as f:
+            json.dump(self.chrome_trace(), f)
+
+    def save(self, path) -> None:
+        '''
+            Write the collected frames in the compact binary format.
+
+            The file is the magic ``MGLPROF1``, the number and the UTF-8 strings of the scope names,
+            the number of frames and for every frame its index, the number of events
+            and the events as name index, depth and the four times.
+            Every number is little endian.
+
+            Args:
+                path (str): The path of the file.
+        '''
+
+        names = {}
+        for frame in self._history:
+            for event in frame.events:
+                names.setdefault(event.name, len(names))
+
+        chunks = [BINARY_MAGIC, struct.pack('<I', len(names))]
+
+        for name in names:
+            encoded = name.encode()
+            chunks.append(struct.pack('<H', len(encoded)))
+            chunks.append(encoded)
+
+        chunks.append(struct.pack('<I', len(self._history)))
+
+        for frame in self._history:
+            chunks.append(struct.pack('<QI', frame.index, len(frame.events)))
+            for event in frame.events:
+                chunks.append(BINARY_EVENT.pack(names[event.name], event.depth, *event[2:]))
+
+        with open(path, 'wb') as f:
+            f.write(b''.join(chunks))
+
+    @staticmethod
+    def load(path) -> list:
+        '''
+            Read the frames written by :py:meth:`save`.
+
+            Args:
+                path (str): The path of the file.
+
+            Returns:
+                list: The frames in the format of :py:attr:`frames`.
+        '''
+
+        with open(path, 'rb') as f:
+            data = f.read()
+
+        if data[:8] != BINARY_MAGIC:
+            raise ValueError('not a profiler file')
+
+        offset = 8
+        num_names, = struct.unpack_from('<I', data, offset)
+        offset += 4
+
+        names = []
+        for _ in range(num_names):
+            size, = struct.unpack_from('<H', data, offset)
+            names.append(data[offset + 2:offset + 2 + size].decode())
+            offset += 2 + size
+
+        num_frames, = struct.unpack_from('<I', data, offset)
+        offset += 4
+
+        frames = []
+        for _ in range(num_frames):
+            index, num_events = struct.unpack_from('<QI', data, offset)
+            offset += 12
+
+            events = []
+            for _ in range(num_events):
+                name, depth, *times = BINARY_EVENT.unpack_from(data, offset)
+                events.append(ProfilerEvent(names[name], depth, *times))
+                offset += BINARY_EVENT.size
+
+            frames.append(ProfilerFrame(index, events))
+
+        return frames
+
+    def release(self) -> None:
+        '''
+            Release the queries.
+        '''
+
+        self._queries.release()
@@ -1,7 +1,7 @@
 from typing import Tuple, Union
 
-from .program_members import (Attribute, Subroutine, Uniform, UniformBlock,
-                              Varying)
+from .program_members import (Attribute, Subroutine, Uniform, UniformBatch,
+                              UniformBlock, Varying)
 
 __all__ = ['Program', 'detect_format']
 
@@ -104,6 +104,29 @@ class Program:
 
         return self._members.get(key, default)
 
+    def uniform_batch(self, names) -> 'UniformBatch':
+        '''
+            Create a :py:class:`UniformBatch` for updating several uniforms at once.
+
+            Args:
+                names (list): The names of the uniforms.
+
+            Returns:
+                :py:class:`UniformBatch` object
+        '''
+
+        names = tuple(names)
+
+        for name in names:
+            if not isinstance(self._members.get(name), Uniform):
+                raise KeyError('%s is not a uniform' % name)
+
+        res = UniformBatch.__new__(UniformBatch)
+        res.mglo, res._size = self.mglo.uniform_batch(tuple(self._members[name].mglo for name in names), names)
+        res._names = names
+        res.extra = None
+        return res
+
     def release(self) -> None:
         '''
             Release the ModernGL object.
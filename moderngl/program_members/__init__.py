@@ -1,5 +1,8 @@
 from .attribute import *
+from .block_member import *
+from .storage_block import *
 from .subroutine import *
 from .uniform import *
+from .uniform_batch import *
 from .uniform_block import *
 from .varying import *
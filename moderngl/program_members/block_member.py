@@ -0,0 +1,101 @@
+__all__ = ['BlockMember']
+
+
+class BlockMember:
+    '''
+        A BlockMember describes the layout of a single member of a
+        :py:class:`UniformBlock` or a :py:class:`StorageBlock`.
+
+        The offsets and strides are queried from the driver, so they are correct
+        for the std140, std430 and shared layouts.
+    '''
+
+    __slots__ = ['_name', '_gl_type', '_offset', '_array_length', '_array_stride',
+                 '_matrix_stride', '_dimension', '_shape', '_row_major']
+
+    def __init__(self):
+        self._name = None
+        self._gl_type = None
+        self._offset = None
+        self._array_length = None
+        self._array_stride = None
+        self._matrix_stride = None
+        self._dimension = None
+        self._shape = None
+        self._row_major = None
+        raise TypeError()
+
+    def __repr__(self):
+        return '<BlockMember: %s offset=%d>' % (self._name, self._offset)
+
+    @property
+    def name(self) -> str:
+        '''
+            str: The name of the member.
+        '''
+
+        return self._name
+
+    @property
+    def gl_type(self) -> int:
+        '''
+            int: The OpenGL type of the member.
+        '''
+
+        return self._gl_type
+
+    @property
+    def offset(self) -> int:
+        '''
+            int: The byte offset of the member from the start of the block.
+        '''
+
+        return self._offset
+
+    @property
+    def array_length(self) -> int:
+        '''
+            int: The length of the array. ``0`` for an array without a size.
+        '''
+
+        return self._array_length
+
+    @property
+    def array_stride(self) -> int:
+        '''
+            int: The byte distance between two array elements.
+        '''
+
+        return self._array_stride
+
+    @property
+    def matrix_stride(self) -> int:
+        '''
+            int: The byte distance between two columns (or rows if :py:attr:`row_major`) of a matrix.
+        '''
+
+        return self._matrix_stride
+
+    @property
+    def dimension(self) -> int:
+        '''
+            int: The number of components in a single element.
+        '''
+
+        return self._dimension
+
+    @property
+    def shape(self) -> str:
+        '''
+            str: The scalar type, ``f``, ``d``, ``i``, ``I`` or ``?``.
+        '''
+
+        return self._shape
+
+    @property
+    def row_major(self) -> bool:
+        '''
+            bool: The matrix is stored in row major order.
+        '''
+
+        return self._row_major
@@ -0,0 +1,82 @@
+from ..block_writer import BlockWriter
+from .uniform_block import block_members, block_writer
+
+__all__ = ['StorageBlock']
+
+
+class StorageBlock:
+    '''
+        A StorageBlock is a shader storage block declared with the "buffer" storage qualifier.
+        Storage blocks are only reflected when OpenGL 4.3 is supported.
+    '''
+
+    __slots__ = ['mglo', '_index', '_size', '_name', 'extra']
+
+    def __init__(self):
+        self.mglo = None
+        self._index = None
+        self._size = None
+        self._name = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<StorageBlock: %d>' % self._index
+
+    @property
+    def binding(self) -> int:
+        '''
+            int: The binding of the storage block.
+        '''
+
+        return self.mglo.binding
+
+    @binding.setter
+    def binding(self, binding):
+        self.mglo.binding = binding
+
+    @property
+    def name(self) -> str:
+        '''
+            str: The name of the storage block.
+        '''
+
+        return self._name
+
+    @property
+    def index(self) -> int:
+        '''
+            int: The index of the storage block.
+        '''
+
+        return self._index
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The size of the storage block.
+            An array without a size at the end of the block is counted with a single element.
+        '''
+
+        return self._size
+
+    @property
+    def members(self) -> dict:
+        '''
+            dict: The :py:class:`BlockMember` objects of the storage block by name.
+        '''
+
+        return block_members(self.mglo)
+
+    def writer(self, runtime_length=1) -> 'BlockWriter':
+        '''
+            Create a :py:class:`BlockWriter` for filling a buffer with the layout of this block.
+
+            Args:
+                runtime_length (int): The number of elements of the array without a size at the end of the block.
+
+            Returns:
+                :py:class:`BlockWriter` object
+        '''
+
+        return block_writer(self.mglo, runtime_length)
@@ -150,7 +150,9 @@ class Uniform:
     def value(self):
         '''
             The value of the uniform.
-            Reading the value of the uniform may force the GPU to sync.
+            The value is served from a CPU side copy of the uniform, reading it never syncs with the GPU.
+            Assigning an unchanged value is a no-op, changed values are uploaded before the next
+            :py:meth:`VertexArray.render`, :py:meth:`VertexArray.transform` or :py:meth:`ComputeShader.run`.
 
             The value must be a tuple for non array uniforms.
             The value must be a list of tuples for array uniforms.
@@ -165,6 +167,7 @@ class Uniform:
     def read(self) -> bytes:
         '''
             Read the value of the uniform.
+            For array uniforms the data of the whole array is returned.
         '''
 
         return self.mglo.data
@@ -0,0 +1,63 @@
+__all__ = ['UniformBatch']
+
+
+class UniformBatch:
+    '''
+        A UniformBatch updates a fixed set of uniforms of a :py:class:`Program` in a single call.
+
+        The values are written to the shadow block of the program and only the
+        changed uniforms are uploaded before the next render or transform.
+
+        Use :py:meth:`Program.uniform_batch` to create one.
+    '''
+
+    __slots__ = ['mglo', '_names', '_size', 'extra']
+
+    def __init__(self):
+        self.mglo = None
+        self._names = None
+        self._size = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<UniformBatch: %s>' % ', '.join(self._names)
+
+    @property
+    def names(self) -> tuple:
+        '''
+            tuple: The names of the uniforms in the order they are packed.
+        '''
+
+        return self._names
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The size of a packed record in bytes.
+        '''
+
+        return self._size
+
+    def write(self, data) -> None:
+        '''
+            Write a packed record containing the raw bytes of every uniform
+            in the order of :py:attr:`names`. Arrays and matrices are stored
+            the same way as :py:meth:`Uniform.write` expects them.
+
+            Args:
+                data (bytes): The record. Its length must be equal to :py:attr:`size`.
+        '''
+
+        self.mglo.write(data)
+
+    def update(self, values) -> None:
+        '''
+            Set the value of the uniforms from a dictionary.
+            Names missing from the dictionary are left unchanged.
+
+            Args:
+                values (dict): The values keyed by uniform name.
+        '''
+
+        self.mglo.update(values)
@@ -1,3 +1,6 @@
+from ..block_writer import BlockWriter
+from .block_member import BlockMember
+
 __all__ = ['UniformBlock']
 
 
@@ -54,3 +57,48 @@ class UniformBlock:
         '''
 
         return self._size
+
+    @property
+    def members(self) -> dict:
+        '''
+            dict: The :py:class:`BlockMember` objects of the uniform block by name.
+        '''
+
+        return block_members(self.mglo)
+
+    def writer(self) -> 'BlockWriter':
+        '''
+            Create a :py:class:`BlockWriter` for filling a buffer with the layout of this block.
+
+            Returns:
+                :py:class:`BlockWriter` object
+        '''
+
+        return block_writer(self.mglo, 1)
+
+
+def block_members(mglo) -> dict:
+    '''
+        For internal use only.
+    '''
+
+    members = {}
+
+    for item in mglo.members():
+        obj = BlockMember.__new__(BlockMember)
+        obj._name, obj._gl_type, obj._offset, obj._array_length, obj._array_stride, \
+            obj._matrix_stride, obj._dimension, obj._shape, obj._row_major = item
+        members[obj.name] = obj
+
+    return members
+
+
+def block_writer(mglo, runtime_length) -> 'BlockWriter':
+    '''
+        For internal use only.
+    '''
+
+    res = BlockWriter.__new__(BlockWriter)
+    res.mglo, res._size = mglo.writer(runtime_length)
+    res.extra = None
+    return res
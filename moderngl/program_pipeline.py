@@ -0,0 +1,85 @@
+from typing import Dict, Union
+
+from .program import Program
+from .program_members import (Attribute, Subroutine, Uniform, UniformBlock,
+                              Varying)
+
+__all__ = ['ProgramPipeline']
+
+PIPELINE_STAGES = ('vertex', 'fragment', 'geometry', 'tess_control', 'tess_evaluation')
+
+
+class ProgramPipeline:
+    '''
+        A ProgramPipeline combines separable :py:class:`Program` objects, one for each shader stage.
+        The stages are only combined when the pipeline is bound, there is no linking involved.
+
+        A ProgramPipeline can be used in place of a :py:class:`Program` when creating a :py:class:`VertexArray`.
+        The members of the stages are accessible from the pipeline, the vertex stage takes precedence
+        when two stages declare a member with the same name.
+        Subroutines are not supported for pipelines.
+
+        A ProgramPipeline object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.program_pipeline` to create one.
+    '''
+
+    __slots__ = ['mglo', '_stages', '_members', '_glo', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None
+        self._stages = None
+        self._members = {}
+        self._glo = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<ProgramPipeline: %d>' % self._glo
+
+    def __eq__(self, other):
+        return type(self) is type(other) and self.mglo is other.mglo
+
+    def __getitem__(self, key) -> Union[Uniform, UniformBlock, Subroutine, Attribute, Varying]:
+        return self._members[key]
+
+    def __iter__(self):
+        yield from self._members
+
+    @property
+    def stages(self) -> Dict[str, Program]:
+        '''
+            dict: The separable programs by stage name.
+        '''
+
+        return self._stages
+
+    @property
+    def glo(self) -> int:
+        '''
+            int: The internal OpenGL object.
+            This values is provided for debug purposes only.
+        '''
+
+        return self._glo
+
+    def get(self, key, default) -> Union[Uniform, UniformBlock, Subroutine, Attribute, Varying]:
+        '''
+            Returns a Uniform, UniformBlock, Subroutine, Attribute or Varying of any stage.
+
+            Args:
+                default: This is the value to be returned in case key does not exist.
+
+            Returns:
+                :py:class:`Uniform`, :py:class:`UniformBlock`, :py:class:`Subroutine`,
+                :py:class:`Attribute` or :py:class:`Varying`
+        '''
+
+        return self._members.get(key, default)
+
+    def release(self) -> None:
+        '''
+            Release the ModernGL object.
+        '''
+
+        self.mglo.release()
@@ -1,6 +1,21 @@
 __all__ = ['Query']
 
 
+PIPELINE_STATISTICS = {
+    'vertices_submitted': 0x82EE,
+    'primitives_submitted': 0x82EF,
+    'vertex_shader_invocations': 0x82F0,
+    'tess_control_shader_patches': 0x82F1,
+    'tess_evaluation_shader_invocations': 0x82F2,
+    'geometry_shader_invocations': 0x887F,
+    'geometry_shader_primitives_emitted': 0x82F3,
+    'fragment_shader_invocations': 0x82F4,
+    'compute_shader_invocations': 0x82F5,
+    'clipping_input_primitives': 0x82F6,
+    'clipping_output_primitives': 0x82F7,
+}
+
+
 class Query:
     '''
         This class represents a Query object.
@@ -48,3 +63,31 @@ class Query:
         '''
 
         return self.mglo.elapsed
+
+    @property
+    def statistics(self) -> dict:
+        '''
+            dict: The pipeline statistics by name, ``None`` if they were not queried.
+
+            The counters are ``vertices_submitted``, ``primitives_submitted``, ``vertex_shader_invocations``,
+            ``tess_control_shader_patches``, ``tess_evaluation_shader_invocations``,
+            ``geometry_shader_invocations``, ``geometry_shader_primitives_emitted``,
+            ``fragment_shader_invocations``, ``compute_shader_invocations``,
+            ``clipping_input_primitives`` and ``clipping_output_primitives``.
+            The fragment shader invocations compared to the samples passed show the overdraw.
+        '''
+
+        values = self.mglo.statistics
+
+        if values is None:
+            return None
+
+        return dict(zip(PIPELINE_STATISTICS, values))
+
+    @property
+    def ready(self) -> bool:
+        '''
+            bool: The results are available, reading them will not wait for the GPU.
+        '''
+
+        return self.mglo.ready
@@ -0,0 +1,221 @@
+from .query import PIPELINE_STATISTICS
+
+__all__ = ['QueryPool']
+
+
+QUERY_KINDS = {
+    'samples': 0x8914,
+    'any_samples': 0x8C2F,
+    'any_samples_conservative': 0x8D6A,
+    'primitives': 0x8C87,
+    'time': 0x88BF,
+    'timestamp': 0x8E28,
+}
+
+QUERY_KINDS.update(PIPELINE_STATISTICS)
+
+
+class QueryPool:
+    '''
+        A QueryPool allocates many query objects of the same kind at once
+        and reads their results without waiting for the GPU.
+
+        A query is issued with :py:meth:`begin` and :py:meth:`end` or with :py:meth:`render`
+        that draws a proxy per query, for example the bounding boxes of the objects for occlusion culling.
+        Timestamp queries are issued with :py:meth:`timestamp`.
+        A pool of a pipeline statistic counts a single counter of :py:attr:`Query.statistics` per query.
+        :py:meth:`results` only reads the queries the GPU has finished, the others keep
+        their last result until they are available, usually a frame later.
+
+        Use :py:meth:`Context.query_pool` to create one.
+    '''
+
+    __slots__ = ['mglo', '_size', '_kind', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None
+        self._size = None
+        self._kind = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<QueryPool: %s %d>' % (self._kind, self._size)
+
+    def __len__(self):
+        return self._size
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The number of queries.
+        '''
+
+        return self._size
+
+    @property
+    def kind(self) -> str:
+        '''
+            str: The kind of the queries.
+        '''
+
+        return self._kind
+
+    @property
+    def pending(self) -> int:
+        '''
+            int: The number of issued queries with results not read yet.
+        '''
+
+        return self.mglo.pending
+
+    def begin(self, index) -> None:
+        '''
+            Begin a query. Only a single query of the pool can be active.
+
+            Args:
+                index (int): The index of the query.
+        '''
+
+        self.mglo.begin(index)
+
+    def end(self) -> None:
+        '''
+            End the active query.
+        '''
+
+        self.mglo.end()
+
+    def timestamp(self, index) -> None:
+        '''
+            Record the GPU time in nanoseconds once the previous commands have completed.
+            Only for ``'timestamp'`` pools.
+
+            Args:
+                index (int): The index of the query.
+        '''
+
+        self.mglo.timestamp(index)
+
+    def render(self, vertex_array, mode=None, vertices=36, *, first=0, count=-1) -> None:
+        '''
+            Issue a query around the draw of a proxy for every query in a range with a single call.
+
+            The proxy of the query ``i`` is made of the vertices
+            from ``i * vertices`` to ``(i + 1) * vertices`` of the vertex array.
+            The proxies are usually drawn without color and depth writes.
+
+            Args:
+                vertex_array (VertexArray): The proxies.
+                mode (int): By default :py:data:`TRIANGLES` will be used.
+                vertices (int): The number of vertices of a proxy, 36 for a box of triangles.
+
+            Keyword Args:
+                first (int): The index of the first query.
+                count (int): The number of queries. Value ``-1`` means every query from ``first``.
+        '''
+
+        if mode is None:
+            mode = 0x0004
+
+        vertex_array.mglo.render_queries(self.mglo, mode, vertices, first, count)
+
+    def poll(self, *, wait=False) -> int:
+        '''
+            Read the results of the finished queries.
+
+            Keyword Args:
+                wait (bool): Wait for every issued query.
+
+            Returns:
+                int: The number of queries still pending.
+        '''
+
+        return self.mglo.poll(wait)
+
+    def ready(self, first=0, count=-1) -> bool:
+        '''
+            Check that the results of a range of queries are available without waiting.
+
+            Args:
+                first (int): The index of the first query.
+                count (int): The number of queries. Value ``-1`` means every query from ``first``.
+
+            Returns:
+                bool: No query in the range is pending.
+        '''
+
+        return self.mglo.ready(first, count)
+
+    def read(self, first=0, count=-1, *, wait=False) -> bytes:
+        '''
+            Read the results as signed 64 bit integers.
+
+            Args:
+                first (int): The index of the first query.
+                count (int): The number of queries. Value ``-1`` means every query from ``first``.
+
+            Keyword Args:
+                wait (bool): Wait for the pending queries in the range.
+
+            Returns:
+                bytes: The last available result of every query, ``-1`` for queries without result.
+        '''
+
+        return self.mglo.results(first, count, wait)
+
+    def results(self, first=0, count=-1, *, wait=False):
+        '''
+            Read the results into a numpy array. Requires numpy, :py:meth:`read` does not.
+
+            Args:
+                first (int): The index of the first query.
+                count (int): The number of queries. Value ``-1`` means every query from ``first``.
+
+            Keyword Args:
+                wait (bool): Wait for the pending queries in the range.
+
+            Returns:
+                numpy.ndarray: The last available result of every query as ``int64``,
+                ``-1`` for queries without result.
+        '''
+
+        import numpy as np
+
+        return np.frombuffer(self.mglo.results(first, count, wait), dtype=np.int64)
+
+    def reset(self) -> None:
+        '''
+            Forget the results and the pending queries.
+        '''
+
+        self.mglo.reset()
+
+    def begin_render(self, index, *, wait=False) -> None:
+        '''
+            Begin a conditional render on the result of a sample query.
+            The draws are discarded on the GPU if the query passed no samples.
+
+            Args:
+                index (int): The index of the query.
+
+            Keyword Args:
+                wait (bool): Wait for the result on the GPU instead of drawing when it is not available.
+        '''
+
+        self.mglo.begin_render(index, wait)
+
+    def end_render(self) -> None:
+        '''
+            End the conditional render.
+        '''
+
+        self.mglo.end_render()
+
+    def release(self) -> None:
+        '''
+            Release the query objects.
+        '''
+
+        self.mglo.release()
@@ -258,6 +258,30 @@ class Texture:
 
         return self._depth
 
+    @property
+    def levels(self) -> int:
+        '''
+            int: The number of allocated mipmap levels.
+        '''
+
+        return self.mglo.levels
+
+    @property
+    def immutable(self) -> bool:
+        '''
+            bool: Is the storage of the texture allocated with ``glTexStorage``.
+        '''
+
+        return self.mglo.immutable
+
+    @property
+    def compression(self) -> str:
+        '''
+            str: The block compressed format of the texture or ``None``.
+        '''
+
+        return self.mglo.compression
+
     @property
     def glo(self) -> int:
         '''
@@ -286,7 +310,7 @@ class Texture:
             Read the content of the texture into a buffer.
 
             Args:
-                buffer (bytearray): The buffer that will receive the pixels.
+                buffer (bytearray): The buffer that will receive the pixels. Strided views are filled in place.
 
             Keyword Args:
                 level (int): The mipmap level.
@@ -304,7 +328,7 @@ class Texture:
             Update the content of the texture.
 
             Args:
-                data (bytes): The pixel data.
+                data (bytes): The pixel data. Strided views such as numpy slices are uploaded in place.
                 viewport (tuple): The viewport.
 
             Keyword Args:
@@ -317,6 +341,83 @@ class Texture:
 
         self.mglo.write(data, viewport, level, alignment)
 
+    def write_compressed(self, data, viewport=None, *, level=0) -> None:
+        '''
+            Update the content of a compressed texture with compressed blocks.
+
+            The viewport must be aligned to the blocks of the format, only the
+            right and bottom edge of the level may contain partial blocks.
+
+            Args:
+                data (bytes): The compressed blocks.
+                viewport (tuple): The viewport.
+
+            Keyword Args:
+                level (int): The mipmap level.
+        '''
+
+        if type(data) is Buffer:
+            data = data.mglo
+
+        self.mglo.write_compressed(data, viewport, level)
+
+    def write_levels(self, data, *, base=0, levels=-1, alignment=1) -> None:
+        '''
+            Upload a prebuilt mipmap chain with a single call.
+
+            The levels must be tightly packed one after the other in ``data``,
+            starting with the ``base`` level.
+
+            Args:
+                data (bytes): The pixel data of every level.
+
+            Keyword Args:
+                base (int): The first level to write.
+                levels (int): The number of levels to write. Value -1 writes every allocated level from ``base``.
+                alignment (int): The byte alignment of the pixels.
+        '''
+
+        if type(data) is Buffer:
+            data = data.mglo
+
+        self.mglo.write_levels(data, base, levels, alignment)
+
+    def view(self, components=None, dtype=None, *, base_level=0, levels=-1) -> 'Texture':
+        '''
+            Create a texture sharing the storage of this texture without copying it.
+
+            The view can reinterpret the texels with a different format of the same size
+            and can expose a subset of the mipmap levels. Only immutable textures can be viewed.
+
+            Args:
+                components (int): The number of components of the view. Defaults to the components of the texture.
+                dtype (str): The data type of the view. Defaults to the data type of the texture.
+
+            Keyword Args:
+                base_level (int): The first level of the view.
+                levels (int): The number of levels. Value -1 includes every level from ``base_level``.
+
+            Returns:
+                :py:class:`Texture` object
+        '''
+
+        if components is None:
+            components = self._components
+
+        if dtype is None:
+            dtype = self._dtype
+
+        res = Texture.__new__(Texture)
+        res.mglo, res._glo = self.mglo.view(components, dtype, base_level, levels)
+        res._size = tuple(max(x >> base_level, 1) for x in self._size)
+        res._components = components
+        res._samples = self._samples
+        res._dtype = dtype
+        res._depth = False
+        res.ctx = self.ctx
+        res.extra = None
+        return res
+
     def build_mipmaps(self, base=0, max_level=1000) -> None:
         '''
             Generate mipmaps.
@@ -344,6 +445,24 @@ class Texture:
 
         self.mglo.use(location)
 
+    def bind_to_image(self, unit, read=True, write=True, *, level=0, format=None) -> None:
+        '''
+            Bind a level of the texture to an image unit for image load/store.
+
+            Args:
+                unit (int): The image unit.
+                read (bool): The shaders can read the image.
+                write (bool): The shaders can write the image.
+
+            Keyword Args:
+                level (int): The mipmap level.
+                format (str): The image format as a GLSL layout qualifier such as ``'rgba32f'`` or ``'r32ui'``,
+                    or a dtype such as ``'f4'`` with the components of the texture.
+                    By default the internal format of the texture is used.
+        '''
+
+        self.mglo.bind_to_image(unit, read, write, level, format)
+
     def release(self) -> None:
         '''
             Release the ModernGL object.
@@ -189,6 +189,22 @@ class Texture3D:
 
         return self._dtype
 
+    @property
+    def levels(self) -> int:
+        '''
+            int: The number of allocated mipmap levels.
+        '''
+
+        return self.mglo.levels
+
+    @property
+    def immutable(self) -> bool:
+        '''
+            bool: Is the storage of the texture allocated with ``glTexStorage``.
+        '''
+
+        return self.mglo.immutable
+
     @property
     def glo(self) -> int:
         '''
@@ -216,7 +232,7 @@ class Texture3D:
             Read the content of the texture into a buffer.
 
             Args:
-                buffer (bytearray): The buffer that will receive the pixels.
+                buffer (bytearray): The buffer that will receive the pixels. Strided views are filled in place.
 
             Keyword Args:
                 alignment (int): The byte alignment of the pixels.
@@ -233,7 +249,7 @@ class Texture3D:
             Update the content of the texture.
 
             Args:
-                data (bytes): The pixel data.
+                data (bytes): The pixel data. Strided views such as numpy slices are uploaded in place.
                 viewport (tuple): The viewport.
 
             Keyword Args:
@@ -245,6 +261,27 @@ class Texture3D:
 
         self.mglo.write(data, viewport, alignment)
 
+    def write_levels(self, data, *, base=0, levels=-1, alignment=1) -> None:
+        '''
+            Upload a prebuilt mipmap chain with a single call.
+
+            The levels must be tightly packed one after the other in ``data``,
+            starting with the ``base`` level.
+
+            Args:
+                data (bytes): The pixel data of every level.
+
+            Keyword Args:
+                base (int): The first level to write.
+                levels (int): The number of levels to write. Value -1 writes every allocated level from ``base``.
+                alignment (int): The byte alignment of the pixels.
+        '''
+
+        if type(data) is Buffer:
+            data = data.mglo
+
+        self.mglo.write_levels(data, base, levels, alignment)
+
     def build_mipmaps(self, base=0, max_level=1000) -> None:
         '''
             Generate mipmaps.
@@ -272,6 +309,25 @@ class Texture3D:
 
         self.mglo.use(location)
 
+    def bind_to_image(self, unit, read=True, write=True, *, level=0, layer=-1, format=None) -> None:
+        '''
+            Bind a level of the texture to an image unit for image load/store.
+
+            Args:
+                unit (int): The image unit.
+                read (bool): The shaders can read the image.
+                write (bool): The shaders can write the image.
+
+            Keyword Args:
+                level (int): The mipmap level.
+                layer (int): The slice to bind. Value ``-1`` binds all of them.
+                format (str): The image format as a GLSL layout qualifier such as ``'rgba32f'`` or ``'r32ui'``,
+                    or a dtype such as ``'f4'`` with the components of the texture.
+                    By default the internal format of the texture is used.
+        '''
+
+        self.mglo.bind_to_image(unit, read, write, level, layer, format)
+
     def release(self) -> None:
         '''
             Release the ModernGL object.
@@ -198,6 +198,30 @@ class TextureArray:
 
         return self._dtype
 
+    @property
+    def levels(self) -> int:
+        '''
+            int: The number of allocated mipmap levels.
+        '''
+
+        return self.mglo.levels
+
+    @property
+    def immutable(self) -> bool:
+        '''
+            bool: Is the storage of the texture allocated with ``glTexStorage``.
+        '''
+
+        return self.mglo.immutable
+
+    @property
+    def compression(self) -> str:
+        '''
+            str: The block compressed format of the texture or ``None``.
+        '''
+
+        return self.mglo.compression
+
     @property
     def glo(self) -> int:
         '''
@@ -225,7 +249,7 @@ class TextureArray:
             Read the content of the texture array into a buffer.
 
             Args:
-                buffer (bytearray): The buffer that will receive the pixels.
+                buffer (bytearray): The buffer that will receive the pixels. Strided views are filled in place.
 
             Keyword Args:
                 alignment (int): The byte alignment of the pixels.
@@ -242,7 +266,7 @@ class TextureArray:
             Update the content of the texture array.
 
             Args:
-                data (bytes): The pixel data.
+                data (bytes): The pixel data. Strided views such as numpy slices are uploaded in place.
                 viewport (tuple): The viewport.
 
             Keyword Args:
@@ -254,6 +278,86 @@ class TextureArray:
 
         self.mglo.write(data, viewport, alignment)
 
+    def write_compressed(self, data, viewport=None, *, level=0) -> None:
+        '''
+            Update the content of a compressed texture with compressed blocks.
+
+            The viewport must be aligned to the blocks of the format, only the
+            right and bottom edge of the level may contain partial blocks.
+
+            Args:
+                data (bytes): The compressed blocks.
+                viewport (tuple): The viewport.
+
+            Keyword Args:
+                level (int): The mipmap level.
+        '''
+
+        if type(data) is Buffer:
+            data = data.mglo
+
+        self.mglo.write_compressed(data, viewport, level)
+
+    def write_levels(self, data, *, base=0, levels=-1, alignment=1) -> None:
+        '''
+            Upload a prebuilt mipmap chain with a single call.
+
+            The levels must be tightly packed one after the other in ``data``,
+            starting with the ``base`` level. Each level contains every layer.
+
+            Args:
+                data (bytes): The pixel data of every level.
+
+            Keyword Args:
+                base (int): The first level to write.
+                levels (int): The number of levels to write. Value -1 writes every allocated level from ``base``.
+                alignment (int): The byte alignment of the pixels.
+        '''
+
+        if type(data) is Buffer:
+            data = data.mglo
+
+        self.mglo.write_levels(data, base, levels, alignment)
+
+    def view(self, components=None, dtype=None, *, base_level=0, levels=-1, base_layer=0, layers=-1) -> 'TextureArray':
+        '''
+            Create a texture array sharing the storage of this texture array without copying it.
+
+            The view can reinterpret the texels with a different format of the same size
+            and can expose a subset of the mipmap levels and layers. Only immutable textures can be viewed.
+
+            Args:
+                components (int): The number of components of the view. Defaults to the components of the texture.
+                dtype (str): The data type of the view. Defaults to the data type of the texture.
+
+            Keyword Args:
+                base_level (int): The first level of the view.
+                levels (int): The number of levels. Value -1 includes every level from ``base_level``.
+                base_layer (int): The first layer of the view.
+                layers (int): The number of layers. Value -1 includes every layer from ``base_layer``.
+
+            Returns:
+                :py:class:`TextureArray` object
+        '''
+
+        if components is None:
+            components = self._components
+
+        if dtype is None:
+            dtype = self._dtype
+
+        if layers == -1:
+            layers = self._size[2] - base_layer
+
+        res = TextureArray.__new__(TextureArray)
+        res.mglo, res._glo = self.mglo.view(components, dtype, base_level, levels, base_layer, layers)
+        res._size = (max(self._size[0] >> base_level, 1), max(self._size[1] >> base_level, 1), layers)
+        res._components = components
+        res._dtype = dtype
+        res.ctx = self.ctx
+        res.extra = None
+        return res
+
     def build_mipmaps(self, base=0, max_level=1000) -> None:
         '''
             Generate mipmaps.
@@ -281,6 +385,25 @@ class TextureArray:
 
         self.mglo.use(location)
 
+    def bind_to_image(self, unit, read=True, write=True, *, level=0, layer=-1, format=None) -> None:
+        '''
+            Bind a level of the texture array to an image unit for image load/store.
+
+            Args:
+                unit (int): The image unit.
+                read (bool): The shaders can read the image.
+                write (bool): The shaders can write the image.
+
+            Keyword Args:
+                level (int): The mipmap level.
+                layer (int): The layer to bind. Value ``-1`` binds all of them.
+                format (str): The image format as a GLSL layout qualifier such as ``'rgba32f'`` or ``'r32ui'``,
+                    or a dtype such as ``'f4'`` with the components of the texture.
+                    By default the internal format of the texture is used.
+        '''
+
+        self.mglo.bind_to_image(unit, read, write, level, layer, format)
+
     def release(self) -> None:
         '''
             Release the ModernGL object.
@@ -127,6 +127,30 @@ class TextureCube:
     def anisotropy(self, value):
         self.mglo.anisotropy = value
 
+    @property
+    def levels(self) -> int:
+        '''
+            int: The number of allocated mipmap levels.
+        '''
+
+        return self.mglo.levels
+
+    @property
+    def immutable(self) -> bool:
+        '''
+            bool: Is the storage of the texture allocated with ``glTexStorage``.
+        '''
+
+        return self.mglo.immutable
+
+    @property
+    def compression(self) -> str:
+        '''
+            str: The block compressed format of the texture or ``None``.
+        '''
+
+        return self.mglo.compression
+
     @property
     def glo(self) -> int:
         '''
@@ -154,7 +178,7 @@ class TextureCube:
             Read a face from the cubemap texture.
 
             Args:
-                buffer (bytearray): The buffer that will receive the pixels.
+                buffer (bytearray): The buffer that will receive the pixels. Strided views are filled in place.
                 face (int): The face to read.
 
             Keyword Args:
@@ -173,7 +197,7 @@ class TextureCube:
 
             Args:
                 face (int): The face to update.
-                data (bytes): The pixel data.
+                data (bytes): The pixel data. Strided views such as numpy slices are uploaded in place.
                 viewport (tuple): The viewport.
 
             Keyword Args:
@@ -185,6 +209,49 @@ class TextureCube:
 
         self.mglo.write(face, data, viewport, alignment)
 
+    def write_compressed(self, face, data, viewport=None, *, level=0) -> None:
+        '''
+            Update the content of a compressed texture with compressed blocks.
+
+            The viewport must be aligned to the blocks of the format, only the
+            right and bottom edge of the level may contain partial blocks.
+
+            Args:
+                face (int): The face to update.
+                data (bytes): The compressed blocks.
+                viewport (tuple): The viewport.
+
+            Keyword Args:
+                level (int): The mipmap level.
+        '''
+
+        if type(data) is Buffer:
+            data = data.mglo
+
+        self.mglo.write_compressed(face, data, viewport, level)
+
+    def write_levels(self, data, *, base=0, levels=-1, alignment=1) -> None:
+        '''
+            Upload a prebuilt mipmap chain with a single call.
+
+            The levels must be tightly packed one after the other in ``data``,
+            starting with the ``base`` level. Each level contains the six faces
+            in the order ``+X, -X, +Y, -Y, +Z, -Z``.
+
+            Args:
+                data (bytes): The pixel data of every level.
+
+            Keyword Args:
+                base (int): The first level to write.
+                levels (int): The number of levels to write. Value -1 writes every allocated level from ``base``.
+                alignment (int): The byte alignment of the pixels.
+        '''
+
+        if type(data) is Buffer:
+            data = data.mglo
+
+        self.mglo.write_levels(data, base, levels, alignment)
+
     def use(self, location=0) -> None:
         '''
             Bind the cubemap texture.
@@ -198,6 +265,25 @@ class TextureCube:
 
         self.mglo.use(location)
 
+    def bind_to_image(self, unit, read=True, write=True, *, level=0, layer=-1, format=None) -> None:
+        '''
+            Bind a level of the cubemap texture to an image unit for image load/store.
+
+            Args:
+                unit (int): The image unit.
+                read (bool): The shaders can read the image.
+                write (bool): The shaders can write the image.
+
+            Keyword Args:
+                level (int): The mipmap level.
+                layer (int): The face to bind. Value ``-1`` binds all of them.
+                format (str): The image format as a GLSL layout qualifier such as ``'rgba32f'`` or ``'r32ui'``,
+                    or a dtype such as ``'f4'`` with the components of the texture.
+                    By default the internal format of the texture is used.
+        '''
+
+        self.mglo.bind_to_image(unit, read, write, level, layer, format)
+
     def release(self) -> None:
         '''
             Release the ModernGL object.
@@ -0,0 +1,138 @@
+from .block_writer import BlockWriter
+
+__all__ = ['UniformRing']
+
+
+class UniformRing:
+    '''
+        A UniformRing is a uniform buffer divided into equally sized slots
+        for per-draw constants such as object transforms.
+
+        Every slot starts at a multiple of ``GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT``.
+        The data pushed during a frame is uploaded with a single copy before the first draw using it,
+        and :py:meth:`VertexArray.render` binds the range of the requested slot to :py:attr:`binding`.
+
+        Use :py:meth:`Context.uniform_ring` to create one.
+    '''
+
+    __slots__ = ['mglo', '_block_size', '_stride', '_count', '_glo', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None
+        self._block_size = None
+        self._stride = None
+        self._count = None
+        self._glo = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<UniformRing: %d>' % self._glo
+
+    def __len__(self):
+        return self.mglo.used
+
+    @property
+    def block_size(self) -> int:
+        '''
+            int: The size of the data in a single slot.
+        '''
+
+        return self._block_size
+
+    @property
+    def stride(self) -> int:
+        '''
+            int: The distance between two slots, the block size rounded up to the offset alignment.
+        '''
+
+        return self._stride
+
+    @property
+    def count(self) -> int:
+        '''
+            int: The number of slots.
+        '''
+
+        return self._count
+
+    @property
+    def used(self) -> int:
+        '''
+            int: The number of slots pushed since the last :py:meth:`reset`.
+        '''
+
+        return self.mglo.used
+
+    @property
+    def binding(self) -> int:
+        '''
+            int: The uniform buffer binding the slots are bound to.
+        '''
+
+        return self.mglo.binding
+
+    @binding.setter
+    def binding(self, value):
+        self.mglo.binding = value
+
+    @property
+    def glo(self) -> int:
+        '''
+            int: The internal OpenGL object.
+            This values is provided for debug purposes only.
+        '''
+
+        return self._glo
+
+    def push(self, data) -> int:
+        '''
+            Copy the data of a draw into the next free slot.
+
+            Args:
+                data (bytes): The data or a :py:class:`BlockWriter`.
+                              It must not be larger than :py:attr:`block_size`.
+
+            Returns:
+                int: The slot to pass to :py:meth:`VertexArray.render`.
+        '''
+
+        if isinstance(data, BlockWriter):
+            data = data.mglo
+
+        return self.mglo.push(data)
+
+    def commit(self) -> None:
+        '''
+            Upload the slots pushed since the last commit.
+            This happens automatically before rendering with the ring.
+        '''
+
+        self.mglo.commit()
+
+    def reset(self) -> None:
+        '''
+            Start a new frame. The slots are reused from the beginning
+            and the storage of the buffer is orphaned to avoid waiting for the previous frame.
+        '''
+
+        self.mglo.reset()
+
+    def bind(self, slot) -> None:
+        '''
+            Bind the range of a slot to :py:attr:`binding`.
+            Useful for draws that are not issued by a :py:class:`VertexArray`.
+
+            Args:
+                slot (int): The slot.
+        '''
+
+        self.mglo.bind(slot)
+
+    def release(self) -> None:
+        '''
+            Release the ModernGL object.
+        '''
+
+        self.mglo.release()
@@ -1,5 +1,7 @@
 from typing import Tuple
 
+from .indirect_buffer import IndirectBuffer
+
 __all__ = ['VertexArray',
            'POINTS', 'LINES', 'LINE_LOOP', 'LINE_STRIP', 'TRIANGLES', 'TRIANGLE_STRIP', 'TRIANGLE_FAN',
            'LINES_ADJACENCY', 'LINE_STRIP_ADJACENCY', 'TRIANGLES_ADJACENCY', 'TRIANGLE_STRIP_ADJACENCY', 'PATCHES']
@@ -56,6 +58,7 @@ class VertexArray:
         '''
             Program: The program assinged to the VertexArray.
             The program used when rendering or transforming primitives.
+            This is a :py:class:`ProgramPipeline` when the VertexArray was created with one.
         '''
 
         return self._program
@@ -108,7 +111,7 @@ class VertexArray:
 
         return self._glo
 
-    def render(self, mode=None, vertices=-1, *, first=0, instances=1) -> None:
+    def render(self, mode=None, vertices=-1, *, first=0, instances=1, ring=None, slot=0) -> None:
         '''
             The render primitive (mode) must be the same as
             the input primitive of the GeometryShader.
@@ -117,6 +120,28 @@ class VertexArray:
                 mode (int): By default :py:data:`TRIANGLES` will be used.
                 vertices (int): The number of vertices to transform.
 
+            Keyword Args:
+                first (int): The index of the first vertex to start with.
+                instances (int): The number of instances.
+                ring (UniformRing): The ring holding the per-draw uniform data.
+                slot (int): The slot of the ring to bind before the draw.
+        '''
+
+        if mode is None:
+            mode = TRIANGLES
+
+        self.mglo.render(mode, vertices, first, instances, ring.mglo if ring is not None else None, slot)
+
+    def render_ring(self, ring, mode=None, vertices=-1, *, first=0, instances=1) -> None:
+        '''
+            Render once for every used slot of a :py:class:`UniformRing`.
+            Only the uniform buffer range changes between the draws.
+
+            Args:
+                ring (UniformRing): The ring holding the per-draw uniform data.
+                mode (int): By default :py:data:`TRIANGLES` will be used.
+                vertices (int): The number of vertices to transform.
+
             Keyword Args:
                 first (int): The index of the first vertex to start with.
                 instances (int): The number of instances.
@@ -125,28 +150,49 @@ class VertexArray:
         if mode is None:
             mode = TRIANGLES
 
-        self.mglo.render(mode, vertices, first, instances)
+        self.mglo.render_ring(ring.mglo, mode, vertices, first, instances)
 
-    def render_indirect(self, buffer, mode=None, count=-1, *, first=0) -> None:
+    def render_indirect(self, buffer, mode=None, count=-1, *, first=0, count_buffer=None, count_offset=0) -> None:
         '''
             The render primitive (mode) must be the same as
             the input primitive of the GeometryShader.
 
-            The draw commands are 5 integers: (count, instanceCount, firstIndex, baseVertex, baseInstance).
+            The draw commands of vertex arrays with an index buffer are 5 integers:
+            (count, instanceCount, firstIndex, baseVertex, baseInstance).
+            The draw commands of vertex arrays without an index buffer are 4 integers:
+            (count, instanceCount, first, baseInstance).
+            An :py:class:`IndirectBuffer` packs the commands.
 
             Args:
-                buffer (Buffer): Indirect drawing commands.
+                buffer (Buffer): Indirect drawing commands. A :py:class:`Buffer` or an :py:class:`IndirectBuffer`.
                 mode (int): By default :py:data:`TRIANGLES` will be used.
-                count (int): The number of draws.
+                count (int): The number of draws. By default every command in the buffer,
+                             the :py:attr:`IndirectBuffer.count` for an IndirectBuffer.
+                             The maximum number of draws when ``count_buffer`` is set.
 
             Keyword Args:
                 first (int): The index of the first indirect draw command.
+                count_buffer (Buffer): Read the number of draws from this buffer on the GPU.
+                                       Requires OpenGL 4.6 or ``GL_ARB_indirect_parameters``.
+                count_offset (int): The byte offset of the number of draws in the ``count_buffer``.
         '''
 
         if mode is None:
             mode = TRIANGLES
 
-        self.mglo.render_indirect(buffer.mglo, mode, count, first)
+        if isinstance(buffer, IndirectBuffer):
+            if buffer.indexed != (self._index_buffer is not None):
+                raise ValueError('the IndirectBuffer and the VertexArray must be both indexed or both not indexed')
+
+            if count < 0:
+                count = buffer.count - first
+
+            buffer = buffer.buffer
+
+        if count_buffer is not None:
+            count_buffer = count_buffer.mglo
+
+        self.mglo.render_indirect(buffer.mglo, mode, count, first, count_buffer, count_offset)
 
     def transform(self, buffer, mode=None, vertices=-1, *, first=0, instances=1) -> None:
         '''
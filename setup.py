@@ -47,14 +47,14 @@ libraries = {
 
 extra_compile_args = {
     'windows': [],
-    'linux': [],
+    'linux': ['-pthread'],
     'cygwin': [],
     'darwin': ['-Wno-deprecated-declarations'],
 }
 
 extra_linker_args = {
     'windows': [],
-    'linux': [],
+    'linux': ['-pthread'],
     'cygwin': [],
     'darwin': ['-framework', 'OpenGL', '-Wno-deprecated'],
 }
@@ -69,6 +69,8 @@ mgl = Extension(
     sources=[
         'src/Sampler.cpp',
         'src/Attribute.cpp',
+        'src/BlockCompression.cpp',
+        'src/BlockWriter.cpp',
         'src/Buffer.cpp',
         'src/BufferFormat.cpp',
         'src/ComputeShader.cpp',
@@ -78,19 +80,30 @@ mgl = Extension(
         'src/Framebuffer.cpp',
         'src/GLContext.cpp',
         'src/GLMethods.cpp',
+        'src/GLNull.cpp',
+        'src/GLStats.cpp',
+        'src/GLTrace.cpp',
+        'src/ImageBinding.cpp',
+        'src/IndirectBuffer.cpp',
         'src/InvalidObject.cpp',
         'src/ModernGL.cpp',
+        'src/PixelStore.cpp',
         'src/Program.cpp',
+        'src/ProgramPipeline.cpp',
         'src/Query.cpp',
+        'src/QueryPool.cpp',
         'src/Renderbuffer.cpp',
         'src/Scope.cpp',
         'src/Texture.cpp',
         'src/Texture3D.cpp',
         'src/TextureArray.cpp',
         'src/TextureCube.cpp',
+        'src/TextureLoader.cpp',
         'src/Uniform.cpp',
+        'src/UniformBatch.cpp',
         'src/UniformBlock.cpp',
         'src/UniformGetters.cpp',
+        'src/UniformRing.cpp',
         'src/UniformSetters.cpp',
         'src/VertexArray.cpp',
     ],
@@ -65,7 +65,7 @@ void MGLAttribute_Invalidate(MGLAttribute * attribute) {
 	Py_DECREF(attribute);
 }
 
-void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
+void MGLAttribute_Complete(MGLAttribute * self) {
 	switch (self->type) {
 		case GL_INT:
 			self->dimension = 1;
@@ -75,7 +75,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 1;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribIPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribIPointer);
 
 			self->normalizable = false;
 			self->shape = 'i';
@@ -89,7 +89,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 2;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribIPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribIPointer);
 
 			self->normalizable = false;
 			self->shape = 'i';
@@ -103,7 +103,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 3;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribIPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribIPointer);
 
 			self->normalizable = false;
 			self->shape = 'i';
@@ -117,7 +117,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 4;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribIPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribIPointer);
 
 			self->normalizable = false;
 			self->shape = 'i';
@@ -131,7 +131,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 1;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribIPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribIPointer);
 
 			self->normalizable = false;
 			self->shape = 'I';
@@ -145,7 +145,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 2;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribIPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribIPointer);
 
 			self->normalizable = false;
 			self->shape = 'I';
@@ -159,7 +159,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 3;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribIPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribIPointer);
 
 			self->normalizable = false;
 			self->shape = 'I';
@@ -173,7 +173,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 4;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribIPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribIPointer);
 
 			self->normalizable = false;
 			self->shape = 'I';
@@ -187,7 +187,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 1;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -201,7 +201,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 2;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -215,7 +215,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 3;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -229,7 +229,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 4;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -243,7 +243,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 1;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -257,7 +257,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 2;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -271,7 +271,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 3;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -285,7 +285,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 4;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -299,7 +299,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 2;
 			self->row_length = 2;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -313,7 +313,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 2;
 			self->row_length = 3;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -327,7 +327,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 2;
 			self->row_length = 4;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -341,7 +341,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 3;
 			self->row_length = 2;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -355,7 +355,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 3;
 			self->row_length = 3;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -369,7 +369,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 3;
 			self->row_length = 4;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -383,7 +383,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 4;
 			self->row_length = 2;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -397,7 +397,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 4;
 			self->row_length = 3;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -411,7 +411,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 4;
 			self->row_length = 4;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = true;
 			self->shape = 'f';
@@ -425,7 +425,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 2;
 			self->row_length = 2;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -439,7 +439,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 2;
 			self->row_length = 3;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -453,7 +453,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 2;
 			self->row_length = 4;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -467,7 +467,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 3;
 			self->row_length = 2;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -481,7 +481,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 3;
 			self->row_length = 3;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -495,7 +495,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 3;
 			self->row_length = 4;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -509,7 +509,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 4;
 			self->row_length = 2;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -523,7 +523,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 4;
 			self->row_length = 3;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -537,7 +537,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 4;
 			self->row_length = 4;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribLPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribLPointer);
 
 			self->normalizable = false;
 			self->shape = 'd';
@@ -551,7 +551,7 @@ void MGLAttribute_Complete(MGLAttribute * self, const GLMethods & gl) {
 			self->rows_length = self->array_length * 1;
 			self->row_length = 1;
 
-			self->gl_attrib_ptr_proc = (void *)gl.VertexAttribPointer;
+			self->gl_attrib_ptr_method = GL_METHOD_OFFSET(VertexAttribPointer);
 
 			self->normalizable = false;
 			self->shape = 0;
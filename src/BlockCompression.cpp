@@ -0,0 +1,964 @@
+#include "Types.hpp"
+
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BLOCK_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define BLOCK_NEON
+#endif
+
+// CPU encoders for the block compressed formats.
+// Every 4x4 block is encoded independently, the rows of blocks are split between threads.
+// The kernels work on fixed size arrays of 16 pixels so the compilers can vectorize them.
+// The bounds of a block, the nearest palette entries and the index bits use SSE2 or NEON when available,
+// the scalar versions give the same results.
+
+enum BlockFormat {
+	BLOCK_BC1,
+	BLOCK_BC3,
+	BLOCK_BC4,
+	BLOCK_BC5,
+	BLOCK_BC7,
+};
+
+struct BlockJob {
+	const unsigned char * pixels;
+	unsigned char * output;
+
+	int width;
+	int height;
+	int components;
+
+	int format;
+	int quality;
+	int block_size;
+};
+
+static inline int clamp_byte(int value) {
+	return value < 0 ? 0 : (value > 255 ? 255 : value);
+}
+
+static void fetch_block(const BlockJob & job, int bx, int by, unsigned char (* block)[4]) {
+	for (int i = 0; i < 16; ++i) {
+		// Blocks on the right and bottom edge repeat the last column and row.
+
+		int x = bx * 4 + i % 4;
+		int y = by * 4 + i / 4;
+		x = x < job.width ? x : job.width - 1;
+		y = y < job.height ? y : job.height - 1;
+
+		const unsigned char * pixel = job.pixels + (y * job.width + x) * job.components;
+
+		switch (job.components) {
+			case 1:
+				block[i][0] = pixel[0];
+				block[i][1] = pixel[0];
+				block[i][2] = pixel[0];
+				block[i][3] = 255;
+				break;
+
+			case 2:
+				block[i][0] = pixel[0];
+				block[i][1] = pixel[1];
+				block[i][2] = 0;
+				block[i][3] = 255;
+				break;
+
+			case 3:
+				block[i][0] = pixel[0];
+				block[i][1] = pixel[1];
+				block[i][2] = pixel[2];
+				block[i][3] = 255;
+				break;
+
+			default:
+				block[i][0] = pixel[0];
+				block[i][1] = pixel[1];
+				block[i][2] = pixel[2];
+				block[i][3] = pixel[3];
+				break;
+		}
+	}
+}
+
+static void block_bounds(unsigned char (* block)[4], int * min, int * max) {
+#if defined(BLOCK_SSE2)
+	__m128i row0 = _mm_loadu_si128((const __m128i *)block[0]);
+	__m128i row1 = _mm_loadu_si128((const __m128i *)block[4]);
+	__m128i row2 = _mm_loadu_si128((const __m128i *)block[8]);
+	__m128i row3 = _mm_loadu_si128((const __m128i *)block[12]);
+
+	__m128i low = _mm_min_epu8(_mm_min_epu8(row0, row1), _mm_min_epu8(row2, row3));
+	__m128i high = _mm_max_epu8(_mm_max_epu8(row0, row1), _mm_max_epu8(row2, row3));
+	low = _mm_min_epu8(low, _mm_srli_si128(low, 8));
+	high = _mm_max_epu8(high, _mm_srli_si128(high, 8));
+	low = _mm_min_epu8(low, _mm_srli_si128(low, 4));
+	high = _mm_max_epu8(high, _mm_srli_si128(high, 4));
+
+	unsigned low_bytes = (unsigned)_mm_cvtsi128_si32(low);
+	unsigned high_bytes = (unsigned)_mm_cvtsi128_si32(high);
+
+	for (int c = 0; c < 4; ++c) {
+		min[c] = (low_bytes >> (c * 8)) & 0xff;
+		max[c] = (high_bytes >> (c * 8)) & 0xff;
+	}
+#elif defined(BLOCK_NEON)
+	uint8x16x4_t planes = vld4q_u8(block[0]);
+
+	for (int c = 0; c < 4; ++c) {
+		min[c] = vminvq_u8(planes.val[c]);
+		max[c] = vmaxvq_u8(planes.val[c]);
+	}
+#else
+	for (int c = 0; c < 4; ++c) {
+		min[c] = 255;
+		max[c] = 0;
+		for (int i = 0; i < 16; ++i) {
+			min[c] = block[i][c] < min[c] ? block[i][c] : min[c];
+			max[c] = block[i][c] > max[c] ? block[i][c] : max[c];
+		}
+	}
+#endif
+}
+
+// Selects the nearest palette entry for every pixel and returns the sum of the squared distances.
+// The palette entries are in 0-255, ties keep the first entry. Only the first channels are compared.
+
+static int nearest_indices(unsigned char (* block)[4], const int (* palette)[4], int count, int channels, int * indices) {
+#if defined(BLOCK_SSE2)
+	// Two pixels per register with 16 bit channels, the squares of the channel pairs are summed by madd.
+
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i mask = _mm_set1_epi32(channels == 4 ? -1 : 0x00ffffff);
+
+	__m128i pixels[8];
+	__m128i best_error[4];
+	__m128i best_index[4];
+
+	for (int i = 0; i < 4; ++i) {
+		__m128i row = _mm_and_si128(_mm_loadu_si128((const __m128i *)block[i * 4]), mask);
+		pixels[i * 2] = _mm_unpacklo_epi8(row, zero);
+		pixels[i * 2 + 1] = _mm_unpackhi_epi8(row, zero);
+		best_error[i] = _mm_set1_epi32(0x7fffffff);
+		best_index[i] = zero;
+	}
+
+	for (int p = 0; p < count; ++p) {
+		short alpha = channels == 4 ? (short)palette[p][3] : 0;
+		__m128i color = _mm_setr_epi16(
+			(short)palette[p][0], (short)palette[p][1], (short)palette[p][2], alpha,
+			(short)palette[p][0], (short)palette[p][1], (short)palette[p][2], alpha
+		);
+		__m128i index = _mm_set1_epi32(p);
+
+		for (int i = 0; i < 4; ++i) {
+			__m128i d0 = _mm_sub_epi16(pixels[i * 2], color);
+			__m128i d1 = _mm_sub_epi16(pixels[i * 2 + 1], color);
+			__m128 s0 = _mm_castsi128_ps(_mm_madd_epi16(d0, d0));
+			__m128 s1 = _mm_castsi128_ps(_mm_madd_epi16(d1, d1));
+			__m128i even = _mm_castps_si128(_mm_shuffle_ps(s0, s1, _MM_SHUFFLE(2, 0, 2, 0)));
+			__m128i odd = _mm_castps_si128(_mm_shuffle_ps(s0, s1, _MM_SHUFFLE(3, 1, 3, 1)));
+			__m128i error = _mm_add_epi32(even, odd);
+			__m128i closer = _mm_cmplt_epi32(error, best_error[i]);
+			best_error[i] = _mm_or_si128(_mm_and_si128(closer, error), _mm_andnot_si128(closer, best_error[i]));
+			best_index[i] = _mm_or_si128(_mm_and_si128(closer, index), _mm_andnot_si128(closer, best_index[i]));
+		}
+	}
+
+	__m128i total = _mm_add_epi32(_mm_add_epi32(best_error[0], best_error[1]), _mm_add_epi32(best_error[2], best_error[3]));
+	total = _mm_add_epi32(total, _mm_shuffle_epi32(total, _MM_SHUFFLE(1, 0, 3, 2)));
+	total = _mm_add_epi32(total, _mm_shuffle_epi32(total, _MM_SHUFFLE(2, 3, 0, 1)));
+
+	for (int i = 0; i < 4; ++i) {
+		_mm_storeu_si128((__m128i *)(indices + i * 4), best_index[i]);
+	}
+
+	return _mm_cvtsi128_si32(total);
+#elif defined(BLOCK_NEON)
+	// The channels are split into planes, the absolute differences are squared into 16 bits.
+
+	uint8x16x4_t planes = vld4q_u8(block[0]);
+	uint32x4_t best_error[4];
+	uint32x4_t best_index[4];
+
+	if (channels < 4) {
+		planes.val[3] = vdupq_n_u8(0);
+	}
+
+	for (int i = 0; i < 4; ++i) {
+		best_error[i] = vdupq_n_u32(0x7fffffff);
+		best_index[i] = vdupq_n_u32(0);
+	}
+
+	for (int p = 0; p < count; ++p) {
+		uint16x8_t low[4];
+		uint16x8_t high[4];
+
+		for (int c = 0; c < 4; ++c) {
+			uint8x16_t d = vabdq_u8(planes.val[c], vdupq_n_u8(c < channels ? (uint8_t)palette[p][c] : 0));
+			low[c] = vmull_u8(vget_low_u8(d), vget_low_u8(d));
+			high[c] = vmull_u8(vget_high_u8(d), vget_high_u8(d));
+		}
+
+		uint32x4_t error[4];
+		error[0] = vaddq_u32(vaddl_u16(vget_low_u16(low[0]), vget_low_u16(low[1])), vaddl_u16(vget_low_u16(low[2]), vget_low_u16(low[3])));
+		error[1] = vaddq_u32(vaddl_u16(vget_high_u16(low[0]), vget_high_u16(low[1])), vaddl_u16(vget_high_u16(low[2]), vget_high_u16(low[3])));
+		error[2] = vaddq_u32(vaddl_u16(vget_low_u16(high[0]), vget_low_u16(high[1])), vaddl_u16(vget_low_u16(high[2]), vget_low_u16(high[3])));
+		error[3] = vaddq_u32(vaddl_u16(vget_high_u16(high[0]), vget_high_u16(high[1])), vaddl_u16(vget_high_u16(high[2]), vget_high_u16(high[3])));
+
+		uint32x4_t index = vdupq_n_u32(p);
+
+		for (int i = 0; i < 4; ++i) {
+			uint32x4_t closer = vcltq_u32(error[i], best_error[i]);
+			best_error[i] = vbslq_u32(closer, error[i], best_error[i]);
+			best_index[i] = vbslq_u32(closer, index, best_index[i]);
+		}
+	}
+
+	uint32x4_t total = vaddq_u32(vaddq_u32(best_error[0], best_error[1]), vaddq_u32(best_error[2], best_error[3]));
+
+	for (int i = 0; i < 4; ++i) {
+		vst1q_s32(indices + i * 4, vreinterpretq_s32_u32(best_index[i]));
+	}
+
+	return (int)vaddvq_u32(total);
+#else
+	int error = 0;
+
+	for (int i = 0; i < 16; ++i) {
+		int best = 0;
+		int best_error = 0x7fffffff;
+		for (int p = 0; p < count; ++p) {
+			int d = 0;
+			for (int c = 0; c < channels; ++c) {
+				int delta = block[i][c] - palette[p][c];
+				d += delta * delta;
+			}
+			if (d < best_error) {
+				best_error = d;
+				best = p;
+			}
+		}
+		indices[i] = best;
+		error += best_error;
+	}
+
+	return error;
+#endif
+}
+
+// Packs 16 indices of 2 or 4 bits, the first index takes the lowest bits.
+
+static unsigned long long pack_indices(const int * indices, int bits) {
+#if defined(BLOCK_SSE2)
+	__m128i first = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)indices), _mm_loadu_si128((const __m128i *)(indices + 4)));
+	__m128i second = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)(indices + 8)), _mm_loadu_si128((const __m128i *)(indices + 12)));
+	__m128i packed = _mm_packus_epi16(first, second);
+
+	// Every step merges the neighbouring bytes, the odd byte is shifted above the bits of the even byte.
+
+	const __m128i even = _mm_set1_epi16(0xff);
+
+	if (bits == 2) {
+		packed = _mm_or_si128(_mm_and_si128(packed, even), _mm_srli_epi16(packed, 6));
+		packed = _mm_packus_epi16(packed, packed);
+	}
+
+	packed = _mm_or_si128(_mm_and_si128(packed, even), _mm_srli_epi16(packed, 4));
+	packed = _mm_packus_epi16(packed, packed);
+
+	unsigned long long result = 0;
+	_mm_storel_epi64((__m128i *)&result, packed);
+	return bits == 2 ? result & 0xffffffff : result;
+#elif defined(BLOCK_NEON)
+	uint16x8_t first = vcombine_u16(vqmovun_s32(vld1q_s32(indices)), vqmovun_s32(vld1q_s32(indices + 4)));
+	uint16x8_t second = vcombine_u16(vqmovun_s32(vld1q_s32(indices + 8)), vqmovun_s32(vld1q_s32(indices + 12)));
+	uint8x16_t packed = vcombine_u8(vmovn_u16(first), vmovn_u16(second));
+
+	const uint16x8_t even = vdupq_n_u16(0xff);
+
+	if (bits == 2) {
+		uint16x8_t pairs = vreinterpretq_u16_u8(packed);
+		pairs = vorrq_u16(vandq_u16(pairs, even), vshrq_n_u16(pairs, 6));
+		uint8x8_t merged = vmovn_u16(pairs);
+		packed = vcombine_u8(merged, merged);
+	}
+
+	uint16x8_t pairs = vreinterpretq_u16_u8(packed);
+	pairs = vorrq_u16(vandq_u16(pairs, even), vshrq_n_u16(pairs, 4));
+	uint64_t result = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(pairs)), 0);
+	return bits == 2 ? result & 0xffffffff : result;
+#else
+	unsigned long long result = 0;
+
+	for (int i = 0; i < 16; ++i) {
+		result |= (unsigned long long)indices[i] << (i * bits);
+	}
+
+	return result;
+#endif
+}
+
+static void principal_endpoints(unsigned char (* block)[4], int channels, int quality, float * lo, float * hi) {
+	float mean[4] = {};
+
+	for (int i = 0; i < 16; ++i) {
+		for (int c = 0; c < channels; ++c) {
+			mean[c] += block[i][c];
+		}
+	}
+
+	for (int c = 0; c < channels; ++c) {
+		mean[c] /= 16.0f;
+	}
+
+	if (!quality) {
+		// Bounding box of the block, inset by 1/16 of the range.
+		// The channels falling while the widest channel rises take the opposite diagonal.
+
+		int widest = 0;
+		int min[4];
+		int max[4];
+		block_bounds(block, min, max);
+
+		for (int c = 0; c < channels; ++c) {
+			float inset = (max[c] - min[c]) / 16.0f;
+			lo[c] = min[c] + inset;
+			hi[c] = max[c] - inset;
+			widest = hi[c] - lo[c] > hi[widest] - lo[widest] ? c : widest;
+		}
+
+		for (int c = 0; c < channels; ++c) {
+			float correlation = 0.0f;
+			for (int i = 0; i < 16; ++i) {
+				correlation += (block[i][widest] - mean[widest]) * (block[i][c] - mean[c]);
+			}
+			if (correlation < 0.0f) {
+				float temp = lo[c];
+				lo[c] = hi[c];
+				hi[c] = temp;
+			}
+		}
+		return;
+	}
+
+	float cov[4][4] = {};
+
+	for (int i = 0; i < 16; ++i) {
+		float d[4] = {};
+		for (int c = 0; c < channels; ++c) {
+			d[c] = block[i][c] - mean[c];
+		}
+		for (int a = 0; a < channels; ++a) {
+			for (int b = 0; b < channels; ++b) {
+				cov[a][b] += d[a] * d[b];
+			}
+		}
+	}
+
+	// The principal axis is found with a few power iterations.
+
+	float axis[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+
+	for (int iteration = 0; iteration < 8; ++iteration) {
+		float next[4] = {};
+		float length = 0.0f;
+		for (int a = 0; a < channels; ++a) {
+			for (int b = 0; b < channels; ++b) {
+				next[a] += cov[a][b] * axis[b];
+			}
+			length = length > fabsf(next[a]) ? length : fabsf(next[a]);
+		}
+		if (length < 1e-6f) {
+			break;
+		}
+		for (int c = 0; c < channels; ++c) {
+			axis[c] = next[c] / length;
+		}
+	}
+
+	float norm = 0.0f;
+	for (int c = 0; c < channels; ++c) {
+		norm += axis[c] * axis[c];
+	}
+
+	float min = 0.0f;
+	float max = 0.0f;
+
+	if (norm > 1e-6f) {
+		for (int i = 0; i < 16; ++i) {
+			float t = 0.0f;
+			for (int c = 0; c < channels; ++c) {
+				t += (block[i][c] - mean[c]) * axis[c];
+			}
+			t /= norm;
+			min = t < min ? t : min;
+			max = t > max ? t : max;
+		}
+	}
+
+	for (int c = 0; c < channels; ++c) {
+		lo[c] = mean[c] + axis[c] * min;
+		hi[c] = mean[c] + axis[c] * max;
+	}
+}
+
+static void refine_endpoints(unsigned char (* block)[4], int channels, const int * indices, const float * weights, float * lo, float * hi) {
+	// Least squares fit of the endpoints to the selected interpolation weights.
+
+	float aa = 0.0f;
+	float ab = 0.0f;
+	float bb = 0.0f;
+	float ax[4] = {};
+	float bx[4] = {};
+
+	for (int i = 0; i < 16; ++i) {
+		float b = weights[indices[i]];
+		float a = 1.0f - b;
+		aa += a * a;
+		ab += a * b;
+		bb += b * b;
+		for (int c = 0; c < channels; ++c) {
+			ax[c] += a * block[i][c];
+			bx[c] += b * block[i][c];
+		}
+	}
+
+	float det = aa * bb - ab * ab;
+
+	if (fabsf(det) < 1e-6f) {
+		return;
+	}
+
+	for (int c = 0; c < channels; ++c) {
+		lo[c] = (ax[c] * bb - bx[c] * ab) / det;
+		hi[c] = (bx[c] * aa - ax[c] * ab) / det;
+		lo[c] = lo[c] < 0.0f ? 0.0f : (lo[c] > 255.0f ? 255.0f : lo[c]);
+		hi[c] = hi[c] < 0.0f ? 0.0f : (hi[c] > 255.0f ? 255.0f : hi[c]);
+	}
+}
+
+static inline int pack_565(const float * color) {
+	int r = (clamp_byte((int)(color[0] + 0.5f)) * 31 + 127) / 255;
+	int g = (clamp_byte((int)(color[1] + 0.5f)) * 63 + 127) / 255;
+	int b = (clamp_byte((int)(color[2] + 0.5f)) * 31 + 127) / 255;
+	return (r << 11) | (g << 5) | b;
+}
+
+static inline void unpack_565(int color, int * rgb) {
+	int r = (color >> 11) & 31;
+	int g = (color >> 5) & 63;
+	int b = color & 31;
+	rgb[0] = (r << 3) | (r >> 2);
+	rgb[1] = (g << 2) | (g >> 4);
+	rgb[2] = (b << 3) | (b >> 2);
+}
+
+static int select_bc1_indices(unsigned char (* block)[4], int color0, int color1, int * indices) {
+	int palette[4][4] = {};
+	unpack_565(color0, palette[0]);
+	unpack_565(color1, palette[1]);
+
+	for (int c = 0; c < 3; ++c) {
+		palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+		palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+	}
+
+	return nearest_indices(block, palette, 4, 3, indices);
+}
+
+static void encode_bc1(unsigned char (* block)[4], int quality, unsigned char * output) {
+	static const float bc1_weights[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+	float lo[4];
+	float hi[4];
+	principal_endpoints(block, 3, quality, lo, hi);
+
+	int color0 = pack_565(hi);
+	int color1 = pack_565(lo);
+	int indices[16];
+
+	if (color0 < color1) {
+		int temp = color0;
+		color0 = color1;
+		color1 = temp;
+	}
+
+	int error = select_bc1_indices(block, color0, color1, indices);
+
+	for (int iteration = 1; iteration < quality && color0 != color1; ++iteration) {
+		float refined_lo[4] = {lo[0], lo[1], lo[2]};
+		float refined_hi[4] = {hi[0], hi[1], hi[2]};
+		refine_endpoints(block, 3, indices, bc1_weights, refined_hi, refined_lo);
+
+		int refined0 = pack_565(refined_hi);
+		int refined1 = pack_565(refined_lo);
+
+		if (refined0 < refined1) {
+			int temp = refined0;
+			refined0 = refined1;
+			refined1 = temp;
+		}
+
+		if (refined0 == refined1) {
+			break;
+		}
+
+		int refined_indices[16];
+		int refined_error = select_bc1_indices(block, refined0, refined1, refined_indices);
+
+		if (refined_error >= error) {
+			break;
+		}
+
+		color0 = refined0;
+		color1 = refined1;
+		error = refined_error;
+		memcpy(indices, refined_indices, sizeof(indices));
+	}
+
+	unsigned bits = color0 != color1 ? (unsigned)pack_indices(indices, 2) : 0;
+
+	output[0] = color0 & 0xff;
+	output[1] = color0 >> 8;
+	output[2] = color1 & 0xff;
+	output[3] = color1 >> 8;
+	output[4] = bits & 0xff;
+	output[5] = (bits >> 8) & 0xff;
+	output[6] = (bits >> 16) & 0xff;
+	output[7] = bits >> 24;
+}
+
+static int select_bc4_indices(unsigned char (* block)[4], int channel, int value0, int value1, int * indices) {
+	int palette[8];
+	palette[0] = value0;
+	palette[1] = value1;
+
+	if (value0 > value1) {
+		for (int p = 1; p < 7; ++p) {
+			palette[p + 1] = ((7 - p) * value0 + p * value1) / 7;
+		}
+	} else {
+		for (int p = 1; p < 5; ++p) {
+			palette[p + 1] = ((5 - p) * value0 + p * value1) / 5;
+		}
+		palette[6] = 0;
+		palette[7] = 255;
+	}
+
+	int error = 0;
+
+	for (int i = 0; i < 16; ++i) {
+		int best = 0;
+		int best_error = 0x7fffffff;
+		for (int p = 0; p < 8; ++p) {
+			int d = (block[i][channel] - palette[p]) * (block[i][channel] - palette[p]);
+			if (d < best_error) {
+				best_error = d;
+				best = p;
+			}
+		}
+		indices[i] = best;
+		error += best_error;
+	}
+
+	return error;
+}
+
+static void encode_bc4(unsigned char (* block)[4], int channel, int quality, unsigned char * output) {
+	int min = 255;
+	int max = 0;
+
+	for (int i = 0; i < 16; ++i) {
+		min = block[i][channel] < min ? block[i][channel] : min;
+		max = block[i][channel] > max ? block[i][channel] : max;
+	}
+
+	int value0 = max;
+	int value1 = min;
+	int indices[16];
+	int error = select_bc4_indices(block, channel, value0, value1, indices);
+
+	if (quality && error) {
+		// The six value mode has exact 0 and 255, it wins for blocks with a few extreme values.
+
+		int inner_min = 255;
+		int inner_max = 0;
+
+		for (int i = 0; i < 16; ++i) {
+			int value = block[i][channel];
+			if (value != 0 && value != 255) {
+				inner_min = value < inner_min ? value : inner_min;
+				inner_max = value > inner_max ? value : inner_max;
+			}
+		}
+
+		if (inner_min <= inner_max) {
+			int six_indices[16];
+			int six_error = select_bc4_indices(block, channel, inner_min, inner_max, six_indices);
+
+			if (six_error < error) {
+				value0 = inner_min;
+				value1 = inner_max;
+				error = six_error;
+				memcpy(indices, six_indices, sizeof(indices));
+			}
+		}
+	}
+
+	unsigned long long bits = 0;
+
+	for (int i = 0; i < 16; ++i) {
+		bits |= (unsigned long long)indices[i] << (i * 3);
+	}
+
+	output[0] = value0;
+	output[1] = value1;
+
+	for (int i = 0; i < 6; ++i) {
+		output[i + 2] = (bits >> (i * 8)) & 0xff;
+	}
+}
+
+static const int bc7_weights[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+static void quantize_bc7_endpoint(const float * color, int * endpoint, int * pbit) {
+	// Mode 6 stores 7 bits per channel and a shared low bit for each endpoint.
+
+	int best_error = 0x7fffffff;
+
+	for (int p = 0; p < 2; ++p) {
+		int error = 0;
+		int values[4];
+		for (int c = 0; c < 4; ++c) {
+			int q = (int)((color[c] - p) / 2.0f + 0.5f);
+			q = q < 0 ? 0 : (q > 127 ? 127 : q);
+			values[c] = q;
+			int d = (int)(color[c] + 0.5f) - ((q << 1) | p);
+			error += d * d;
+		}
+		if (error < best_error) {
+			best_error = error;
+			memcpy(endpoint, values, sizeof(values));
+			*pbit = p;
+		}
+	}
+}
+
+static int select_bc7_indices(unsigned char (* block)[4], const int * endpoint0, int pbit0, const int * endpoint1, int pbit1, int * indices) {
+	int palette[16][4];
+
+	for (int c = 0; c < 4; ++c) {
+		int e0 = (endpoint0[c] << 1) | pbit0;
+		int e1 = (endpoint1[c] << 1) | pbit1;
+		for (int p = 0; p < 16; ++p) {
+			palette[p][c] = ((64 - bc7_weights[p]) * e0 + bc7_weights[p] * e1 + 32) >> 6;
+		}
+	}
+
+	return nearest_indices(block, palette, 16, 4, indices);
+}
+
+static void encode_bc7(unsigned char (* block)[4], int quality, unsigned char * output) {
+	float weights[16];
+
+	for (int p = 0; p < 16; ++p) {
+		weights[p] = bc7_weights[p] / 64.0f;
+	}
+
+	float lo[4];
+	float hi[4];
+	principal_endpoints(block, 4, quality, lo, hi);
+
+	int endpoint0[4];
+	int endpoint1[4];
+	int pbit0;
+	int pbit1;
+	int indices[16];
+
+	quantize_bc7_endpoint(lo, endpoint0, &pbit0);
+	quantize_bc7_endpoint(hi, endpoint1, &pbit1);
+
+	int error = select_bc7_indices(block, endpoint0, pbit0, endpoint1, pbit1, indices);
+
+	for (int iteration = 1; iteration < quality && error; ++iteration) {
+		float refined_lo[4];
+		float refined_hi[4];
+		memcpy(refined_lo, lo, sizeof(lo));
+		memcpy(refined_hi, hi, sizeof(hi));
+		refine_endpoints(block, 4, indices, weights, refined_lo, refined_hi);
+
+		int refined0[4];
+		int refined1[4];
+		int refined_pbit0;
+		int refined_pbit1;
+		int refined_indices[16];
+
+		quantize_bc7_endpoint(refined_lo, refined0, &refined_pbit0);
+		quantize_bc7_endpoint(refined_hi, refined1, &refined_pbit1);
+
+		int refined_error = select_bc7_indices(block, refined0, refined_pbit0, refined1, refined_pbit1, refined_indices);
+
+		if (refined_error >= error) {
+			break;
+		}
+
+		memcpy(lo, refined_lo, sizeof(lo));
+		memcpy(hi, refined_hi, sizeof(hi));
+		memcpy(endpoint0, refined0, sizeof(endpoint0));
+		memcpy(endpoint1, refined1, sizeof(endpoint1));
+		memcpy(indices, refined_indices, sizeof(indices));
+		pbit0 = refined_pbit0;
+		pbit1 = refined_pbit1;
+		error = refined_error;
+	}
+
+	// The most significant bit of the first index is implicit zero.
+
+	if (indices[0] & 8) {
+		for (int c = 0; c < 4; ++c) {
+			int temp = endpoint0[c];
+			endpoint0[c] = endpoint1[c];
+			endpoint1[c] = temp;
+		}
+
+		int temp = pbit0;
+		pbit0 = pbit1;
+		pbit1 = temp;
+
+		for (int i = 0; i < 16; ++i) {
+			indices[i] = 15 - indices[i];
+		}
+	}
+
+	unsigned long long low = 1 << 6;
+	int position = 7;
+
+	for (int c = 0; c < 4; ++c) {
+		low |= (unsigned long long)endpoint0[c] << position;
+		position += 7;
+		low |= (unsigned long long)endpoint1[c] << position;
+		position += 7;
+	}
+
+	low |= (unsigned long long)pbit0 << 63;
+
+	// The first index has 3 bits after the p-bit, the other indices stay at their nibbles.
+
+	unsigned long long nibbles = pack_indices(indices, 4);
+	unsigned long long high = pbit1 | ((nibbles & 7) << 1) | (nibbles & ~15ull);
+
+	for (int i = 0; i < 8; ++i) {
+		output[i] = (low >> (i * 8)) & 0xff;
+		output[i + 8] = (high >> (i * 8)) & 0xff;
+	}
+}
+
+static void encode_rows(const BlockJob * job, int first_row, int last_row) {
+	int blocks_x = (job->width + 3) / 4;
+
+	unsigned char block[16][4];
+
+	for (int by = first_row; by < last_row; ++by) {
+		for (int bx = 0; bx < blocks_x; ++bx) {
+			unsigned char * output = job->output + (by * blocks_x + bx) * job->block_size;
+
+			fetch_block(*job, bx, by, block);
+
+			switch (job->format) {
+				case BLOCK_BC1:
+					encode_bc1(block, job->quality, output);
+					break;
+
+				case BLOCK_BC3:
+					encode_bc4(block, 3, job->quality, output);
+					encode_bc1(block, job->quality, output + 8);
+					break;
+
+				case BLOCK_BC4:
+					encode_bc4(block, 0, job->quality, output);
+					break;
+
+				case BLOCK_BC5:
+					encode_bc4(block, 0, job->quality, output);
+					encode_bc4(block, 1, job->quality, output + 8);
+					break;
+
+				case BLOCK_BC7:
+					encode_bc7(block, job->quality, output);
+					break;
+			}
+		}
+	}
+}
+
+static void encode_blocks(const BlockJob & job, int threads) {
+	int blocks_y = (job.height + 3) / 4;
+
+	if (threads <= 0) {
+		threads = (int)std::thread::hardware_concurrency();
+	}
+
+	threads = threads < blocks_y ? threads : blocks_y;
+
+	if (threads <= 1) {
+		encode_rows(&job, 0, blocks_y);
+		return;
+	}
+
+	std::vector<std::thread> workers;
+
+	for (int i = 0; i < threads; ++i) {
+		int first_row = blocks_y * i / threads;
+		int last_row = blocks_y * (i + 1) / threads;
+		workers.push_back(std::thread(encode_rows, &job, first_row, last_row));
+	}
+
+	for (int i = 0; i < threads; ++i) {
+		workers[i].join();
+	}
+}
+
+PyObject * compress_texture(PyObject * self, PyObject * args) {
+	PyObject * data;
+	int width;
+	int height;
+	const char * format;
+	int quality;
+	int components;
+	PyObject * output;
+	int offset;
+	int threads;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O(II)sIIOIi",
+		&data,
+		&width,
+		&height,
+		&format,
+		&quality,
+		&components,
+		&output,
+		&offset,
+		&threads
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	BlockJob job;
+
+	if (!strcmp(format, "bc1")) {
+		job.format = BLOCK_BC1;
+		job.block_size = 8;
+	} else if (!strcmp(format, "bc3")) {
+		job.format = BLOCK_BC3;
+		job.block_size = 16;
+	} else if (!strcmp(format, "bc4")) {
+		job.format = BLOCK_BC4;
+		job.block_size = 8;
+	} else if (!strcmp(format, "bc5")) {
+		job.format = BLOCK_BC5;
+		job.block_size = 16;
+	} else if (!strcmp(format, "bc7")) {
+		job.format = BLOCK_BC7;
+		job.block_size = 16;
+	} else {
+		MGLError_Set("invalid format: %s", format);
+		return 0;
+	}
+
+	if (components < 1 || components > 4) {
+		MGLError_Set("the components must be 1, 2, 3 or 4");
+		return 0;
+	}
+
+	if (quality > 3) {
+		MGLError_Set("the quality must be 0, 1, 2 or 3");
+		return 0;
+	}
+
+	if (!width || !height) {
+		MGLError_Set("the size must be greater than zero");
+		return 0;
+	}
+
+	int expected_size = width * height * components;
+	int compressed_size = (width + 3) / 4 * ((height + 3) / 4) * job.block_size;
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+	if (get_buffer < 0) {
+		MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+		return 0;
+	}
+
+	if (buffer_view.len != expected_size) {
+		MGLError_Set("data size mismatch %d != %d", (int)buffer_view.len, expected_size);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	job.pixels = (const unsigned char *)buffer_view.buf;
+	job.width = width;
+	job.height = height;
+	job.components = components;
+	job.quality = quality;
+
+	if (output == Py_None) {
+		PyObject * result = PyBytes_FromStringAndSize(0, compressed_size);
+		job.output = (unsigned char *)PyBytes_AS_STRING(result);
+
+		Py_BEGIN_ALLOW_THREADS
+		encode_blocks(job, threads);
+		Py_END_ALLOW_THREADS
+
+		PyBuffer_Release(&buffer_view);
+		return result;
+	}
+
+	if (Py_TYPE(output) != &MGLBuffer_Type) {
+		MGLError_Set("the buffer must be a Buffer not %s", Py_TYPE(output)->tp_name);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	MGLBuffer * buffer = (MGLBuffer *)output;
+
+	if (offset < 0 || offset + compressed_size > buffer->size) {
+		MGLError_Set("out of range offset = %d or size = %d", offset, compressed_size);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	// The blocks are encoded straight into the mapped buffer, no intermediate copy is made.
+
+	const GLMethods & gl = buffer->context->gl;
+
+	gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
+	void * map = gl.MapBufferRange(GL_ARRAY_BUFFER, offset, compressed_size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+
+	if (!map) {
+		MGLError_Set("cannot map the buffer");
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	job.output = (unsigned char *)map;
+
+	Py_BEGIN_ALLOW_THREADS
+	encode_blocks(job, threads);
+	Py_END_ALLOW_THREADS
+
+	gl.UnmapBuffer(GL_ARRAY_BUFFER);
+
+	PyBuffer_Release(&buffer_view);
+	Py_RETURN_NONE;
+}
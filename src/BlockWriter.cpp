@@ -0,0 +1,393 @@
+#include "Types.hpp"
+
+#include "InlineMethods.hpp"
+
+inline void MGLBlockMember_set(MGLBlockMember * member, char shape, int scalar_size, int columns, int rows) {
+	member->shape = shape;
+	member->scalar_size = scalar_size;
+	member->columns = columns;
+	member->rows = rows;
+}
+
+bool MGLBlockMember_Complete(MGLBlockMember * member) {
+	switch (member->type) {
+		case GL_BOOL: MGLBlockMember_set(member, '?', 4, 1, 1); break;
+		case GL_BOOL_VEC2: MGLBlockMember_set(member, '?', 4, 1, 2); break;
+		case GL_BOOL_VEC3: MGLBlockMember_set(member, '?', 4, 1, 3); break;
+		case GL_BOOL_VEC4: MGLBlockMember_set(member, '?', 4, 1, 4); break;
+		case GL_INT: MGLBlockMember_set(member, 'i', 4, 1, 1); break;
+		case GL_INT_VEC2: MGLBlockMember_set(member, 'i', 4, 1, 2); break;
+		case GL_INT_VEC3: MGLBlockMember_set(member, 'i', 4, 1, 3); break;
+		case GL_INT_VEC4: MGLBlockMember_set(member, 'i', 4, 1, 4); break;
+		case GL_UNSIGNED_INT: MGLBlockMember_set(member, 'I', 4, 1, 1); break;
+		case GL_UNSIGNED_INT_VEC2: MGLBlockMember_set(member, 'I', 4, 1, 2); break;
+		case GL_UNSIGNED_INT_VEC3: MGLBlockMember_set(member, 'I', 4, 1, 3); break;
+		case GL_UNSIGNED_INT_VEC4: MGLBlockMember_set(member, 'I', 4, 1, 4); break;
+		case GL_FLOAT: MGLBlockMember_set(member, 'f', 4, 1, 1); break;
+		case GL_FLOAT_VEC2: MGLBlockMember_set(member, 'f', 4, 1, 2); break;
+		case GL_FLOAT_VEC3: MGLBlockMember_set(member, 'f', 4, 1, 3); break;
+		case GL_FLOAT_VEC4: MGLBlockMember_set(member, 'f', 4, 1, 4); break;
+		case GL_DOUBLE: MGLBlockMember_set(member, 'd', 8, 1, 1); break;
+		case GL_DOUBLE_VEC2: MGLBlockMember_set(member, 'd', 8, 1, 2); break;
+		case GL_DOUBLE_VEC3: MGLBlockMember_set(member, 'd', 8, 1, 3); break;
+		case GL_DOUBLE_VEC4: MGLBlockMember_set(member, 'd', 8, 1, 4); break;
+		case GL_FLOAT_MAT2: MGLBlockMember_set(member, 'f', 4, 2, 2); break;
+		case GL_FLOAT_MAT2x3: MGLBlockMember_set(member, 'f', 4, 2, 3); break;
+		case GL_FLOAT_MAT2x4: MGLBlockMember_set(member, 'f', 4, 2, 4); break;
+		case GL_FLOAT_MAT3x2: MGLBlockMember_set(member, 'f', 4, 3, 2); break;
+		case GL_FLOAT_MAT3: MGLBlockMember_set(member, 'f', 4, 3, 3); break;
+		case GL_FLOAT_MAT3x4: MGLBlockMember_set(member, 'f', 4, 3, 4); break;
+		case GL_FLOAT_MAT4x2: MGLBlockMember_set(member, 'f', 4, 4, 2); break;
+		case GL_FLOAT_MAT4x3: MGLBlockMember_set(member, 'f', 4, 4, 3); break;
+		case GL_FLOAT_MAT4: MGLBlockMember_set(member, 'f', 4, 4, 4); break;
+		case GL_DOUBLE_MAT2: MGLBlockMember_set(member, 'd', 8, 2, 2); break;
+		case GL_DOUBLE_MAT2x3: MGLBlockMember_set(member, 'd', 8, 2, 3); break;
+		case GL_DOUBLE_MAT2x4: MGLBlockMember_set(member, 'd', 8, 2, 4); break;
+		case GL_DOUBLE_MAT3x2: MGLBlockMember_set(member, 'd', 8, 3, 2); break;
+		case GL_DOUBLE_MAT3: MGLBlockMember_set(member, 'd', 8, 3, 3); break;
+		case GL_DOUBLE_MAT3x4: MGLBlockMember_set(member, 'd', 8, 3, 4); break;
+		case GL_DOUBLE_MAT4x2: MGLBlockMember_set(member, 'd', 8, 4, 2); break;
+		case GL_DOUBLE_MAT4x3: MGLBlockMember_set(member, 'd', 8, 4, 3); break;
+		case GL_DOUBLE_MAT4: MGLBlockMember_set(member, 'd', 8, 4, 4); break;
+
+		default:
+			MGLBlockMember_set(member, '?', 4, 0, 0);
+			return false;
+	}
+
+	return true;
+}
+
+PyObject * MGLUniformBlock_writer(MGLUniformBlock * self, PyObject * args) {
+	int runtime_length;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"I",
+		&runtime_length
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLBlockWriter * writer = (MGLBlockWriter *)MGLBlockWriter_Type.tp_alloc(&MGLBlockWriter_Type, 0);
+
+	PyObject * names = 0;
+	writer->num_members = MGLUniformBlock_Members(self, &writer->members, &names);
+	writer->names = PyDict_New();
+	writer->size = self->size;
+
+	for (int i = 0; i < writer->num_members; ++i) {
+		MGLBlockMember & member = writer->members[i];
+
+		// The last member of a shader storage block can be an array without a size.
+
+		if (!member.array_length) {
+			member.array_length = runtime_length;
+			writer->size = max(writer->size, member.offset + member.array_length * member.array_stride);
+		}
+
+		PyObject * index = PyLong_FromLong(i);
+		PyDict_SetItem(writer->names, PyTuple_GET_ITEM(names, i), index);
+		Py_DECREF(index);
+	}
+
+	Py_DECREF(names);
+
+	writer->data = new char[writer->size]();
+
+	PyObject * result = PyTuple_New(2);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)writer);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(writer->size));
+	return result;
+}
+
+PyObject * MGLBlockWriter_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLBlockWriter * self = (MGLBlockWriter *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLBlockWriter_tp_dealloc(MGLBlockWriter * self) {
+	delete[] self->members;
+	delete[] self->data;
+	Py_XDECREF(self->names);
+
+	MGLBlockWriter_Type.tp_free((PyObject *)self);
+}
+
+int MGLBlockWriter_flatten(MGLBlockMember * member, PyObject * value, char * ptr, int capacity, int & count) {
+	if (PySequence_Check(value) && !PyUnicode_Check(value)) {
+		PyObject * seq = PySequence_Fast(value, "not iterable");
+		int size = (int)PySequence_Fast_GET_SIZE(seq);
+
+		for (int i = 0; i < size; ++i) {
+			if (MGLBlockWriter_flatten(member, PySequence_Fast_GET_ITEM(seq, i), ptr, capacity, count) < 0) {
+				Py_DECREF(seq);
+				return -1;
+			}
+		}
+
+		Py_DECREF(seq);
+		return 0;
+	}
+
+	if (count == capacity) {
+		MGLError_Set("too many values");
+		return -1;
+	}
+
+	char * dst = ptr + count * member->scalar_size;
+
+	switch (member->shape) {
+		case 'f':
+			*(float *)dst = (float)PyFloat_AsDouble(value);
+			break;
+
+		case 'd':
+			*(double *)dst = PyFloat_AsDouble(value);
+			break;
+
+		case 'i':
+			*(int *)dst = PyLong_AsLong(value);
+			break;
+
+		case 'I':
+			*(unsigned *)dst = PyLong_AsUnsignedLong(value);
+			break;
+
+		case '?':
+			*(int *)dst = PyObject_IsTrue(value);
+			break;
+	}
+
+	if (PyErr_Occurred()) {
+		MGLError_Set("invalid values");
+		return -1;
+	}
+
+	count += 1;
+	return 0;
+}
+
+int MGLBlockWriter_pack(MGLBlockWriter * self, MGLBlockMember * member, PyObject * value) {
+	if (!member->columns) {
+		MGLError_Set("the type of the member is not supported");
+		return -1;
+	}
+
+	int element_count = member->columns * member->rows;
+	int capacity = max(member->array_length, 1) * element_count;
+	int count = 0;
+
+	char * tight = new char[capacity * member->scalar_size];
+
+	if (PyObject_CheckBuffer(value)) {
+		Py_buffer buffer_view;
+
+		if (PyObject_GetBuffer(value, &buffer_view, PyBUF_SIMPLE) < 0) {
+			delete[] tight;
+			return -1;
+		}
+
+		if (buffer_view.len > capacity * member->scalar_size || buffer_view.len % (element_count * member->scalar_size)) {
+			MGLError_Set("data size mismatch %d != %d", (int)buffer_view.len, capacity * member->scalar_size);
+			PyBuffer_Release(&buffer_view);
+			delete[] tight;
+			return -1;
+		}
+
+		memcpy(tight, buffer_view.buf, buffer_view.len);
+		count = (int)(buffer_view.len / member->scalar_size);
+		PyBuffer_Release(&buffer_view);
+
+	} else {
+		if (MGLBlockWriter_flatten(member, value, tight, capacity, count) < 0) {
+			delete[] tight;
+			return -1;
+		}
+
+		if (!count || count % element_count) {
+			MGLError_Set("the number of values must be a multiple of %d not %d", element_count, count);
+			delete[] tight;
+			return -1;
+		}
+	}
+
+	// The input is tightly packed with column major matrices.
+	// Every element and every column is placed at the stride reported by the driver.
+
+	int num_elements = count / element_count;
+	char * src = tight;
+
+	for (int i = 0; i < num_elements; ++i) {
+		char * base = self->data + member->offset + i * member->array_stride;
+
+		for (int c = 0; c < member->columns; ++c) {
+			for (int r = 0; r < member->rows; ++r) {
+				char * dst = base;
+
+				if (member->columns > 1 && member->row_major) {
+					dst += r * member->matrix_stride + c * member->scalar_size;
+				} else {
+					dst += c * member->matrix_stride + r * member->scalar_size;
+				}
+
+				memcpy(dst, src, member->scalar_size);
+				src += member->scalar_size;
+			}
+		}
+	}
+
+	delete[] tight;
+	return 0;
+}
+
+MGLBlockMember * MGLBlockWriter_find(MGLBlockWriter * self, PyObject * name) {
+	PyObject * index = PyDict_GetItem(self->names, name);
+
+	if (!index) {
+		MGLError_Set("%S is not a member of the block", name);
+		return 0;
+	}
+
+	return self->members + PyLong_AsLong(index);
+}
+
+PyObject * MGLBlockWriter_set(MGLBlockWriter * self, PyObject * args) {
+	PyObject * name;
+	PyObject * value;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OO",
+		&name,
+		&value
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLBlockMember * member = MGLBlockWriter_find(self, name);
+
+	if (!member || MGLBlockWriter_pack(self, member, value) < 0) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLBlockWriter_update(MGLBlockWriter * self, PyObject * args) {
+	PyObject * values;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!",
+		&PyDict_Type,
+		&values
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	PyObject * name;
+	PyObject * value;
+	Py_ssize_t pos = 0;
+
+	while (PyDict_Next(values, &pos, &name, &value)) {
+		MGLBlockMember * member = MGLBlockWriter_find(self, name);
+
+		if (!member || MGLBlockWriter_pack(self, member, value) < 0) {
+			return 0;
+		}
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLBlockWriter_write_to(MGLBlockWriter * self, PyObject * args) {
+	MGLBuffer * buffer;
+	Py_ssize_t offset;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!n",
+		&MGLBuffer_Type,
+		&buffer,
+		&offset
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (offset < 0 || offset + self->size > buffer->size) {
+		MGLError_Set("out of range offset = %d or size = %d", (int)offset, self->size);
+		return 0;
+	}
+
+	const GLMethods & gl = buffer->context->gl;
+
+	gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
+	gl.BufferSubData(GL_ARRAY_BUFFER, (GLintptr)offset, self->size, self->data);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLBlockWriter_read(MGLBlockWriter * self) {
+	return PyBytes_FromStringAndSize(self->data, self->size);
+}
+
+PyMethodDef MGLBlockWriter_tp_methods[] = {
+	{"set", (PyCFunction)MGLBlockWriter_set, METH_VARARGS, 0},
+	{"update", (PyCFunction)MGLBlockWriter_update, METH_VARARGS, 0},
+	{"write_to", (PyCFunction)MGLBlockWriter_write_to, METH_VARARGS, 0},
+	{"read", (PyCFunction)MGLBlockWriter_read, METH_NOARGS, 0},
+	{0},
+};
+
+PyTypeObject MGLBlockWriter_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.BlockWriter",                                      // tp_name
+	sizeof(MGLBlockWriter),                                 // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLBlockWriter_tp_dealloc,                  // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLBlockWriter_tp_methods,                              // tp_methods
+	0,                                                      // tp_members
+	0,                                                      // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLBlockWriter_tp_new,                                  // tp_new
+};
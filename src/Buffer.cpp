@@ -539,6 +539,44 @@ PyObject * MGLBuffer_bind_to_storage_buffer(MGLBuffer * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLBuffer_bind_to_atomic_counter(MGLBuffer * self, PyObject * args) {
+	int binding;
+	Py_ssize_t offset;
+	Py_ssize_t size;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"Inn",
+		&binding,
+		&offset,
+		&size
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (self->context->version_code < 420) {
+		MGLError_Set("atomic counters require OpenGL 4.2");
+		return 0;
+	}
+
+	if (size < 0) {
+		size = self->size - offset;
+	}
+
+	// Atomic counters are 4 byte aligned unsigned integers.
+
+	if (offset < 0 || offset % 4 || offset + size > self->size) {
+		MGLError_Set("invalid atomic counter range offset=%d size=%d", (int)offset, (int)size);
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+	gl.BindBufferRange(GL_ATOMIC_COUNTER_BUFFER, binding, self->buffer_obj, offset, size);
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLBuffer_release(MGLBuffer * self) {
 	MGLBuffer_Invalidate(self);
 	Py_RETURN_NONE;
@@ -555,6 +593,7 @@ PyMethodDef MGLBuffer_tp_methods[] = {
 	{"orphan", (PyCFunction)MGLBuffer_orphan, METH_NOARGS, 0},
 	{"bind_to_uniform_block", (PyCFunction)MGLBuffer_bind_to_uniform_block, METH_VARARGS, 0},
 	{"bind_to_storage_buffer", (PyCFunction)MGLBuffer_bind_to_storage_buffer, METH_VARARGS, 0},
+	{"bind_to_atomic_counter", (PyCFunction)MGLBuffer_bind_to_atomic_counter, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLBuffer_release, METH_NOARGS, 0},
 	{0},
 };
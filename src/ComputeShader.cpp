@@ -132,7 +132,7 @@ PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args) {
 		mglo->location = location;
 		mglo->array_length = array_length;
 		mglo->program_obj = program_obj;
-		MGLUniform_Complete(mglo, gl);
+		MGLUniform_Complete(mglo);
 
 		PyObject * item = PyTuple_New(5);
 		PyTuple_SET_ITEM(item, 0, (PyObject *)mglo);
@@ -149,6 +149,8 @@ PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args) {
 		_PyTuple_Resize(&uniforms_lst, uniform_counter);
 	}
 
+	MGLUniformShadow_Initialize(&compute_shader->uniform_shadow, uniforms_lst, gl);
+
 	for (int i = 0; i < num_uniform_blocks; ++i) {
 		int size = 0;
 		int name_len = 0;
@@ -162,6 +164,7 @@ PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args) {
 
 		MGLUniformBlock * mglo = (MGLUniformBlock *)MGLUniformBlock_Type.tp_alloc(&MGLUniformBlock_Type, 0);
 
+		mglo->interface = GL_UNIFORM_BLOCK;
 		mglo->index = index;
 		mglo->size = size;
 		mglo->program_obj = program_obj;
@@ -176,6 +179,14 @@ PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args) {
 		PyTuple_SET_ITEM(uniform_blocks_lst, i, item);
 	}
 
+	PyObject * storage_blocks_lst = 0;
+
+	if (self->version_code >= 430) {
+		storage_blocks_lst = MGLUniformBlock_StorageBlocks(gl, program_obj);
+	} else {
+		storage_blocks_lst = PyTuple_New(0);
+	}
+
 	int subroutine_uniforms_base = 0;
 	int subroutines_base = 0;
 
@@ -222,13 +233,18 @@ PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args) {
 		}
 	}
 
-	PyObject * result = PyTuple_New(6);
+	int group_size[3] = {};
+	gl.GetProgramiv(program_obj, GL_COMPUTE_WORK_GROUP_SIZE, group_size);
+
+	PyObject * result = PyTuple_New(8);
 	PyTuple_SET_ITEM(result, 0, (PyObject *)compute_shader);
 	PyTuple_SET_ITEM(result, 1, uniforms_lst);
 	PyTuple_SET_ITEM(result, 2, uniform_blocks_lst);
-	PyTuple_SET_ITEM(result, 3, subroutines_lst);
-	PyTuple_SET_ITEM(result, 4, subroutine_uniforms_lst);
-	PyTuple_SET_ITEM(result, 5, PyLong_FromLong(compute_shader->program_obj));
+	PyTuple_SET_ITEM(result, 3, storage_blocks_lst);
+	PyTuple_SET_ITEM(result, 4, subroutines_lst);
+	PyTuple_SET_ITEM(result, 5, subroutine_uniforms_lst);
+	PyTuple_SET_ITEM(result, 6, PyLong_FromLong(compute_shader->program_obj));
+	PyTuple_SET_ITEM(result, 7, tuple3(PyLong_FromLong(group_size[0]), PyLong_FromLong(group_size[1]), PyLong_FromLong(group_size[2])));
 	return result;
 }
 
@@ -242,9 +258,15 @@ PyObject * MGLComputeShader_tp_new(PyTypeObject * type, PyObject * args, PyObjec
 }
 
 void MGLComputeShader_tp_dealloc(MGLComputeShader * self) {
+	MGLUniformShadow_Release(&self->uniform_shadow);
 	Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
+PyObject * MGLComputeShader_release(MGLComputeShader * self) {
+	MGLComputeShader_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLComputeShader_run(MGLComputeShader * self, PyObject * args) {
 	unsigned x;
 	unsigned y;
@@ -264,15 +286,65 @@ PyObject * MGLComputeShader_run(MGLComputeShader * self, PyObject * args) {
 
 	const GLMethods & gl = self->context->gl;
 
+	MGLUniformShadow_Flush(&self->uniform_shadow, gl);
+
 	gl.UseProgram(self->program_obj);
 	gl.DispatchCompute(x, y, z);
 
+	if (self->context->compute_barrier) {
+		gl.MemoryBarrier(self->context->compute_barrier);
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLComputeShader_run_indirect(MGLComputeShader * self, PyObject * args) {
+	MGLBuffer * buffer;
+	Py_ssize_t offset;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!n",
+		&MGLBuffer_Type,
+		&buffer,
+		&offset
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	// The command is three unsigned integers: the number of work groups in each dimension.
+
+	if (offset < 0 || offset % 4) {
+		MGLError_Set("the offset must be a non-negative multiple of 4");
+		return 0;
+	}
+
+	if (offset + 12 > buffer->size) {
+		MGLError_Set("the dispatch command at offset %d does not fit in the buffer", (int)offset);
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	MGLUniformShadow_Flush(&self->uniform_shadow, gl);
+
+	gl.UseProgram(self->program_obj);
+	gl.BindBuffer(GL_DISPATCH_INDIRECT_BUFFER, buffer->buffer_obj);
+	gl.DispatchComputeIndirect((GLintptr)offset);
+
+	if (self->context->compute_barrier) {
+		gl.MemoryBarrier(self->context->compute_barrier);
+	}
+
 	Py_RETURN_NONE;
 }
 
 PyMethodDef MGLComputeShader_tp_methods[] = {
 	{"run", (PyCFunction)MGLComputeShader_run, METH_VARARGS, 0},
-	// // {"release", (PyCFunction)MGLComputeShader_release, METH_VARARGS, 0},
+	{"run_indirect", (PyCFunction)MGLComputeShader_run_indirect, METH_VARARGS, 0},
+	{"release", (PyCFunction)MGLComputeShader_release, METH_NOARGS, 0},
 	{0},
 };
 
@@ -320,3 +392,18 @@ PyTypeObject MGLComputeShader_Type = {
 	0,                                                      // tp_alloc
 	MGLComputeShader_tp_new,                                // tp_new
 };
+
+void MGLComputeShader_Invalidate(MGLComputeShader * compute_shader) {
+	if (Py_TYPE(compute_shader) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	MGLUniformShadow_Release(&compute_shader->uniform_shadow);
+
+	const GLMethods & gl = compute_shader->context->gl;
+	gl.DeleteProgram(compute_shader->program_obj);
+
+	// The compute shader holds no extra reference, it is freed with its last Python reference
+
+	Py_TYPE(compute_shader) = &MGLInvalidObject_Type;
+}
@@ -13,6 +13,8 @@ PyObject * MGLContext_tp_new(PyTypeObject * type, PyObject * args, PyObject * kw
 }
 
 void MGLContext_tp_dealloc(MGLContext * self) {
+	MGLContext_ReleaseStats(self);
+	MGLContext_EndTrace(self);
 	MGLContext_Type.tp_free((PyObject *)self);
 }
 
@@ -131,6 +133,39 @@ PyObject * MGLContext_finish(MGLContext * self) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLContext_memory_barrier(MGLContext * self, PyObject * args) {
+	unsigned barriers;
+	int by_region;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"Ip",
+		&barriers,
+		&by_region
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (self->version_code < 420) {
+		MGLError_Set("memory barriers require OpenGL 4.2");
+		return 0;
+	}
+
+	if (by_region) {
+		if (self->version_code < 450) {
+			MGLError_Set("memory barriers by region require OpenGL 4.5");
+			return 0;
+		}
+		self->gl.MemoryBarrierByRegion(barriers);
+	} else {
+		self->gl.MemoryBarrier(barriers);
+	}
+
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLContext_copy_buffer(MGLContext * self, PyObject * args) {
 	MGLBuffer * dst;
 	MGLBuffer * src;
@@ -274,6 +309,204 @@ PyObject * MGLContext_copy_framebuffer(MGLContext * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+struct MGLCopyImage {
+	int texture_obj;
+	int target;
+	int width;
+	int height;
+	int depth;
+	int levels;
+	int samples;
+	int texel_size;
+	bool layered;
+	MGLCompressedFormat * compression;
+	MGLContext * context;
+};
+
+static bool copy_image_from_texture(PyObject * texture, const char * name, MGLCopyImage & image) {
+	// Array layers and cube faces keep their count on every level, the depth of 3D textures is halved.
+
+	if (Py_TYPE(texture) == &MGLTexture_Type) {
+		MGLTexture * tex = (MGLTexture *)texture;
+		image = {tex->texture_obj, tex->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D, tex->width, tex->height, 1, tex->levels, tex->samples, tex->components * tex->data_type->size, true, tex->compression, tex->context};
+	} else if (Py_TYPE(texture) == &MGLTextureArray_Type) {
+		MGLTextureArray * tex = (MGLTextureArray *)texture;
+		image = {tex->texture_obj, GL_TEXTURE_2D_ARRAY, tex->width, tex->height, tex->layers, tex->levels, 0, tex->components * tex->data_type->size, true, tex->compression, tex->context};
+	} else if (Py_TYPE(texture) == &MGLTextureCube_Type) {
+		MGLTextureCube * tex = (MGLTextureCube *)texture;
+		image = {tex->texture_obj, GL_TEXTURE_CUBE_MAP, tex->width, tex->height, 6, tex->levels, 0, tex->components * tex->data_type->size, true, tex->compression, tex->context};
+	} else if (Py_TYPE(texture) == &MGLTexture3D_Type) {
+		MGLTexture3D * tex = (MGLTexture3D *)texture;
+		image = {tex->texture_obj, GL_TEXTURE_3D, tex->width, tex->height, tex->depth, tex->levels, 0, tex->components * tex->data_type->size, false, 0, tex->context};
+	} else {
+		MGLError_Set("the %s must be a texture not %s", name, Py_TYPE(texture)->tp_name);
+		return false;
+	}
+
+	if (image.compression) {
+		image.texel_size = image.compression->block_size;
+	}
+
+	return true;
+}
+
+PyObject * MGLContext_copy_texture(MGLContext * self, PyObject * args) {
+	PyObject * dst;
+	PyObject * src;
+	PyObject * src_region;
+	int dst_x;
+	int dst_y;
+	int dst_z;
+	int src_level;
+	int dst_level;
+	int levels;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OOO(iii)III",
+		&dst,
+		&src,
+		&src_region,
+		&dst_x,
+		&dst_y,
+		&dst_z,
+		&src_level,
+		&dst_level,
+		&levels
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLCopyImage src_image;
+	MGLCopyImage dst_image;
+
+	if (!copy_image_from_texture(src, "source", src_image) || !copy_image_from_texture(dst, "destination", dst_image)) {
+		return 0;
+	}
+
+	if (src_image.context != self || dst_image.context != self) {
+		MGLError_Set("the textures belong to a different context");
+		return 0;
+	}
+
+	if (self->version_code < 430) {
+		MGLError_Set("copy_texture requires OpenGL 4.3");
+		return 0;
+	}
+
+	if (src_image.samples != dst_image.samples) {
+		MGLError_Set("the number of samples does not match %d != %d", src_image.samples, dst_image.samples);
+		return 0;
+	}
+
+	if (!src_image.compression != !dst_image.compression) {
+		MGLError_Set("compressed and uncompressed textures cannot be copied into each other");
+		return 0;
+	}
+
+	if (src_image.texel_size != dst_image.texel_size) {
+		MGLError_Set("the texel sizes do not match %d != %d", src_image.texel_size, dst_image.texel_size);
+		return 0;
+	}
+
+	if (levels < 1 || src_level + levels > src_image.levels || dst_level + levels > dst_image.levels) {
+		MGLError_Set("the levels to copy are not allocated");
+		return 0;
+	}
+
+	if (levels > 1 && src_region != Py_None) {
+		MGLError_Set("a region can only be copied from a single level");
+		return 0;
+	}
+
+	const GLMethods & gl = self->gl;
+
+	for (int i = 0; i < levels; ++i) {
+		int src_width = texture_level_size(src_image.width, src_level + i);
+		int src_height = texture_level_size(src_image.height, src_level + i);
+		int src_depth = src_image.layered ? src_image.depth : texture_level_size(src_image.depth, src_level + i);
+
+		int dst_width = texture_level_size(dst_image.width, dst_level + i);
+		int dst_height = texture_level_size(dst_image.height, dst_level + i);
+		int dst_depth = dst_image.layered ? dst_image.depth : texture_level_size(dst_image.depth, dst_level + i);
+
+		int x = 0;
+		int y = 0;
+		int z = 0;
+		int width = src_width;
+		int height = src_height;
+		int depth = src_depth;
+
+		if (src_region != Py_None) {
+			if (Py_TYPE(src_region) != &PyTuple_Type) {
+				MGLError_Set("the src_region must be a tuple not %s", Py_TYPE(src_region)->tp_name);
+				return 0;
+			}
+
+			if (PyTuple_GET_SIZE(src_region) == 6) {
+
+				x = PyLong_AsLong(PyTuple_GET_ITEM(src_region, 0));
+				y = PyLong_AsLong(PyTuple_GET_ITEM(src_region, 1));
+				z = PyLong_AsLong(PyTuple_GET_ITEM(src_region, 2));
+				width = PyLong_AsLong(PyTuple_GET_ITEM(src_region, 3));
+				height = PyLong_AsLong(PyTuple_GET_ITEM(src_region, 4));
+				depth = PyLong_AsLong(PyTuple_GET_ITEM(src_region, 5));
+
+			} else if (PyTuple_GET_SIZE(src_region) == 4) {
+
+				x = PyLong_AsLong(PyTuple_GET_ITEM(src_region, 0));
+				y = PyLong_AsLong(PyTuple_GET_ITEM(src_region, 1));
+				width = PyLong_AsLong(PyTuple_GET_ITEM(src_region, 2));
+				height = PyLong_AsLong(PyTuple_GET_ITEM(src_region, 3));
+				depth = 1;
+
+			} else {
+
+				MGLError_Set("the src_region size %d is invalid", (int)PyTuple_GET_SIZE(src_region));
+				return 0;
+
+			}
+
+			if (PyErr_Occurred()) {
+				MGLError_Set("wrong values in the src_region");
+				return 0;
+			}
+		}
+
+		if (x < 0 || y < 0 || z < 0 || width < 1 || height < 1 || depth < 1 || x + width > src_width || y + height > src_height || z + depth > src_depth) {
+			MGLError_Set("the src_region is outside of the source level %d", src_level + i);
+			return 0;
+		}
+
+		if (dst_x < 0 || dst_y < 0 || dst_z < 0 || dst_x + width > dst_width || dst_y + height > dst_height || dst_z + depth > dst_depth) {
+			MGLError_Set("the copied region is outside of the destination level %d", dst_level + i);
+			return 0;
+		}
+
+		if (src_image.compression) {
+			// Only whole blocks can be copied, partial blocks are allowed at the edges of the level.
+
+			bool aligned = compressed_region_aligned(src_image.compression, x, y, width, height, src_width, src_height);
+			aligned = aligned && compressed_region_aligned(dst_image.compression, dst_x, dst_y, width, height, dst_width, dst_height);
+
+			if (!aligned) {
+				MGLError_Set("the copied region must be aligned to the compressed blocks");
+				return 0;
+			}
+		}
+
+		gl.CopyImageSubData(
+			src_image.texture_obj, src_image.target, src_level + i, x, y, z,
+			dst_image.texture_obj, dst_image.target, dst_level + i, dst_x, dst_y, dst_z,
+			width, height, depth
+		);
+	}
+
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLContext_detect_framebuffer(MGLContext * self, PyObject * args) {
 	PyObject * glo;
 
@@ -435,18 +668,35 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args);
+PyObject * MGLContext_load_texture(MGLContext * self, PyObject * args);
 PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args);
 PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args);
 PyObject * MGLContext_program(MGLContext * self, PyObject * args);
+PyObject * MGLContext_program_pipeline(MGLContext * self, PyObject * args);
 PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_renderbuffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_depth_renderbuffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args);
 PyObject * MGLContext_query(MGLContext * self, PyObject * args);
+PyObject * MGLContext_query_pool(MGLContext * self, PyObject * args);
 PyObject * MGLContext_scope(MGLContext * self, PyObject * args);
 PyObject * MGLContext_sampler(MGLContext * self, PyObject * args);
+PyObject * MGLContext_uniform_ring(MGLContext * self, PyObject * args);
+PyObject * MGLContext_gl_stats(MGLContext * self, PyObject * args);
+PyObject * MGLContext_begin_trace(MGLContext * self, PyObject * args);
+PyObject * MGLContext_end_trace(MGLContext * self);
+PyObject * MGLContext_replay_trace(MGLContext * self, PyObject * args);
+
+PyObject * MGLContext_mark_frame(MGLContext * self) {
+	MGLContext_EndStatsFrame(self);
+	MGLContext_TraceFrame(self);
+	Py_RETURN_NONE;
+}
 
 PyObject * MGLContext_release(MGLContext * self) {
+	MGLContext_ReleaseStats(self);
+	MGLContext_EndTrace(self);
+
 	// TODO:
 	// MGLContext_Invalidate(self);
 	Py_RETURN_NONE;
@@ -457,8 +707,10 @@ PyMethodDef MGLContext_tp_methods[] = {
 	{"enable", (PyCFunction)MGLContext_enable, METH_VARARGS, 0},
 	{"disable", (PyCFunction)MGLContext_disable, METH_VARARGS, 0},
 	{"finish", (PyCFunction)MGLContext_finish, METH_NOARGS, 0},
+	{"memory_barrier", (PyCFunction)MGLContext_memory_barrier, METH_VARARGS, 0},
 	{"copy_buffer", (PyCFunction)MGLContext_copy_buffer, METH_VARARGS, 0},
 	{"copy_framebuffer", (PyCFunction)MGLContext_copy_framebuffer, METH_VARARGS, 0},
+	{"copy_texture", (PyCFunction)MGLContext_copy_texture, METH_VARARGS, 0},
 	{"detect_framebuffer", (PyCFunction)MGLContext_detect_framebuffer, METH_VARARGS, 0},
 	{"clear_samplers", (PyCFunction)MGLContext_clear_samplers, METH_VARARGS, 0},
 
@@ -467,17 +719,27 @@ PyMethodDef MGLContext_tp_methods[] = {
 	{"texture3d", (PyCFunction)MGLContext_texture3d, METH_VARARGS, 0},
 	{"texture_array", (PyCFunction)MGLContext_texture_array, METH_VARARGS, 0},
 	{"texture_cube", (PyCFunction)MGLContext_texture_cube, METH_VARARGS, 0},
+	{"load_texture", (PyCFunction)MGLContext_load_texture, METH_VARARGS, 0},
 	{"depth_texture", (PyCFunction)MGLContext_depth_texture, METH_VARARGS, 0},
 	{"vertex_array", (PyCFunction)MGLContext_vertex_array, METH_VARARGS, 0},
 	{"program", (PyCFunction)MGLContext_program, METH_VARARGS, 0},
+	{"program_pipeline", (PyCFunction)MGLContext_program_pipeline, METH_VARARGS, 0},
 	// {"shader", (PyCFunction)MGLContext_shader, METH_VARARGS, 0},
 	{"framebuffer", (PyCFunction)MGLContext_framebuffer, METH_VARARGS, 0},
 	{"renderbuffer", (PyCFunction)MGLContext_renderbuffer, METH_VARARGS, 0},
 	{"depth_renderbuffer", (PyCFunction)MGLContext_depth_renderbuffer, METH_VARARGS, 0},
 	{"compute_shader", (PyCFunction)MGLContext_compute_shader, METH_VARARGS, 0},
 	{"query", (PyCFunction)MGLContext_query, METH_VARARGS, 0},
+	{"query_pool", (PyCFunction)MGLContext_query_pool, METH_VARARGS, 0},
 	{"scope", (PyCFunction)MGLContext_scope, METH_VARARGS, 0},
 	{"sampler", (PyCFunction)MGLContext_sampler, METH_VARARGS, 0},
+	{"uniform_ring", (PyCFunction)MGLContext_uniform_ring, METH_VARARGS, 0},
+
+	{"gl_stats", (PyCFunction)MGLContext_gl_stats, METH_VARARGS, 0},
+	{"mark_frame", (PyCFunction)MGLContext_mark_frame, METH_NOARGS, 0},
+	{"begin_trace", (PyCFunction)MGLContext_begin_trace, METH_VARARGS, 0},
+	{"end_trace", (PyCFunction)MGLContext_end_trace, METH_NOARGS, 0},
+	{"replay_trace", (PyCFunction)MGLContext_replay_trace, METH_VARARGS, 0},
 
 	{"release", (PyCFunction)MGLContext_release, METH_NOARGS, 0},
 
@@ -704,6 +966,35 @@ int MGLContext_set_patch_vertices(MGLContext * self, PyObject * value) {
 	return 0;
 }
 
+PyObject * MGLContext_get_gpu_time(MGLContext * self) {
+	GLint64 timestamp = 0;
+	self->gl.GetInteger64v(GL_TIMESTAMP, &timestamp);
+	return PyLong_FromLongLong(timestamp);
+}
+
+PyObject * MGLContext_get_gl_instrumentation(MGLContext * self);
+int MGLContext_set_gl_instrumentation(MGLContext * self, PyObject * value);
+
+PyObject * MGLContext_get_compute_barrier(MGLContext * self) {
+	return PyLong_FromUnsignedLong(self->compute_barrier);
+}
+
+int MGLContext_set_compute_barrier(MGLContext * self, PyObject * value) {
+	unsigned compute_barrier = PyLong_AsUnsignedLong(value);
+
+	if (PyErr_Occurred()) {
+		return -1;
+	}
+
+	if (compute_barrier && self->version_code < 420) {
+		MGLError_Set("memory barriers require OpenGL 4.2");
+		return -1;
+	}
+
+	self->compute_barrier = compute_barrier;
+	return 0;
+}
+
 PyObject * MGLContext_get_error(MGLContext * self, void * closure) {
 	switch (self->gl.GetError()) {
 		case GL_NO_ERROR:
@@ -1267,6 +1558,9 @@ PyGetSetDef MGLContext_tp_getseters[] = {
 	{(char *)"front_face", (getter)MGLContext_get_front_face, (setter)MGLContext_set_front_face, 0, 0},
 
 	{(char *)"patch_vertices", (getter)MGLContext_get_patch_vertices, (setter)MGLContext_set_patch_vertices, 0, 0},
+	{(char *)"compute_barrier", (getter)MGLContext_get_compute_barrier, (setter)MGLContext_set_compute_barrier, 0, 0},
+	{(char *)"gpu_time", (getter)MGLContext_get_gpu_time, 0, 0, 0},
+	{(char *)"gl_instrumentation", (getter)MGLContext_get_gl_instrumentation, (setter)MGLContext_set_gl_instrumentation, 0, 0},
 
 	{(char *)"info", (getter)MGLContext_get_info, 0, 0, 0},
 	{(char *)"error", (getter)MGLContext_get_error, 0, 0, 0},
@@ -1321,6 +1615,9 @@ void MGLContext_Invalidate(MGLContext * context) {
 
 	// TODO: decref
 
+	MGLContext_ReleaseStats(context);
+	MGLContext_EndTrace(context);
+
 	DestroyGLContext(context->gl_context);
 	Py_TYPE(context) = &MGLInvalidObject_Type;
 	Py_DECREF(context);
@@ -1329,7 +1626,7 @@ void MGLContext_Invalidate(MGLContext * context) {
 void MGLContext_Initialize(MGLContext * self) {
 	GLMethods & gl = self->gl;
 
-	if (!gl.load()) {
+	if (!self->null_backend && !gl.load()) {
 		return;
 	}
 
@@ -1364,6 +1661,30 @@ void MGLContext_Initialize(MGLContext * self) {
 	self->max_anisotropy = 0.0;
 	gl.GetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, (GLfloat *)&self->max_anisotropy);
 
+	self->uniform_buffer_offset_alignment = 0;
+	gl.GetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, (GLint *)&self->uniform_buffer_offset_alignment);
+
+	self->indirect_parameters = self->version_code >= 460;
+	self->pipeline_statistics = self->version_code >= 460;
+
+	if (self->version_code < 460) {
+		int num_extensions = 0;
+		gl.GetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
+
+		for (int i = 0; i < num_extensions; ++i) {
+			const char * extension = (const char *)gl.GetStringi(GL_EXTENSIONS, i);
+			if (!extension) {
+				continue;
+			}
+			if (!strcmp(extension, "GL_ARB_indirect_parameters")) {
+				self->indirect_parameters = true;
+			}
+			if (!strcmp(extension, "GL_ARB_pipeline_statistics_query")) {
+				self->pipeline_statistics = true;
+			}
+		}
+	}
+
 	int bound_framebuffer = 0;
 	gl.GetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &bound_framebuffer);
 
@@ -1422,6 +1743,7 @@ void MGLContext_Initialize(MGLContext * self) {
 
 	self->enable_flags = 0;
 	self->front_face = GL_CCW;
+	self->compute_barrier = 0;
 
 	self->depth_func = GL_LEQUAL;
 	self->blend_func_src = GL_SRC_ALPHA;
@@ -1429,4 +1751,8 @@ void MGLContext_Initialize(MGLContext * self) {
 
 	self->wireframe = false;
 	self->multisample = true;
+
+	self->gl_stats = 0;
+	self->gl_trace = 0;
+	self->gl_wrapped = false;
 }
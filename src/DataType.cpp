@@ -1,5 +1,10 @@
 #include "Types.hpp"
 
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT 0x83F2
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+
 static int float_base_format[5] = {0, GL_RED, GL_RG, GL_RGB, GL_RGBA};
 static int int_base_format[5] = {0, GL_RED_INTEGER, GL_RG_INTEGER, GL_RGB_INTEGER, GL_RGBA_INTEGER};
 
@@ -60,3 +65,142 @@ MGLDataType * from_dtype(const char * dtype) {
 			return 0;
 	}
 }
+
+static MGLCompressedFormat compressed_formats[] = {
+	{"bc1", GL_COMPRESSED_RGB_S3TC_DXT1_EXT, 3, 4, 4, 8},
+	{"bc1", GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 4, 4, 4, 8},
+	{"bc2", GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, 4, 4, 4, 16},
+	{"bc3", GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 4, 4, 4, 16},
+	{"bc4", GL_COMPRESSED_RED_RGTC1, 1, 4, 4, 8},
+	{"bc4s", GL_COMPRESSED_SIGNED_RED_RGTC1, 1, 4, 4, 8},
+	{"bc5", GL_COMPRESSED_RG_RGTC2, 2, 4, 4, 16},
+	{"bc5s", GL_COMPRESSED_SIGNED_RG_RGTC2, 2, 4, 4, 16},
+	{"bc6h", GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, 3, 4, 4, 16},
+	{"bc6hs", GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, 3, 4, 4, 16},
+	{"bc7", GL_COMPRESSED_RGBA_BPTC_UNORM, 4, 4, 4, 16},
+	{"bc7_srgb", GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, 4, 4, 4, 16},
+	{"etc2", GL_COMPRESSED_RGB8_ETC2, 3, 4, 4, 8},
+	{"etc2", GL_COMPRESSED_RGBA8_ETC2_EAC, 4, 4, 4, 16},
+	{"etc2_a1", GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, 4, 4, 4, 8},
+	{"etc2_srgb", GL_COMPRESSED_SRGB8_ETC2, 3, 4, 4, 8},
+	{"etc2_srgb", GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC, 4, 4, 4, 16},
+	{"eac_r11", GL_COMPRESSED_R11_EAC, 1, 4, 4, 8},
+	{"eac_r11s", GL_COMPRESSED_SIGNED_R11_EAC, 1, 4, 4, 8},
+	{"eac_rg11", GL_COMPRESSED_RG11_EAC, 2, 4, 4, 16},
+	{"eac_rg11s", GL_COMPRESSED_SIGNED_RG11_EAC, 2, 4, 4, 16},
+	{0},
+};
+
+MGLCompressedFormat * from_compression(MGLContext * context, const char * name, int components) {
+	bool known = false;
+
+	for (int i = 0; compressed_formats[i].name; ++i) {
+		MGLCompressedFormat * format = &compressed_formats[i];
+
+		if (strcmp(format->name, name)) {
+			continue;
+		}
+
+		known = true;
+
+		if (format->components != components) {
+			continue;
+		}
+
+		// The support of the format can only be queried reliably from OpenGL 4.3.
+
+		if (context->version_code >= 430) {
+			int supported = 0;
+			context->gl.GetInternalformativ(GL_TEXTURE_2D, format->internal_format, GL_INTERNALFORMAT_SUPPORTED, 1, &supported);
+
+			if (!supported) {
+				MGLError_Set("the %s compression is not supported", name);
+				return 0;
+			}
+		}
+
+		return format;
+	}
+
+	if (known) {
+		MGLError_Set("the %s compression does not support %d components", name, components);
+	} else {
+		MGLError_Set("invalid compression: %s", name);
+	}
+
+	return 0;
+}
+
+struct MGLImageFormat {
+	const char * name;
+	int format;
+};
+
+// The image formats by their GLSL layout qualifier.
+
+static MGLImageFormat image_formats[] = {
+	{"rgba32f", GL_RGBA32F},
+	{"rgba16f", GL_RGBA16F},
+	{"rg32f", GL_RG32F},
+	{"rg16f", GL_RG16F},
+	{"r11f_g11f_b10f", GL_R11F_G11F_B10F},
+	{"r32f", GL_R32F},
+	{"r16f", GL_R16F},
+	{"rgba16", GL_RGBA16},
+	{"rgb10_a2", GL_RGB10_A2},
+	{"rgba8", GL_RGBA8},
+	{"rg16", GL_RG16},
+	{"rg8", GL_RG8},
+	{"r16", GL_R16},
+	{"r8", GL_R8},
+	{"rgba16_snorm", GL_RGBA16_SNORM},
+	{"rgba8_snorm", GL_RGBA8_SNORM},
+	{"rg16_snorm", GL_RG16_SNORM},
+	{"rg8_snorm", GL_RG8_SNORM},
+	{"r16_snorm", GL_R16_SNORM},
+	{"r8_snorm", GL_R8_SNORM},
+	{"rgba32i", GL_RGBA32I},
+	{"rgba16i", GL_RGBA16I},
+	{"rgba8i", GL_RGBA8I},
+	{"rg32i", GL_RG32I},
+	{"rg16i", GL_RG16I},
+	{"rg8i", GL_RG8I},
+	{"r32i", GL_R32I},
+	{"r16i", GL_R16I},
+	{"r8i", GL_R8I},
+	{"rgba32ui", GL_RGBA32UI},
+	{"rgba16ui", GL_RGBA16UI},
+	{"rgb10_a2ui", GL_RGB10_A2UI},
+	{"rgba8ui", GL_RGBA8UI},
+	{"rg32ui", GL_RG32UI},
+	{"rg16ui", GL_RG16UI},
+	{"rg8ui", GL_RG8UI},
+	{"r32ui", GL_R32UI},
+	{"r16ui", GL_R16UI},
+	{"r8ui", GL_R8UI},
+	{0},
+};
+
+int from_image_format(const char * name, int components) {
+	for (int i = 0; image_formats[i].name; ++i) {
+		if (!strcmp(image_formats[i].name, name)) {
+			return image_formats[i].format;
+		}
+	}
+
+	// A dtype selects the format with the components of the texture.
+
+	MGLDataType * data_type = from_dtype(name);
+
+	if (!data_type) {
+		MGLError_Set("invalid image format: %s", name);
+		return 0;
+	}
+
+	if (components == 3) {
+		MGLError_Set("there are no three component image formats");
+		return 0;
+	}
+
+	return data_type->internal_format[components];
+}
@@ -672,14 +672,21 @@ PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 
 		Py_buffer buffer_view;
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_WRITABLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDES | PyBUF_WRITABLE);
 		if (get_buffer < 0) {
 			MGLError_Set("the buffer (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
-		if (buffer_view.len < write_offset + expected_size) {
-			MGLError_Set("the buffer is too small");
+		MGLPixelStore store;
+
+		if (!pixel_store_from_view(&buffer_view, width, height, 1, components, data_type, alignment, &store)) {
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		if (store.strided ? write_offset != 0 : buffer_view.len < write_offset + expected_size) {
+			MGLError_Set(store.strided ? "the write_offset must be zero for strided buffers" : "the buffer is too small");
 			PyBuffer_Release(&buffer_view);
 			return 0;
 		}
@@ -690,9 +697,9 @@ PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 
 		gl.BindFramebuffer(GL_FRAMEBUFFER, self->framebuffer_obj);
 		gl.ReadBuffer(read_depth ? GL_NONE : (GL_COLOR_ATTACHMENT0 + attachment));
-		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
-		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+		set_pixel_store(gl, store);
 		gl.ReadPixels(x, y, width, height, base_format, pixel_type, ptr);
+		reset_pixel_store(gl, store);
 		gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
 
 		PyBuffer_Release(&buffer_view);
@@ -0,0 +1,669 @@
+#pragma once
+
+// Every method of GLMethods, for code that has to visit the whole table.
+
+#define GL_METHOD_LIST(X) \
+	X(ActiveShaderProgram) \
+	X(ActiveTexture) \
+	X(AttachShader) \
+	X(BeginConditionalRender) \
+	X(BeginQuery) \
+	X(BeginQueryIndexed) \
+	X(BeginTransformFeedback) \
+	X(BindAttribLocation) \
+	X(BindBuffer) \
+	X(BindBufferBase) \
+	X(BindBufferRange) \
+	X(BindBuffersBase) \
+	X(BindBuffersRange) \
+	X(BindFragDataLocation) \
+	X(BindFragDataLocationIndexed) \
+	X(BindFramebuffer) \
+	X(BindImageTexture) \
+	X(BindImageTextures) \
+	X(BindProgramPipeline) \
+	X(BindRenderbuffer) \
+	X(BindSampler) \
+	X(BindSamplers) \
+	X(BindTexture) \
+	X(BindTextureUnit) \
+	X(BindTextures) \
+	X(BindTransformFeedback) \
+	X(BindVertexArray) \
+	X(BindVertexBuffer) \
+	X(BindVertexBuffers) \
+	X(BlendColor) \
+	X(BlendEquation) \
+	X(BlendEquationSeparate) \
+	X(BlendEquationSeparatei) \
+	X(BlendEquationi) \
+	X(BlendFunc) \
+	X(BlendFuncSeparate) \
+	X(BlendFuncSeparatei) \
+	X(BlendFunci) \
+	X(BlitFramebuffer) \
+	X(BlitNamedFramebuffer) \
+	X(BufferData) \
+	X(BufferStorage) \
+	X(BufferSubData) \
+	X(CheckFramebufferStatus) \
+	X(CheckNamedFramebufferStatus) \
+	X(ClampColor) \
+	X(Clear) \
+	X(ClearBufferData) \
+	X(ClearBufferSubData) \
+	X(ClearBufferfi) \
+	X(ClearBufferfv) \
+	X(ClearBufferiv) \
+	X(ClearBufferuiv) \
+	X(ClearColor) \
+	X(ClearDepth) \
+	X(ClearDepthf) \
+	X(ClearNamedBufferData) \
+	X(ClearNamedBufferSubData) \
+	X(ClearNamedFramebufferfi) \
+	X(ClearNamedFramebufferfv) \
+	X(ClearNamedFramebufferiv) \
+	X(ClearNamedFramebufferuiv) \
+	X(ClearStencil) \
+	X(ClearTexImage) \
+	X(ClearTexSubImage) \
+	X(ClientWaitSync) \
+	X(WaitSync) \
+	X(ClipControl) \
+	X(ColorMask) \
+	X(ColorMaski) \
+	X(CompileShader) \
+	X(CompressedTexImage1D) \
+	X(CompressedTexImage2D) \
+	X(CompressedTexImage3D) \
+	X(CompressedTexSubImage1D) \
+	X(CompressedTexSubImage2D) \
+	X(CompressedTexSubImage3D) \
+	X(CompressedTextureSubImage1D) \
+	X(CompressedTextureSubImage2D) \
+	X(CompressedTextureSubImage3D) \
+	X(CopyBufferSubData) \
+	X(CopyImageSubData) \
+	X(CopyNamedBufferSubData) \
+	X(CopyTexImage1D) \
+	X(CopyTexImage2D) \
+	X(CopyTexSubImage1D) \
+	X(CopyTexSubImage2D) \
+	X(CopyTexSubImage3D) \
+	X(CopyTextureSubImage1D) \
+	X(CopyTextureSubImage2D) \
+	X(CopyTextureSubImage3D) \
+	X(CreateBuffers) \
+	X(CreateFramebuffers) \
+	X(CreateProgram) \
+	X(CreateProgramPipelines) \
+	X(CreateQueries) \
+	X(CreateRenderbuffers) \
+	X(CreateSamplers) \
+	X(CreateShader) \
+	X(CreateShaderProgramv) \
+	X(CreateTextures) \
+	X(CreateTransformFeedbacks) \
+	X(CreateVertexArrays) \
+	X(CullFace) \
+	X(DebugMessageCallback) \
+	X(DebugMessageControl) \
+	X(DebugMessageInsert) \
+	X(DeleteBuffers) \
+	X(DeleteFramebuffers) \
+	X(DeleteProgram) \
+	X(DeleteProgramPipelines) \
+	X(DeleteQueries) \
+	X(DeleteRenderbuffers) \
+	X(DeleteSamplers) \
+	X(DeleteShader) \
+	X(DeleteSync) \
+	X(DeleteTextures) \
+	X(DeleteTransformFeedbacks) \
+	X(DeleteVertexArrays) \
+	X(DepthFunc) \
+	X(DepthMask) \
+	X(DepthRange) \
+	X(DepthRangeArrayv) \
+	X(DepthRangeIndexed) \
+	X(DepthRangef) \
+	X(DetachShader) \
+	X(Disable) \
+	X(DisableVertexArrayAttrib) \
+	X(DisableVertexAttribArray) \
+	X(Disablei) \
+	X(DispatchCompute) \
+	X(DispatchComputeIndirect) \
+	X(DrawArrays) \
+	X(DrawArraysIndirect) \
+	X(DrawArraysInstanced) \
+	X(DrawArraysInstancedBaseInstance) \
+	X(DrawBuffer) \
+	X(DrawBuffers) \
+	X(DrawElements) \
+	X(DrawElementsBaseVertex) \
+	X(DrawElementsIndirect) \
+	X(DrawElementsInstanced) \
+	X(DrawElementsInstancedBaseInstance) \
+	X(DrawElementsInstancedBaseVertex) \
+	X(DrawElementsInstancedBaseVertexBaseInstance) \
+	X(DrawRangeElements) \
+	X(DrawRangeElementsBaseVertex) \
+	X(DrawTransformFeedback) \
+	X(DrawTransformFeedbackInstanced) \
+	X(DrawTransformFeedbackStream) \
+	X(DrawTransformFeedbackStreamInstanced) \
+	X(Enable) \
+	X(EnableVertexArrayAttrib) \
+	X(EnableVertexAttribArray) \
+	X(Enablei) \
+	X(EndConditionalRender) \
+	X(EndQuery) \
+	X(EndQueryIndexed) \
+	X(EndTransformFeedback) \
+	X(FenceSync) \
+	X(Finish) \
+	X(Flush) \
+	X(FlushMappedBufferRange) \
+	X(FlushMappedNamedBufferRange) \
+	X(FramebufferParameteri) \
+	X(FramebufferRenderbuffer) \
+	X(FramebufferTexture) \
+	X(FramebufferTexture1D) \
+	X(FramebufferTexture2D) \
+	X(FramebufferTexture3D) \
+	X(FramebufferTextureLayer) \
+	X(FrontFace) \
+	X(GenBuffers) \
+	X(GenFramebuffers) \
+	X(GenProgramPipelines) \
+	X(GenQueries) \
+	X(GenRenderbuffers) \
+	X(GenSamplers) \
+	X(GenTextures) \
+	X(GenTransformFeedbacks) \
+	X(GenVertexArrays) \
+	X(GenerateMipmap) \
+	X(GenerateTextureMipmap) \
+	X(GetActiveAtomicCounterBufferiv) \
+	X(GetActiveAttrib) \
+	X(GetActiveSubroutineName) \
+	X(GetActiveSubroutineUniformName) \
+	X(GetActiveSubroutineUniformiv) \
+	X(GetActiveUniform) \
+	X(GetActiveUniformBlockName) \
+	X(GetActiveUniformBlockiv) \
+	X(GetActiveUniformName) \
+	X(GetActiveUniformsiv) \
+	X(GetAttachedShaders) \
+	X(GetAttribLocation) \
+	X(GetBooleani_v) \
+	X(GetBooleanv) \
+	X(GetBufferParameteri64v) \
+	X(GetBufferParameteriv) \
+	X(GetBufferPointerv) \
+	X(GetBufferSubData) \
+	X(GetCompressedTexImage) \
+	X(GetCompressedTextureImage) \
+	X(GetCompressedTextureSubImage) \
+	X(GetDebugMessageLog) \
+	X(GetDoublei_v) \
+	X(GetDoublev) \
+	X(GetError) \
+	X(GetFloati_v) \
+	X(GetFloatv) \
+	X(GetFragDataIndex) \
+	X(GetFragDataLocation) \
+	X(GetFramebufferAttachmentParameteriv) \
+	X(GetFramebufferParameteriv) \
+	X(GetGraphicsResetStatus) \
+	X(GetInteger64i_v) \
+	X(GetInteger64v) \
+	X(GetIntegeri_v) \
+	X(GetIntegerv) \
+	X(GetInternalformati64v) \
+	X(GetInternalformativ) \
+	X(GetMultisamplefv) \
+	X(GetNamedBufferParameteri64v) \
+	X(GetNamedBufferParameteriv) \
+	X(GetNamedBufferPointerv) \
+	X(GetNamedBufferSubData) \
+	X(GetNamedFramebufferAttachmentParameteriv) \
+	X(GetNamedFramebufferParameteriv) \
+	X(GetNamedRenderbufferParameteriv) \
+	X(GetObjectLabel) \
+	X(GetObjectPtrLabel) \
+	X(GetPointerv) \
+	X(GetProgramBinary) \
+	X(GetProgramInfoLog) \
+	X(GetProgramInterfaceiv) \
+	X(GetProgramPipelineInfoLog) \
+	X(GetProgramPipelineiv) \
+	X(GetProgramResourceIndex) \
+	X(GetProgramResourceLocation) \
+	X(GetProgramResourceLocationIndex) \
+	X(GetProgramResourceName) \
+	X(GetProgramResourceiv) \
+	X(GetProgramStageiv) \
+	X(GetProgramiv) \
+	X(GetQueryBufferObjecti64v) \
+	X(GetQueryBufferObjectiv) \
+	X(GetQueryBufferObjectui64v) \
+	X(GetQueryBufferObjectuiv) \
+	X(GetQueryIndexediv) \
+	X(GetQueryObjecti64v) \
+	X(GetQueryObjectiv) \
+	X(GetQueryObjectui64v) \
+	X(GetQueryObjectuiv) \
+	X(GetQueryiv) \
+	X(GetRenderbufferParameteriv) \
+	X(GetSamplerParameterIiv) \
+	X(GetSamplerParameterIuiv) \
+	X(GetSamplerParameterfv) \
+	X(GetSamplerParameteriv) \
+	X(GetShaderInfoLog) \
+	X(GetShaderPrecisionFormat) \
+	X(GetShaderSource) \
+	X(GetShaderiv) \
+	X(GetString) \
+	X(GetStringi) \
+	X(GetSubroutineIndex) \
+	X(GetSubroutineUniformLocation) \
+	X(GetSynciv) \
+	X(GetTexImage) \
+	X(GetTexLevelParameterfv) \
+	X(GetTexLevelParameteriv) \
+	X(GetTexParameterIiv) \
+	X(GetTexParameterIuiv) \
+	X(GetTexParameterfv) \
+	X(GetTexParameteriv) \
+	X(GetTextureImage) \
+	X(GetTextureLevelParameterfv) \
+	X(GetTextureLevelParameteriv) \
+	X(GetTextureParameterIiv) \
+	X(GetTextureParameterIuiv) \
+	X(GetTextureParameterfv) \
+	X(GetTextureParameteriv) \
+	X(GetTextureSubImage) \
+	X(GetTransformFeedbackVarying) \
+	X(GetTransformFeedbacki64_v) \
+	X(GetTransformFeedbacki_v) \
+	X(GetTransformFeedbackiv) \
+	X(GetUniformBlockIndex) \
+	X(GetUniformIndices) \
+	X(GetUniformLocation) \
+	X(GetUniformSubroutineuiv) \
+	X(GetUniformdv) \
+	X(GetUniformfv) \
+	X(GetUniformiv) \
+	X(GetUniformuiv) \
+	X(GetVertexArrayIndexed64iv) \
+	X(GetVertexArrayIndexediv) \
+	X(GetVertexArrayiv) \
+	X(GetVertexAttribIiv) \
+	X(GetVertexAttribIuiv) \
+	X(GetVertexAttribLdv) \
+	X(GetVertexAttribPointerv) \
+	X(GetVertexAttribdv) \
+	X(GetVertexAttribfv) \
+	X(GetVertexAttribiv) \
+	X(GetnCompressedTexImage) \
+	X(GetnTexImage) \
+	X(GetnUniformdv) \
+	X(GetnUniformfv) \
+	X(GetnUniformiv) \
+	X(GetnUniformuiv) \
+	X(Hint) \
+	X(InvalidateBufferData) \
+	X(InvalidateBufferSubData) \
+	X(InvalidateFramebuffer) \
+	X(InvalidateNamedFramebufferData) \
+	X(InvalidateNamedFramebufferSubData) \
+	X(InvalidateSubFramebuffer) \
+	X(InvalidateTexImage) \
+	X(InvalidateTexSubImage) \
+	X(IsBuffer) \
+	X(IsEnabled) \
+	X(IsEnabledi) \
+	X(IsFramebuffer) \
+	X(IsProgram) \
+	X(IsProgramPipeline) \
+	X(IsQuery) \
+	X(IsRenderbuffer) \
+	X(IsSampler) \
+	X(IsShader) \
+	X(IsSync) \
+	X(IsTexture) \
+	X(IsTransformFeedback) \
+	X(IsVertexArray) \
+	X(LineWidth) \
+	X(LinkProgram) \
+	X(LogicOp) \
+	X(MapBuffer) \
+	X(MapBufferRange) \
+	X(MapNamedBuffer) \
+	X(MapNamedBufferRange) \
+	X(MemoryBarrier) \
+	X(MemoryBarrierByRegion) \
+	X(MinSampleShading) \
+	X(MultiDrawArrays) \
+	X(MultiDrawArraysIndirect) \
+	X(MultiDrawArraysIndirectCount) \
+	X(MultiDrawElements) \
+	X(MultiDrawElementsBaseVertex) \
+	X(MultiDrawElementsIndirect) \
+	X(MultiDrawElementsIndirectCount) \
+	X(NamedBufferData) \
+	X(NamedBufferStorage) \
+	X(NamedBufferSubData) \
+	X(NamedFramebufferDrawBuffer) \
+	X(NamedFramebufferDrawBuffers) \
+	X(NamedFramebufferParameteri) \
+	X(NamedFramebufferReadBuffer) \
+	X(NamedFramebufferRenderbuffer) \
+	X(NamedFramebufferTexture) \
+	X(NamedFramebufferTextureLayer) \
+	X(NamedRenderbufferStorage) \
+	X(NamedRenderbufferStorageMultisample) \
+	X(ObjectLabel) \
+	X(ObjectPtrLabel) \
+	X(PatchParameterfv) \
+	X(PatchParameteri) \
+	X(PauseTransformFeedback) \
+	X(PixelStoref) \
+	X(PixelStorei) \
+	X(PointParameterf) \
+	X(PointParameterfv) \
+	X(PointParameteri) \
+	X(PointParameteriv) \
+	X(PointSize) \
+	X(PolygonMode) \
+	X(PolygonOffset) \
+	X(PopDebugGroup) \
+	X(PrimitiveRestartIndex) \
+	X(ProgramBinary) \
+	X(ProgramParameteri) \
+	X(ProgramUniform1d) \
+	X(ProgramUniform1dv) \
+	X(ProgramUniform1f) \
+	X(ProgramUniform1fv) \
+	X(ProgramUniform1i) \
+	X(ProgramUniform1iv) \
+	X(ProgramUniform1ui) \
+	X(ProgramUniform1uiv) \
+	X(ProgramUniform2d) \
+	X(ProgramUniform2dv) \
+	X(ProgramUniform2f) \
+	X(ProgramUniform2fv) \
+	X(ProgramUniform2i) \
+	X(ProgramUniform2iv) \
+	X(ProgramUniform2ui) \
+	X(ProgramUniform2uiv) \
+	X(ProgramUniform3d) \
+	X(ProgramUniform3dv) \
+	X(ProgramUniform3f) \
+	X(ProgramUniform3fv) \
+	X(ProgramUniform3i) \
+	X(ProgramUniform3iv) \
+	X(ProgramUniform3ui) \
+	X(ProgramUniform3uiv) \
+	X(ProgramUniform4d) \
+	X(ProgramUniform4dv) \
+	X(ProgramUniform4f) \
+	X(ProgramUniform4fv) \
+	X(ProgramUniform4i) \
+	X(ProgramUniform4iv) \
+	X(ProgramUniform4ui) \
+	X(ProgramUniform4uiv) \
+	X(ProgramUniformMatrix2dv) \
+	X(ProgramUniformMatrix2fv) \
+	X(ProgramUniformMatrix2x3dv) \
+	X(ProgramUniformMatrix2x3fv) \
+	X(ProgramUniformMatrix2x4dv) \
+	X(ProgramUniformMatrix2x4fv) \
+	X(ProgramUniformMatrix3dv) \
+	X(ProgramUniformMatrix3fv) \
+	X(ProgramUniformMatrix3x2dv) \
+	X(ProgramUniformMatrix3x2fv) \
+	X(ProgramUniformMatrix3x4dv) \
+	X(ProgramUniformMatrix3x4fv) \
+	X(ProgramUniformMatrix4dv) \
+	X(ProgramUniformMatrix4fv) \
+	X(ProgramUniformMatrix4x2dv) \
+	X(ProgramUniformMatrix4x2fv) \
+	X(ProgramUniformMatrix4x3dv) \
+	X(ProgramUniformMatrix4x3fv) \
+	X(ProvokingVertex) \
+	X(PushDebugGroup) \
+	X(QueryCounter) \
+	X(ReadBuffer) \
+	X(ReadPixels) \
+	X(ReadnPixels) \
+	X(ReleaseShaderCompiler) \
+	X(RenderbufferStorage) \
+	X(RenderbufferStorageMultisample) \
+	X(ResumeTransformFeedback) \
+	X(SampleCoverage) \
+	X(SampleMaski) \
+	X(SamplerParameterIiv) \
+	X(SamplerParameterIuiv) \
+	X(SamplerParameterf) \
+	X(SamplerParameterfv) \
+	X(SamplerParameteri) \
+	X(SamplerParameteriv) \
+	X(Scissor) \
+	X(ScissorArrayv) \
+	X(ScissorIndexed) \
+	X(ScissorIndexedv) \
+	X(ShaderBinary) \
+	X(ShaderSource) \
+	X(ShaderStorageBlockBinding) \
+	X(StencilFunc) \
+	X(StencilFuncSeparate) \
+	X(StencilMask) \
+	X(StencilMaskSeparate) \
+	X(StencilOp) \
+	X(StencilOpSeparate) \
+	X(TexBuffer) \
+	X(TexBufferRange) \
+	X(TexImage1D) \
+	X(TexImage2D) \
+	X(TexImage2DMultisample) \
+	X(TexImage3D) \
+	X(TexImage3DMultisample) \
+	X(TexParameterIiv) \
+	X(TexParameterIuiv) \
+	X(TexParameterf) \
+	X(TexParameterfv) \
+	X(TexParameteri) \
+	X(TexParameteriv) \
+	X(TexStorage1D) \
+	X(TexStorage2D) \
+	X(TexStorage2DMultisample) \
+	X(TexStorage3D) \
+	X(TexStorage3DMultisample) \
+	X(TexSubImage1D) \
+	X(TexSubImage2D) \
+	X(TexSubImage3D) \
+	X(TextureBarrier) \
+	X(TextureBuffer) \
+	X(TextureBufferRange) \
+	X(TextureParameterIiv) \
+	X(TextureParameterIuiv) \
+	X(TextureParameterf) \
+	X(TextureParameterfv) \
+	X(TextureParameteri) \
+	X(TextureParameteriv) \
+	X(TextureStorage1D) \
+	X(TextureStorage2D) \
+	X(TextureStorage2DMultisample) \
+	X(TextureStorage3D) \
+	X(TextureStorage3DMultisample) \
+	X(TextureSubImage1D) \
+	X(TextureSubImage2D) \
+	X(TextureSubImage3D) \
+	X(TextureView) \
+	X(TransformFeedbackBufferBase) \
+	X(TransformFeedbackBufferRange) \
+	X(TransformFeedbackVaryings) \
+	X(Uniform1d) \
+	X(Uniform1dv) \
+	X(Uniform1f) \
+	X(Uniform1fv) \
+	X(Uniform1i) \
+	X(Uniform1iv) \
+	X(Uniform1ui) \
+	X(Uniform1uiv) \
+	X(Uniform2d) \
+	X(Uniform2dv) \
+	X(Uniform2f) \
+	X(Uniform2fv) \
+	X(Uniform2i) \
+	X(Uniform2iv) \
+	X(Uniform2ui) \
+	X(Uniform2uiv) \
+	X(Uniform3d) \
+	X(Uniform3dv) \
+	X(Uniform3f) \
+	X(Uniform3fv) \
+	X(Uniform3i) \
+	X(Uniform3iv) \
+	X(Uniform3ui) \
+	X(Uniform3uiv) \
+	X(Uniform4d) \
+	X(Uniform4dv) \
+	X(Uniform4f) \
+	X(Uniform4fv) \
+	X(Uniform4i) \
+	X(Uniform4iv) \
+	X(Uniform4ui) \
+	X(Uniform4uiv) \
+	X(UniformBlockBinding) \
+	X(UniformMatrix2dv) \
+	X(UniformMatrix2fv) \
+	X(UniformMatrix2x3dv) \
+	X(UniformMatrix2x3fv) \
+	X(UniformMatrix2x4dv) \
+	X(UniformMatrix2x4fv) \
+	X(UniformMatrix3dv) \
+	X(UniformMatrix3fv) \
+	X(UniformMatrix3x2dv) \
+	X(UniformMatrix3x2fv) \
+	X(UniformMatrix3x4dv) \
+	X(UniformMatrix3x4fv) \
+	X(UniformMatrix4dv) \
+	X(UniformMatrix4fv) \
+	X(UniformMatrix4x2dv) \
+	X(UniformMatrix4x2fv) \
+	X(UniformMatrix4x3dv) \
+	X(UniformMatrix4x3fv) \
+	X(UniformSubroutinesuiv) \
+	X(UnmapBuffer) \
+	X(UnmapNamedBuffer) \
+	X(UseProgram) \
+	X(UseProgramStages) \
+	X(ValidateProgram) \
+	X(ValidateProgramPipeline) \
+	X(VertexArrayAttribBinding) \
+	X(VertexArrayAttribFormat) \
+	X(VertexArrayAttribIFormat) \
+	X(VertexArrayAttribLFormat) \
+	X(VertexArrayBindingDivisor) \
+	X(VertexArrayElementBuffer) \
+	X(VertexArrayVertexBuffer) \
+	X(VertexArrayVertexBuffers) \
+	X(VertexAttrib1d) \
+	X(VertexAttrib1dv) \
+	X(VertexAttrib1f) \
+	X(VertexAttrib1fv) \
+	X(VertexAttrib1s) \
+	X(VertexAttrib1sv) \
+	X(VertexAttrib2d) \
+	X(VertexAttrib2dv) \
+	X(VertexAttrib2f) \
+	X(VertexAttrib2fv) \
+	X(VertexAttrib2s) \
+	X(VertexAttrib2sv) \
+	X(VertexAttrib3d) \
+	X(VertexAttrib3dv) \
+	X(VertexAttrib3f) \
+	X(VertexAttrib3fv) \
+	X(VertexAttrib3s) \
+	X(VertexAttrib3sv) \
+	X(VertexAttrib4Nbv) \
+	X(VertexAttrib4Niv) \
+	X(VertexAttrib4Nsv) \
+	X(VertexAttrib4Nub) \
+	X(VertexAttrib4Nubv) \
+	X(VertexAttrib4Nuiv) \
+	X(VertexAttrib4Nusv) \
+	X(VertexAttrib4bv) \
+	X(VertexAttrib4d) \
+	X(VertexAttrib4dv) \
+	X(VertexAttrib4f) \
+	X(VertexAttrib4fv) \
+	X(VertexAttrib4iv) \
+	X(VertexAttrib4s) \
+	X(VertexAttrib4sv) \
+	X(VertexAttrib4ubv) \
+	X(VertexAttrib4uiv) \
+	X(VertexAttrib4usv) \
+	X(VertexAttribBinding) \
+	X(VertexAttribDivisor) \
+	X(VertexAttribFormat) \
+	X(VertexAttribI1i) \
+	X(VertexAttribI1iv) \
+	X(VertexAttribI1ui) \
+	X(VertexAttribI1uiv) \
+	X(VertexAttribI2i) \
+	X(VertexAttribI2iv) \
+	X(VertexAttribI2ui) \
+	X(VertexAttribI2uiv) \
+	X(VertexAttribI3i) \
+	X(VertexAttribI3iv) \
+	X(VertexAttribI3ui) \
+	X(VertexAttribI3uiv) \
+	X(VertexAttribI4bv) \
+	X(VertexAttribI4i) \
+	X(VertexAttribI4iv) \
+	X(VertexAttribI4sv) \
+	X(VertexAttribI4ubv) \
+	X(VertexAttribI4ui) \
+	X(VertexAttribI4uiv) \
+	X(VertexAttribI4usv) \
+	X(VertexAttribIFormat) \
+	X(VertexAttribIPointer) \
+	X(VertexAttribL1d) \
+	X(VertexAttribL1dv) \
+	X(VertexAttribL2d) \
+	X(VertexAttribL2dv) \
+	X(VertexAttribL3d) \
+	X(VertexAttribL3dv) \
+	X(VertexAttribL4d) \
+	X(VertexAttribL4dv) \
+	X(VertexAttribLFormat) \
+	X(VertexAttribLPointer) \
+	X(VertexAttribP1ui) \
+	X(VertexAttribP1uiv) \
+	X(VertexAttribP2ui) \
+	X(VertexAttribP2uiv) \
+	X(VertexAttribP3ui) \
+	X(VertexAttribP3uiv) \
+	X(VertexAttribP4ui) \
+	X(VertexAttribP4uiv) \
+	X(VertexAttribPointer) \
+	X(VertexBindingDivisor) \
+	X(Viewport) \
+	X(ViewportArrayv) \
+	X(ViewportIndexedf) \
+	X(ViewportIndexedfv)
+
+enum GLMethodIndex {
+#define GL_METHOD_INDEX(name) GL_METHOD_##name,
+	GL_METHOD_LIST(GL_METHOD_INDEX)
+#undef GL_METHOD_INDEX
+	NUM_GL_METHODS,
+};
+
+extern const char * gl_method_names[NUM_GL_METHODS];
@@ -2,6 +2,14 @@
 
 #include "Types.hpp"
 
+#include "GLMethodList.hpp"
+
+const char * gl_method_names[NUM_GL_METHODS] = {
+#define GL_METHOD_NAME(name) "gl" #name,
+	GL_METHOD_LIST(GL_METHOD_NAME)
+#undef GL_METHOD_NAME
+};
+
 void AddToLog(PyObject ** pstr, const char * function) {
 	PyObject * name = PyUnicode_FromFormat("- %s\n", function);
 	PyUnicode_Append(pstr, name);
@@ -442,9 +450,21 @@ bool GLMethods::load() {
 	this->MinSampleShading = (PROC_glMinSampleShading)LoadMethod(PREFIX "glMinSampleShading");
 	this->MultiDrawArrays = (PROC_glMultiDrawArrays)LoadMethod(PREFIX "glMultiDrawArrays");
 	this->MultiDrawArraysIndirect = (PROC_glMultiDrawArraysIndirect)LoadMethod(PREFIX "glMultiDrawArraysIndirect");
+	this->MultiDrawArraysIndirectCount = (PROC_glMultiDrawArraysIndirectCount)LoadMethod(PREFIX "glMultiDrawArraysIndirectCount");
 	this->MultiDrawElements = (PROC_glMultiDrawElements)LoadMethod(PREFIX "glMultiDrawElements");
 	this->MultiDrawElementsBaseVertex = (PROC_glMultiDrawElementsBaseVertex)LoadMethod(PREFIX "glMultiDrawElementsBaseVertex");
 	this->MultiDrawElementsIndirect = (PROC_glMultiDrawElementsIndirect)LoadMethod(PREFIX "glMultiDrawElementsIndirect");
+	this->MultiDrawElementsIndirectCount = (PROC_glMultiDrawElementsIndirectCount)LoadMethod(PREFIX "glMultiDrawElementsIndirectCount");
+
+	// Before OpenGL 4.6 the count sourced draws come from ARB_indirect_parameters.
+
+	if (!this->MultiDrawArraysIndirectCount) {
+		this->MultiDrawArraysIndirectCount = (PROC_glMultiDrawArraysIndirectCount)LoadMethod(PREFIX "glMultiDrawArraysIndirectCountARB");
+	}
+
+	if (!this->MultiDrawElementsIndirectCount) {
+		this->MultiDrawElementsIndirectCount = (PROC_glMultiDrawElementsIndirectCount)LoadMethod(PREFIX "glMultiDrawElementsIndirectCountARB");
+	}
 	this->NamedBufferData = (PROC_glNamedBufferData)LoadMethod(PREFIX "glNamedBufferData");
 	this->NamedBufferStorage = (PROC_glNamedBufferStorage)LoadMethod(PREFIX "glNamedBufferStorage");
 	this->NamedBufferSubData = (PROC_glNamedBufferSubData)LoadMethod(PREFIX "glNamedBufferSubData");
@@ -352,9 +352,11 @@ struct GLMethods {
 	PROC_glMinSampleShading MinSampleShading;
 	PROC_glMultiDrawArrays MultiDrawArrays;
 	PROC_glMultiDrawArraysIndirect MultiDrawArraysIndirect;
+	PROC_glMultiDrawArraysIndirectCount MultiDrawArraysIndirectCount;
 	PROC_glMultiDrawElements MultiDrawElements;
 	PROC_glMultiDrawElementsBaseVertex MultiDrawElementsBaseVertex;
 	PROC_glMultiDrawElementsIndirect MultiDrawElementsIndirect;
+	PROC_glMultiDrawElementsIndirectCount MultiDrawElementsIndirectCount;
 	PROC_glNamedBufferData NamedBufferData;
 	PROC_glNamedBufferStorage NamedBufferStorage;
 	PROC_glNamedBufferSubData NamedBufferSubData;
@@ -0,0 +1,1176 @@
+#include "Types.hpp"
+
+#include "GLMethodList.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// The null backend implements the OpenGL methods on the host without a driver.
+// Object names, buffer storage, bindings, uniform values and query results are recorded,
+// the draws, clears and texture uploads do nothing and the readbacks return zeros.
+// Programs are reflected from the declarations of their shaders.
+
+struct GLNullVariable {
+	std::string name;
+	int type;
+	int size;
+	int location;
+};
+
+struct GLNullShader {
+	int type;
+	std::string source;
+};
+
+struct GLNullProgram {
+	std::vector<unsigned> shaders;
+	std::vector<GLNullVariable> attributes;
+	std::vector<GLNullVariable> uniforms;
+	std::vector<std::string> uniform_blocks;
+	std::vector<std::string> varyings;
+};
+
+struct GLNullTexture {
+	std::unordered_map<int, int> parameters;
+	std::unordered_map<int, std::vector<int>> levels;
+};
+
+struct GLNullQuery {
+	long long result;
+	long long start;
+};
+
+struct GLNull {
+	unsigned next_name;
+	int active_texture;
+	int viewport[4];
+	int scissor_box[4];
+
+	std::unordered_map<int, int> integers;
+	std::unordered_map<int, unsigned> buffer_bindings;
+	std::unordered_map<long long, unsigned> texture_bindings;
+	std::unordered_map<int, unsigned> query_bindings;
+
+	std::unordered_map<unsigned, std::vector<char>> buffers;
+	std::unordered_map<unsigned, GLNullTexture> textures;
+	std::unordered_map<unsigned, GLNullShader> shaders;
+	std::unordered_map<unsigned, GLNullProgram> programs;
+	std::unordered_map<unsigned, GLNullQuery> queries;
+	std::unordered_map<long long, std::vector<char>> uniforms;
+};
+
+// The methods have no context argument, every null context shares the same state like a share group.
+
+static GLNull * null_state;
+
+inline long long GLNullNow() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline long long GLNullKey(unsigned first, unsigned second) {
+	return ((long long)first << 32) | second;
+}
+
+std::vector<char> * GLNullBuffer(int target) {
+	std::unordered_map<unsigned, std::vector<char>>::iterator it = null_state->buffers.find(null_state->buffer_bindings[target]);
+	return it != null_state->buffers.end() ? &it->second : 0;
+}
+
+// The client memory of readbacks, or the bound pack buffer when the pointer is an offset.
+
+char * GLNullPixels(void * pixels, long long size) {
+	std::vector<char> * buffer = GLNullBuffer(GL_PIXEL_PACK_BUFFER);
+
+	if (!buffer) {
+		return (char *)pixels;
+	}
+
+	size_t offset = (size_t)pixels;
+	return offset + size <= buffer->size() ? buffer->data() + offset : 0;
+}
+
+GLNullTexture * GLNullBoundTexture(int target) {
+	if (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z) {
+		target = GL_TEXTURE_CUBE_MAP;
+	}
+
+	unsigned texture = null_state->texture_bindings[GLNullKey(null_state->active_texture, target)];
+	return texture ? &null_state->textures[texture] : 0;
+}
+
+void GLNullTextureLevels(int target, int levels, int width, int height, int depth) {
+	GLNullTexture * texture = GLNullBoundTexture(target);
+
+	if (!texture) {
+		return;
+	}
+
+	for (int level = 0; level < levels; ++level) {
+		texture->levels[level] = {width, height, depth};
+		width = width > 1 ? width / 2 : 1;
+		height = height > 1 ? height / 2 : 1;
+		depth = (depth > 1 && target == GL_TEXTURE_3D) ? depth / 2 : depth;
+	}
+}
+
+// A single pass over the shader source is enough for the declarations at file scope.
+// Interface blocks, structs and function bodies are skipped.
+
+struct GLNullType {
+	const char * name;
+	int type;
+	int columns;
+};
+
+static const GLNullType null_types[] = {
+	{"bool", GL_BOOL, 1},
+	{"bvec2", GL_BOOL_VEC2, 1},
+	{"bvec3", GL_BOOL_VEC3, 1},
+	{"bvec4", GL_BOOL_VEC4, 1},
+	{"int", GL_INT, 1},
+	{"ivec2", GL_INT_VEC2, 1},
+	{"ivec3", GL_INT_VEC3, 1},
+	{"ivec4", GL_INT_VEC4, 1},
+	{"uint", GL_UNSIGNED_INT, 1},
+	{"uvec2", GL_UNSIGNED_INT_VEC2, 1},
+	{"uvec3", GL_UNSIGNED_INT_VEC3, 1},
+	{"uvec4", GL_UNSIGNED_INT_VEC4, 1},
+	{"float", GL_FLOAT, 1},
+	{"vec2", GL_FLOAT_VEC2, 1},
+	{"vec3", GL_FLOAT_VEC3, 1},
+	{"vec4", GL_FLOAT_VEC4, 1},
+	{"double", GL_DOUBLE, 1},
+	{"dvec2", GL_DOUBLE_VEC2, 1},
+	{"dvec3", GL_DOUBLE_VEC3, 1},
+	{"dvec4", GL_DOUBLE_VEC4, 1},
+	{"mat2", GL_FLOAT_MAT2, 2},
+	{"mat2x2", GL_FLOAT_MAT2, 2},
+	{"mat2x3", GL_FLOAT_MAT2x3, 2},
+	{"mat2x4", GL_FLOAT_MAT2x4, 2},
+	{"mat3x2", GL_FLOAT_MAT3x2, 3},
+	{"mat3", GL_FLOAT_MAT3, 3},
+	{"mat3x3", GL_FLOAT_MAT3, 3},
+	{"mat3x4", GL_FLOAT_MAT3x4, 3},
+	{"mat4x2", GL_FLOAT_MAT4x2, 4},
+	{"mat4x3", GL_FLOAT_MAT4x3, 4},
+	{"mat4", GL_FLOAT_MAT4, 4},
+	{"mat4x4", GL_FLOAT_MAT4, 4},
+	{"dmat2", GL_DOUBLE_MAT2, 2},
+	{"dmat2x3", GL_DOUBLE_MAT2x3, 2},
+	{"dmat2x4", GL_DOUBLE_MAT2x4, 2},
+	{"dmat3x2", GL_DOUBLE_MAT3x2, 3},
+	{"dmat3", GL_DOUBLE_MAT3, 3},
+	{"dmat3x4", GL_DOUBLE_MAT3x4, 3},
+	{"dmat4x2", GL_DOUBLE_MAT4x2, 4},
+	{"dmat4x3", GL_DOUBLE_MAT4x3, 4},
+	{"dmat4", GL_DOUBLE_MAT4, 4},
+	{"sampler2D", GL_SAMPLER_2D, 1},
+	{"sampler3D", GL_SAMPLER_3D, 1},
+	{"samplerCube", GL_SAMPLER_CUBE, 1},
+	{"sampler2DShadow", GL_SAMPLER_2D_SHADOW, 1},
+	{"sampler2DArray", GL_SAMPLER_2D_ARRAY, 1},
+	{"sampler2DMS", GL_SAMPLER_2D_MULTISAMPLE, 1},
+	{0, 0, 0},
+};
+
+static const char * null_qualifiers[] = {
+	"const", "flat", "smooth", "noperspective", "centroid", "sample", "patch", "invariant", "precise",
+	"highp", "mediump", "lowp", "coherent", "volatile", "restrict", "readonly", "writeonly", 0,
+};
+
+void GLNullTokenize(const std::string & source, std::vector<std::string> & tokens) {
+	size_t i = 0;
+
+	while (i < source.size()) {
+		char c = source[i];
+
+		if (c == '/' && i + 1 < source.size() && source[i + 1] == '/') {
+			i = source.find('\n', i);
+		} else if (c == '/' && i + 1 < source.size() && source[i + 1] == '*') {
+			i = source.find("*/", i + 2);
+			i = i == std::string::npos ? i : i + 2;
+		} else if (c == '#') {
+			i = source.find('\n', i);
+		} else if (isalnum((unsigned char)c) || c == '_') {
+			size_t start = i;
+			while (i < source.size() && (isalnum((unsigned char)source[i]) || source[i] == '_')) {
+				++i;
+			}
+			tokens.push_back(source.substr(start, i - start));
+		} else {
+			if (!isspace((unsigned char)c)) {
+				tokens.push_back(std::string(1, c));
+			}
+			++i;
+		}
+	}
+}
+
+void GLNullDeclaration(const std::vector<std::string> & tokens, int stage, GLNullProgram & program, int & attribute_location, int & uniform_location) {
+	size_t i = 0;
+	int layout_location = -1;
+
+	while (i < tokens.size()) {
+		if (tokens[i] == "layout") {
+			for (i += 1; i < tokens.size() && tokens[i] != ")"; ++i) {
+				if (tokens[i] == "location" && i + 2 < tokens.size() && tokens[i + 1] == "=") {
+					layout_location = atoi(tokens[i + 2].c_str());
+				}
+			}
+			i += 1;
+			continue;
+		}
+
+		bool qualifier = false;
+		for (int q = 0; null_qualifiers[q]; ++q) {
+			qualifier = qualifier || tokens[i] == null_qualifiers[q];
+		}
+
+		if (!qualifier) {
+			break;
+		}
+
+		i += 1;
+	}
+
+	if (i + 2 >= tokens.size()) {
+		return;
+	}
+
+	bool uniform = tokens[i] == "uniform";
+	bool attribute = tokens[i] == "in" && stage == GL_VERTEX_SHADER;
+
+	if (!uniform && !attribute) {
+		return;
+	}
+
+	for (i += 1; i + 1 < tokens.size() && (tokens[i] == "highp" || tokens[i] == "mediump" || tokens[i] == "lowp"); ++i) {
+	}
+
+	const GLNullType * type = null_types;
+	while (type->name && tokens[i] != type->name) {
+		++type;
+	}
+
+	if (!type->name) {
+		return;
+	}
+
+	std::vector<GLNullVariable> & variables = uniform ? program.uniforms : program.attributes;
+	int & location = uniform ? uniform_location : attribute_location;
+
+	for (i += 1; i < tokens.size(); ++i) {
+		GLNullVariable variable = {tokens[i], type->type, 1, 0};
+
+		if (i + 3 < tokens.size() && tokens[i + 1] == "[" && tokens[i + 3] == "]") {
+			variable.size = atoi(tokens[i + 2].c_str());
+			variable.size = variable.size > 0 ? variable.size : 1;
+			i += 3;
+		}
+
+		for (size_t v = 0; v < variables.size(); ++v) {
+			if (variables[v].name == variable.name) {
+				variable.size = 0;
+			}
+		}
+
+		if (variable.size) {
+			variable.location = layout_location >= 0 ? layout_location : location;
+			location = variable.location + variable.size * (attribute ? type->columns : 1);
+			layout_location = -1;
+			variables.push_back(variable);
+		}
+
+		while (i < tokens.size() && tokens[i] != ",") {
+			++i;
+		}
+	}
+}
+
+void GLNullReflect(GLNullProgram & program) {
+	int attribute_location = 0;
+	int uniform_location = 0;
+
+	program.attributes.clear();
+	program.uniforms.clear();
+	program.uniform_blocks.clear();
+
+	for (size_t s = 0; s < program.shaders.size(); ++s) {
+		GLNullShader & shader = null_state->shaders[program.shaders[s]];
+
+		std::vector<std::string> tokens;
+		GLNullTokenize(shader.source, tokens);
+
+		std::vector<std::string> declaration;
+		int depth = 0;
+		bool block = false;
+
+		for (size_t i = 0; i < tokens.size(); ++i) {
+			const std::string & token = tokens[i];
+
+			if (token == "{") {
+				if (!depth) {
+					// Interface blocks end with a semicolon after the instance name, function bodies do not.
+					block = declaration.size() && (declaration[0] == "uniform" || declaration[0] == "buffer" || declaration[0] == "in" || declaration[0] == "out" || declaration[0] == "layout" || declaration[0] == "struct");
+					for (size_t t = 0; block && t + 1 < declaration.size(); ++t) {
+						if (declaration[t] == "uniform" && std::find(program.uniform_blocks.begin(), program.uniform_blocks.end(), declaration[t + 1]) == program.uniform_blocks.end()) {
+							program.uniform_blocks.push_back(declaration[t + 1]);
+						}
+					}
+					declaration.clear();
+				}
+				depth += 1;
+			} else if (token == "}") {
+				depth -= 1;
+			} else if (depth) {
+				continue;
+			} else if (token == ";") {
+				if (!block) {
+					GLNullDeclaration(declaration, shader.type, program, attribute_location, uniform_location);
+				}
+				declaration.clear();
+				block = false;
+			} else {
+				declaration.push_back(token);
+			}
+		}
+	}
+}
+
+int GLNullLocation(const std::vector<GLNullVariable> & variables, const char * name) {
+	std::string str(name);
+	int index = 0;
+
+	size_t bracket = str.find('[');
+	if (bracket != std::string::npos) {
+		index = atoi(str.c_str() + bracket + 1);
+		str = str.substr(0, bracket);
+	}
+
+	for (size_t i = 0; i < variables.size(); ++i) {
+		if (variables[i].name == str && index < variables[i].size) {
+			return variables[i].location + index;
+		}
+	}
+
+	return -1;
+}
+
+void GLNullActive(const std::vector<GLNullVariable> & variables, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+	if (index >= variables.size()) {
+		return;
+	}
+
+	const GLNullVariable & variable = variables[index];
+	std::string str = variable.size > 1 ? variable.name + "[0]" : variable.name;
+	int len = (int)str.size() < bufSize - 1 ? (int)str.size() : bufSize - 1;
+
+	memcpy(name, str.c_str(), len);
+	name[len] = 0;
+
+	if (length) {
+		*length = len;
+	}
+
+	*size = variable.size;
+	*type = variable.type;
+}
+
+template <int index, typename Proc>
+struct GLNullMethod;
+
+template <int index, typename Result, typename ... Args>
+struct GLNullMethod<index, Result (GLAPI *)(Args ...)> {
+	static Result GLAPI call(Args ... args) {
+		return Result();
+	}
+};
+
+#define GL_NULL(name) \
+	template <> \
+	struct GLNullMethod<GL_METHOD_##name, PROC_gl##name>
+
+#define GL_NULL_NAMES(name) \
+	GL_NULL(name) { \
+		static GLvoid GLAPI call(GLsizei n, GLuint * names) { \
+			for (int i = 0; i < n; ++i) { \
+				names[i] = null_state->next_name++; \
+			} \
+		} \
+	};
+
+GL_NULL_NAMES(GenBuffers)
+GL_NULL_NAMES(GenFramebuffers)
+GL_NULL_NAMES(GenProgramPipelines)
+GL_NULL_NAMES(GenQueries)
+GL_NULL_NAMES(GenRenderbuffers)
+GL_NULL_NAMES(GenSamplers)
+GL_NULL_NAMES(GenTextures)
+GL_NULL_NAMES(GenTransformFeedbacks)
+GL_NULL_NAMES(GenVertexArrays)
+
+GL_NULL(DeleteBuffers) {
+	static GLvoid GLAPI call(GLsizei n, const GLuint * buffers) {
+		for (int i = 0; i < n; ++i) {
+			null_state->buffers.erase(buffers[i]);
+		}
+	}
+};
+
+GL_NULL(DeleteTextures) {
+	static GLvoid GLAPI call(GLsizei n, const GLuint * textures) {
+		for (int i = 0; i < n; ++i) {
+			null_state->textures.erase(textures[i]);
+		}
+	}
+};
+
+GL_NULL(DeleteQueries) {
+	static GLvoid GLAPI call(GLsizei n, const GLuint * queries) {
+		for (int i = 0; i < n; ++i) {
+			null_state->queries.erase(queries[i]);
+		}
+	}
+};
+
+GL_NULL(BindBuffer) {
+	static GLvoid GLAPI call(GLenum target, GLuint buffer) {
+		null_state->buffer_bindings[target] = buffer;
+	}
+};
+
+GL_NULL(BindBufferBase) {
+	static GLvoid GLAPI call(GLenum target, GLuint index, GLuint buffer) {
+		null_state->buffer_bindings[target] = buffer;
+	}
+};
+
+GL_NULL(BindBufferRange) {
+	static GLvoid GLAPI call(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+		null_state->buffer_bindings[target] = buffer;
+	}
+};
+
+GL_NULL(BufferData) {
+	static GLvoid GLAPI call(GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage) {
+		unsigned buffer = null_state->buffer_bindings[target];
+		if (buffer) {
+			std::vector<char> & storage = null_state->buffers[buffer];
+			storage.assign(size, 0);
+			if (data) {
+				memcpy(storage.data(), data, size);
+			}
+		}
+	}
+};
+
+GL_NULL(BufferStorage) {
+	static GLvoid GLAPI call(GLenum target, GLsizeiptr size, const GLvoid * data, GLbitfield flags) {
+		GLNullMethod<GL_METHOD_BufferData, PROC_glBufferData>::call(target, size, data, 0);
+	}
+};
+
+GL_NULL(BufferSubData) {
+	static GLvoid GLAPI call(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid * data) {
+		std::vector<char> * storage = GLNullBuffer(target);
+		if (storage && offset >= 0 && offset + size <= (long long)storage->size()) {
+			memcpy(storage->data() + offset, data, size);
+		}
+	}
+};
+
+GL_NULL(GetBufferSubData) {
+	static GLvoid GLAPI call(GLenum target, GLintptr offset, GLsizeiptr size, GLvoid * data) {
+		std::vector<char> * storage = GLNullBuffer(target);
+		if (storage && offset >= 0 && offset + size <= (long long)storage->size()) {
+			memcpy(data, storage->data() + offset, size);
+		}
+	}
+};
+
+GL_NULL(CopyBufferSubData) {
+	static GLvoid GLAPI call(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+		std::vector<char> * src = GLNullBuffer(readTarget);
+		std::vector<char> * dst = GLNullBuffer(writeTarget);
+		if (src && dst && readOffset + size <= (long long)src->size() && writeOffset + size <= (long long)dst->size()) {
+			memmove(dst->data() + writeOffset, src->data() + readOffset, size);
+		}
+	}
+};
+
+GL_NULL(MapBufferRange) {
+	static GLvoid * GLAPI call(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+		std::vector<char> * storage = GLNullBuffer(target);
+		if (storage && offset >= 0 && offset + length <= (long long)storage->size()) {
+			return storage->data() + offset;
+		}
+		return 0;
+	}
+};
+
+GL_NULL(UnmapBuffer) {
+	static GLboolean GLAPI call(GLenum target) {
+		return GL_TRUE;
+	}
+};
+
+GL_NULL(ActiveTexture) {
+	static GLvoid GLAPI call(GLenum texture) {
+		null_state->active_texture = texture - GL_TEXTURE0;
+	}
+};
+
+GL_NULL(BindTexture) {
+	static GLvoid GLAPI call(GLenum target, GLuint texture) {
+		null_state->texture_bindings[GLNullKey(null_state->active_texture, target)] = texture;
+	}
+};
+
+GL_NULL(TexImage2D) {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid * pixels) {
+		GLNullTexture * texture = GLNullBoundTexture(target);
+		if (texture) {
+			texture->levels[level] = {width, height, 1};
+		}
+	}
+};
+
+GL_NULL(TexImage3D) {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels) {
+		GLNullTexture * texture = GLNullBoundTexture(target);
+		if (texture) {
+			texture->levels[level] = {width, height, depth};
+		}
+	}
+};
+
+GL_NULL(TexImage2DMultisample) {
+	static GLvoid GLAPI call(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+		GLNullTextureLevels(target, 1, width, height, 1);
+	}
+};
+
+GL_NULL(TexStorage2D) {
+	static GLvoid GLAPI call(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+		GLNullTextureLevels(target, levels, width, height, 1);
+	}
+};
+
+GL_NULL(TexStorage3D) {
+	static GLvoid GLAPI call(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+		GLNullTextureLevels(target, levels, width, height, depth);
+	}
+};
+
+GL_NULL(CompressedTexImage2D) {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data) {
+		GLNullTexture * texture = GLNullBoundTexture(target);
+		if (texture) {
+			texture->levels[level] = {width, height, 1};
+		}
+	}
+};
+
+GL_NULL(CompressedTexImage3D) {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data) {
+		GLNullTexture * texture = GLNullBoundTexture(target);
+		if (texture) {
+			texture->levels[level] = {width, height, depth};
+		}
+	}
+};
+
+GL_NULL(TexParameteri) {
+	static GLvoid GLAPI call(GLenum target, GLenum pname, GLint param) {
+		GLNullTexture * texture = GLNullBoundTexture(target);
+		if (texture) {
+			texture->parameters[pname] = param;
+		}
+	}
+};
+
+GL_NULL(GetTexParameteriv) {
+	static GLvoid GLAPI call(GLenum target, GLenum pname, GLint * params) {
+		GLNullTexture * texture = GLNullBoundTexture(target);
+		if (texture && texture->parameters.count(pname)) {
+			params[0] = texture->parameters[pname];
+			return;
+		}
+		switch (pname) {
+			case GL_TEXTURE_SWIZZLE_R: params[0] = GL_RED; break;
+			case GL_TEXTURE_SWIZZLE_G: params[0] = GL_GREEN; break;
+			case GL_TEXTURE_SWIZZLE_B: params[0] = GL_BLUE; break;
+			case GL_TEXTURE_SWIZZLE_A: params[0] = GL_ALPHA; break;
+			default: params[0] = 0; break;
+		}
+	}
+};
+
+GL_NULL(GetTexLevelParameteriv) {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLenum pname, GLint * params) {
+		GLNullTexture * texture = GLNullBoundTexture(target);
+		params[0] = 0;
+		if (!texture || !texture->levels.count(level)) {
+			return;
+		}
+		std::vector<int> & size = texture->levels[level];
+		switch (pname) {
+			case GL_TEXTURE_WIDTH: params[0] = size[0]; break;
+			case GL_TEXTURE_HEIGHT: params[0] = size[1]; break;
+			case GL_TEXTURE_DEPTH: params[0] = size[2]; break;
+		}
+	}
+};
+
+GL_NULL(PixelStorei) {
+	static GLvoid GLAPI call(GLenum pname, GLint param) {
+		null_state->integers[pname] = param;
+	}
+};
+
+GL_NULL(BindFramebuffer) {
+	static GLvoid GLAPI call(GLenum target, GLuint framebuffer) {
+		if (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER) {
+			null_state->integers[GL_DRAW_FRAMEBUFFER_BINDING] = framebuffer;
+		}
+		if (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER) {
+			null_state->integers[GL_READ_FRAMEBUFFER_BINDING] = framebuffer;
+		}
+	}
+};
+
+GL_NULL(CheckFramebufferStatus) {
+	static GLenum GLAPI call(GLenum target) {
+		return GL_FRAMEBUFFER_COMPLETE;
+	}
+};
+
+GL_NULL(GetFramebufferAttachmentParameteriv) {
+	static GLvoid GLAPI call(GLenum target, GLenum attachment, GLenum pname, GLint * params) {
+		switch (pname) {
+			case GL_FRAMEBUFFER_ATTACHMENT_RED_SIZE:
+			case GL_FRAMEBUFFER_ATTACHMENT_GREEN_SIZE:
+			case GL_FRAMEBUFFER_ATTACHMENT_BLUE_SIZE:
+			case GL_FRAMEBUFFER_ATTACHMENT_ALPHA_SIZE:
+			case GL_FRAMEBUFFER_ATTACHMENT_STENCIL_SIZE:
+				params[0] = 8;
+				break;
+			case GL_FRAMEBUFFER_ATTACHMENT_DEPTH_SIZE:
+				params[0] = 24;
+				break;
+			default:
+				params[0] = 0;
+				break;
+		}
+	}
+};
+
+GL_NULL(GetRenderbufferParameteriv) {
+	static GLvoid GLAPI call(GLenum target, GLenum pname, GLint * params) {
+		params[0] = 0;
+	}
+};
+
+GL_NULL(Viewport) {
+	static GLvoid GLAPI call(GLint x, GLint y, GLsizei width, GLsizei height) {
+		int viewport[4] = {x, y, width, height};
+		memcpy(null_state->viewport, viewport, sizeof(viewport));
+	}
+};
+
+GL_NULL(Scissor) {
+	static GLvoid GLAPI call(GLint x, GLint y, GLsizei width, GLsizei height) {
+		int scissor_box[4] = {x, y, width, height};
+		memcpy(null_state->scissor_box, scissor_box, sizeof(scissor_box));
+	}
+};
+
+GL_NULL(CreateShader) {
+	static GLuint GLAPI call(GLenum type) {
+		GLuint shader = null_state->next_name++;
+		null_state->shaders[shader].type = type;
+		return shader;
+	}
+};
+
+GL_NULL(CreateProgram) {
+	static GLuint GLAPI call() {
+		GLuint program = null_state->next_name++;
+		null_state->programs[program];
+		return program;
+	}
+};
+
+GL_NULL(DeleteShader) {
+	static GLvoid GLAPI call(GLuint shader) {
+		null_state->shaders.erase(shader);
+	}
+};
+
+GL_NULL(DeleteProgram) {
+	static GLvoid GLAPI call(GLuint program) {
+		null_state->programs.erase(program);
+	}
+};
+
+GL_NULL(ShaderSource) {
+	static GLvoid GLAPI call(GLuint shader, GLsizei count, const GLchar * const * string, const GLint * length) {
+		std::string & source = null_state->shaders[shader].source;
+		source.clear();
+		for (int i = 0; i < count; ++i) {
+			source.append(string[i], (length && length[i] >= 0) ? length[i] : strlen(string[i]));
+		}
+	}
+};
+
+GL_NULL(AttachShader) {
+	static GLvoid GLAPI call(GLuint program, GLuint shader) {
+		null_state->programs[program].shaders.push_back(shader);
+	}
+};
+
+GL_NULL(LinkProgram) {
+	static GLvoid GLAPI call(GLuint program) {
+		GLNullReflect(null_state->programs[program]);
+	}
+};
+
+GL_NULL(TransformFeedbackVaryings) {
+	static GLvoid GLAPI call(GLuint program, GLsizei count, const GLchar * const * varyings, GLenum bufferMode) {
+		std::vector<std::string> & names = null_state->programs[program].varyings;
+		names.assign(varyings, varyings + count);
+	}
+};
+
+GL_NULL(GetShaderiv) {
+	static GLvoid GLAPI call(GLuint shader, GLenum pname, GLint * params) {
+		params[0] = pname == GL_COMPILE_STATUS ? GL_TRUE : 0;
+	}
+};
+
+GL_NULL(GetProgramiv) {
+	static GLvoid GLAPI call(GLuint program, GLenum pname, GLint * params) {
+		GLNullProgram & state = null_state->programs[program];
+		switch (pname) {
+			case GL_LINK_STATUS: params[0] = GL_TRUE; break;
+			case GL_ACTIVE_ATTRIBUTES: params[0] = (int)state.attributes.size(); break;
+			case GL_ACTIVE_UNIFORMS: params[0] = (int)state.uniforms.size(); break;
+			case GL_ACTIVE_UNIFORM_BLOCKS: params[0] = (int)state.uniform_blocks.size(); break;
+			case GL_TRANSFORM_FEEDBACK_VARYINGS: params[0] = (int)state.varyings.size(); break;
+			default: params[0] = 0; break;
+		}
+	}
+};
+
+GL_NULL(GetActiveAttrib) {
+	static GLvoid GLAPI call(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+		GLNullActive(null_state->programs[program].attributes, index, bufSize, length, size, type, name);
+	}
+};
+
+GL_NULL(GetActiveUniform) {
+	static GLvoid GLAPI call(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+		GLNullActive(null_state->programs[program].uniforms, index, bufSize, length, size, type, name);
+	}
+};
+
+GL_NULL(GetTransformFeedbackVarying) {
+	static GLvoid GLAPI call(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name) {
+		std::vector<std::string> & varyings = null_state->programs[program].varyings;
+		std::vector<GLNullVariable> variables;
+		for (size_t i = 0; i < varyings.size(); ++i) {
+			GLNullVariable variable = {varyings[i], 0, 1, 0};
+			variables.push_back(variable);
+		}
+		GLNullActive(variables, index, bufSize, length, size, type, name);
+	}
+};
+
+GL_NULL(GetAttribLocation) {
+	static GLint GLAPI call(GLuint program, const GLchar * name) {
+		return GLNullLocation(null_state->programs[program].attributes, name);
+	}
+};
+
+GL_NULL(GetUniformLocation) {
+	static GLint GLAPI call(GLuint program, const GLchar * name) {
+		return GLNullLocation(null_state->programs[program].uniforms, name);
+	}
+};
+
+GL_NULL(GetActiveUniformBlockName) {
+	static GLvoid GLAPI call(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformBlockName) {
+		std::vector<std::string> & blocks = null_state->programs[program].uniform_blocks;
+		std::vector<GLNullVariable> variables;
+		for (size_t i = 0; i < blocks.size(); ++i) {
+			GLNullVariable variable = {blocks[i], 0, 1, 0};
+			variables.push_back(variable);
+		}
+		GLint size = 0;
+		GLenum type = 0;
+		GLNullActive(variables, uniformBlockIndex, bufSize, length, &size, &type, uniformBlockName);
+	}
+};
+
+GL_NULL(GetUniformBlockIndex) {
+	static GLuint GLAPI call(GLuint program, const GLchar * uniformBlockName) {
+		std::vector<std::string> & blocks = null_state->programs[program].uniform_blocks;
+		std::vector<std::string>::iterator it = std::find(blocks.begin(), blocks.end(), uniformBlockName);
+		return it != blocks.end() ? (GLuint)(it - blocks.begin()) : GL_INVALID_INDEX;
+	}
+};
+
+GL_NULL(GetSubroutineIndex) {
+	static GLuint GLAPI call(GLuint program, GLenum shadertype, const GLchar * name) {
+		return GL_INVALID_INDEX;
+	}
+};
+
+GL_NULL(GetSubroutineUniformLocation) {
+	static GLint GLAPI call(GLuint program, GLenum shadertype, const GLchar * name) {
+		return -1;
+	}
+};
+
+GL_NULL(GetProgramStageiv) {
+	static GLvoid GLAPI call(GLuint program, GLenum shadertype, GLenum pname, GLint * values) {
+		values[0] = 0;
+	}
+};
+
+GL_NULL(GetProgramInterfaceiv) {
+	static GLvoid GLAPI call(GLuint program, GLenum programInterface, GLenum pname, GLint * params) {
+		params[0] = 0;
+	}
+};
+
+GL_NULL(GetActiveUniformBlockiv) {
+	static GLvoid GLAPI call(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params) {
+		params[0] = 0;
+	}
+};
+
+// The uniform values are stored per location, an array element is at the location of the array plus its index.
+
+template <typename T, int components>
+void GLNullUniform(GLuint program, GLint location, GLsizei count, const T * value) {
+	for (int i = 0; i < count; ++i) {
+		const char * data = (const char *)(value + i * components);
+		null_state->uniforms[GLNullKey(program, location + i)].assign(data, data + components * sizeof(T));
+	}
+}
+
+template <typename T>
+void GLNullGetUniform(GLuint program, GLint location, T * params) {
+	std::unordered_map<long long, std::vector<char>>::iterator it = null_state->uniforms.find(GLNullKey(program, location));
+	if (it != null_state->uniforms.end()) {
+		memcpy(params, it->second.data(), it->second.size());
+	} else {
+		params[0] = T();
+	}
+}
+
+#define GL_NULL_UNIFORM(name, Type, components) \
+	GL_NULL(name) { \
+		static GLvoid GLAPI call(GLuint program, GLint location, GLsizei count, const Type * value) { \
+			GLNullUniform<Type, components>(program, location, count, value); \
+		} \
+	};
+
+#define GL_NULL_UNIFORM_MATRIX(name, Type, components) \
+	GL_NULL(name) { \
+		static GLvoid GLAPI call(GLuint program, GLint location, GLsizei count, GLboolean transpose, const Type * value) { \
+			GLNullUniform<Type, components>(program, location, count, value); \
+		} \
+	};
+
+#define GL_NULL_GET_UNIFORM(name, Type) \
+	GL_NULL(name) { \
+		static GLvoid GLAPI call(GLuint program, GLint location, Type * params) { \
+			GLNullGetUniform(program, location, params); \
+		} \
+	};
+
+GL_NULL_UNIFORM(ProgramUniform1iv, GLint, 1)
+GL_NULL_UNIFORM(ProgramUniform2iv, GLint, 2)
+GL_NULL_UNIFORM(ProgramUniform3iv, GLint, 3)
+GL_NULL_UNIFORM(ProgramUniform4iv, GLint, 4)
+GL_NULL_UNIFORM(ProgramUniform1uiv, GLuint, 1)
+GL_NULL_UNIFORM(ProgramUniform2uiv, GLuint, 2)
+GL_NULL_UNIFORM(ProgramUniform3uiv, GLuint, 3)
+GL_NULL_UNIFORM(ProgramUniform4uiv, GLuint, 4)
+GL_NULL_UNIFORM(ProgramUniform1fv, GLfloat, 1)
+GL_NULL_UNIFORM(ProgramUniform2fv, GLfloat, 2)
+GL_NULL_UNIFORM(ProgramUniform3fv, GLfloat, 3)
+GL_NULL_UNIFORM(ProgramUniform4fv, GLfloat, 4)
+GL_NULL_UNIFORM(ProgramUniform1dv, GLdouble, 1)
+GL_NULL_UNIFORM(ProgramUniform2dv, GLdouble, 2)
+GL_NULL_UNIFORM(ProgramUniform3dv, GLdouble, 3)
+GL_NULL_UNIFORM(ProgramUniform4dv, GLdouble, 4)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix2fv, GLfloat, 4)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix3fv, GLfloat, 9)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix4fv, GLfloat, 16)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix2x3fv, GLfloat, 6)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix2x4fv, GLfloat, 8)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix3x2fv, GLfloat, 6)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix3x4fv, GLfloat, 12)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix4x2fv, GLfloat, 8)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix4x3fv, GLfloat, 12)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix2dv, GLdouble, 4)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix3dv, GLdouble, 9)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix4dv, GLdouble, 16)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix2x3dv, GLdouble, 6)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix2x4dv, GLdouble, 8)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix3x2dv, GLdouble, 6)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix3x4dv, GLdouble, 12)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix4x2dv, GLdouble, 8)
+GL_NULL_UNIFORM_MATRIX(ProgramUniformMatrix4x3dv, GLdouble, 12)
+GL_NULL_GET_UNIFORM(GetUniformiv, GLint)
+GL_NULL_GET_UNIFORM(GetUniformuiv, GLuint)
+GL_NULL_GET_UNIFORM(GetUniformfv, GLfloat)
+GL_NULL_GET_UNIFORM(GetUniformdv, GLdouble)
+
+// The queries measure the time on the CPU, the other counters are zero.
+
+GL_NULL(BeginQuery) {
+	static GLvoid GLAPI call(GLenum target, GLuint id) {
+		null_state->query_bindings[target] = id;
+		null_state->queries[id].start = GLNullNow();
+	}
+};
+
+GL_NULL(EndQuery) {
+	static GLvoid GLAPI call(GLenum target) {
+		GLNullQuery & query = null_state->queries[null_state->query_bindings[target]];
+		query.result = target == GL_TIME_ELAPSED ? GLNullNow() - query.start : 0;
+		null_state->query_bindings.erase(target);
+	}
+};
+
+GL_NULL(QueryCounter) {
+	static GLvoid GLAPI call(GLuint id, GLenum target) {
+		null_state->queries[id].result = GLNullNow();
+	}
+};
+
+template <typename T>
+void GLNullQueryResult(GLuint id, GLenum pname, T * params) {
+	params[0] = pname == GL_QUERY_RESULT_AVAILABLE ? 1 : (T)null_state->queries[id].result;
+}
+
+GL_NULL(GetQueryObjectiv) {
+	static GLvoid GLAPI call(GLuint id, GLenum pname, GLint * params) {
+		GLNullQueryResult(id, pname, params);
+	}
+};
+
+GL_NULL(GetQueryObjectuiv) {
+	static GLvoid GLAPI call(GLuint id, GLenum pname, GLuint * params) {
+		GLNullQueryResult(id, pname, params);
+	}
+};
+
+GL_NULL(GetQueryObjecti64v) {
+	static GLvoid GLAPI call(GLuint id, GLenum pname, GLint64 * params) {
+		GLNullQueryResult(id, pname, params);
+	}
+};
+
+GL_NULL(GetQueryObjectui64v) {
+	static GLvoid GLAPI call(GLuint id, GLenum pname, GLuint64 * params) {
+		GLNullQueryResult(id, pname, params);
+	}
+};
+
+GL_NULL(GetString) {
+	static const GLubyte * GLAPI call(GLenum name) {
+		switch (name) {
+			case GL_VENDOR: return (const GLubyte *)"moderngl";
+			case GL_RENDERER: return (const GLubyte *)"null";
+			case GL_VERSION: return (const GLubyte *)"4.6.0 null";
+			case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte *)"4.60";
+		}
+		return 0;
+	}
+};
+
+GL_NULL(GetIntegerv) {
+	static GLvoid GLAPI call(GLenum pname, GLint * data) {
+		std::unordered_map<int, int>::iterator it = null_state->integers.find(pname);
+
+		if (it != null_state->integers.end()) {
+			data[0] = it->second;
+			return;
+		}
+
+		switch (pname) {
+			case GL_MAJOR_VERSION: data[0] = 4; break;
+			case GL_MINOR_VERSION: data[0] = 6; break;
+			case GL_CONTEXT_PROFILE_MASK: data[0] = GL_CONTEXT_CORE_PROFILE_BIT; break;
+			case GL_PACK_ALIGNMENT: data[0] = 4; break;
+			case GL_UNPACK_ALIGNMENT: data[0] = 4; break;
+			case GL_DRAW_BUFFER: data[0] = GL_BACK; break;
+			case GL_PATCH_VERTICES: data[0] = 3; break;
+			case GL_MAX_SAMPLES: data[0] = 8; break;
+			case GL_MAX_INTEGER_SAMPLES: data[0] = 8; break;
+			case GL_MAX_COLOR_TEXTURE_SAMPLES: data[0] = 8; break;
+			case GL_MAX_DEPTH_TEXTURE_SAMPLES: data[0] = 8; break;
+			case GL_MAX_FRAMEBUFFER_SAMPLES: data[0] = 8; break;
+			case GL_MAX_COLOR_ATTACHMENTS: data[0] = 8; break;
+			case GL_MAX_DRAW_BUFFERS: data[0] = 8; break;
+			case GL_MAX_TEXTURE_IMAGE_UNITS: data[0] = 32; break;
+			case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS: data[0] = 192; break;
+			case GL_MAX_VERTEX_ATTRIBS: data[0] = 16; break;
+			case GL_MAX_UNIFORM_BUFFER_BINDINGS: data[0] = 36; break;
+			case GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS: data[0] = 16; break;
+			case GL_MAX_UNIFORM_BLOCK_SIZE: data[0] = 65536; break;
+			case GL_MAX_TEXTURE_SIZE: data[0] = 16384; break;
+			case GL_MAX_CUBE_MAP_TEXTURE_SIZE: data[0] = 16384; break;
+			case GL_MAX_RENDERBUFFER_SIZE: data[0] = 16384; break;
+			case GL_MAX_3D_TEXTURE_SIZE: data[0] = 2048; break;
+			case GL_MAX_ARRAY_TEXTURE_LAYERS: data[0] = 2048; break;
+			case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT: data[0] = 256; break;
+			case GL_MIN_MAP_BUFFER_ALIGNMENT: data[0] = 64; break;
+			case GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT: data[0] = 256; break;
+			case GL_MAX_FRAMEBUFFER_WIDTH: data[0] = 16384; break;
+			case GL_MAX_FRAMEBUFFER_HEIGHT: data[0] = 16384; break;
+			case GL_MAX_FRAMEBUFFER_LAYERS: data[0] = 2048; break;
+			case GL_MAX_UNIFORM_LOCATIONS: data[0] = 1024; break;
+			case GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS: data[0] = 1024; break;
+			case GL_MAX_COMPUTE_SHARED_MEMORY_SIZE: data[0] = 32768; break;
+			case GL_MAX_COMPUTE_UNIFORM_BLOCKS: data[0] = 14; break;
+			case GL_MAX_COMPUTE_UNIFORM_COMPONENTS: data[0] = 1024; break;
+			case GL_MAX_COMBINED_COMPUTE_UNIFORM_COMPONENTS: data[0] = 230400; break;
+			case GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS: data[0] = 16; break;
+			case GL_MAX_COMPUTE_IMAGE_UNIFORMS: data[0] = 8; break;
+			case GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS: data[0] = 8; break;
+			case GL_MAX_COMPUTE_ATOMIC_COUNTERS: data[0] = 8; break;
+			case GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS: data[0] = 1; break;
+			case GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS: data[0] = 8; break;
+			case GL_MAX_COMBINED_SHADER_STORAGE_BLOCKS: data[0] = 8; break;
+			case GL_MAX_IMAGE_UNITS: data[0] = 8; break;
+			case GL_MAX_COMBINED_IMAGE_UNIFORMS: data[0] = 8; break;
+			case GL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS: data[0] = 1; break;
+			case GL_MAX_ATOMIC_COUNTER_BUFFER_SIZE: data[0] = 32; break;
+			case GL_MAX_COMBINED_ATOMIC_COUNTERS: data[0] = 8; break;
+			case GL_MAX_VIEWPORT_DIMS: data[0] = 16384; data[1] = 16384; break;
+			case GL_VIEWPORT_BOUNDS_RANGE: data[0] = -32768; data[1] = 32767; break;
+			case GL_VIEWPORT: memcpy(data, null_state->viewport, sizeof(null_state->viewport)); break;
+			case GL_SCISSOR_BOX: memcpy(data, null_state->scissor_box, sizeof(null_state->scissor_box)); break;
+			case GL_ARRAY_BUFFER_BINDING: data[0] = null_state->buffer_bindings[GL_ARRAY_BUFFER]; break;
+			case GL_ELEMENT_ARRAY_BUFFER_BINDING: data[0] = null_state->buffer_bindings[GL_ELEMENT_ARRAY_BUFFER]; break;
+			case GL_PIXEL_PACK_BUFFER_BINDING: data[0] = null_state->buffer_bindings[GL_PIXEL_PACK_BUFFER]; break;
+			case GL_PIXEL_UNPACK_BUFFER_BINDING: data[0] = null_state->buffer_bindings[GL_PIXEL_UNPACK_BUFFER]; break;
+			default: data[0] = 0; break;
+		}
+	}
+};
+
+GL_NULL(GetIntegeri_v) {
+	static GLvoid GLAPI call(GLenum target, GLuint index, GLint * data) {
+		switch (target) {
+			case GL_MAX_COMPUTE_WORK_GROUP_COUNT: data[0] = 65535; break;
+			case GL_MAX_COMPUTE_WORK_GROUP_SIZE: data[0] = index < 2 ? 1024 : 64; break;
+			default: data[0] = 0; break;
+		}
+	}
+};
+
+GL_NULL(GetInteger64v) {
+	static GLvoid GLAPI call(GLenum pname, GLint64 * data) {
+		switch (pname) {
+			case GL_TIMESTAMP: data[0] = GLNullNow(); break;
+			case GL_MAX_ELEMENT_INDEX: data[0] = 0xFFFFFFFF; break;
+			case GL_MAX_SHADER_STORAGE_BLOCK_SIZE: data[0] = 1 << 27; break;
+			default: data[0] = 0; break;
+		}
+	}
+};
+
+GL_NULL(GetFloatv) {
+	static GLvoid GLAPI call(GLenum pname, GLfloat * data) {
+		switch (pname) {
+			case GL_MAX_TEXTURE_MAX_ANISOTROPY: data[0] = 16.0f; break;
+			case GL_LINE_WIDTH: data[0] = 1.0f; break;
+			case GL_POINT_SIZE: data[0] = 1.0f; break;
+			case GL_ALIASED_LINE_WIDTH_RANGE:
+			case GL_SMOOTH_LINE_WIDTH_RANGE:
+			case GL_POINT_SIZE_RANGE:
+				data[0] = 1.0f;
+				data[1] = 1.0f;
+				break;
+			default: data[0] = 0.0f; break;
+		}
+	}
+};
+
+GL_NULL(GetBooleanv) {
+	static GLvoid GLAPI call(GLenum pname, GLboolean * data) {
+		data[0] = GL_FALSE;
+	}
+};
+
+GL_NULL(GetInternalformativ) {
+	static GLvoid GLAPI call(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint * params) {
+		params[0] = pname == GL_INTERNALFORMAT_SUPPORTED ? GL_TRUE : 0;
+	}
+};
+
+// The readbacks honour the pack parameters like the drivers.
+
+GL_NULL(GetTexImage) {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLenum format, GLenum type, GLvoid * pixels) {
+		GLNullTexture * texture = GLNullBoundTexture(target);
+		if (!texture || !texture->levels.count(level)) {
+			return;
+		}
+		std::vector<int> & size = texture->levels[level];
+		long long bytes = pixel_transfer_size(GLNullMethod<GL_METHOD_GetIntegerv, PROC_glGetIntegerv>::call, true, size[0], size[1], size[2], format, type);
+		char * ptr = GLNullPixels(pixels, bytes);
+		if (ptr) {
+			memset(ptr, 0, bytes);
+		}
+	}
+};
+
+GL_NULL(ReadPixels) {
+	static GLvoid GLAPI call(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid * pixels) {
+		long long bytes = pixel_transfer_size(GLNullMethod<GL_METHOD_GetIntegerv, PROC_glGetIntegerv>::call, true, width, height, 1, format, type);
+		char * ptr = GLNullPixels(pixels, bytes);
+		if (ptr) {
+			memset(ptr, 0, bytes);
+		}
+	}
+};
+
+void LoadNullMethods(GLMethods & gl, PyObject * settings) {
+	if (!null_state) {
+		null_state = new GLNull();
+		null_state->next_name = 1;
+		null_state->active_texture = 0;
+	}
+
+	int width = 1;
+	int height = 1;
+	PyObject * size_hint = (settings != Py_None) ? PyDict_GetItemString(settings, "size") : 0;
+	if (size_hint && Py_TYPE(size_hint) == &PyTuple_Type && PyTuple_GET_SIZE(size_hint) == 2) {
+		width = PyLong_AsLong(PyTuple_GET_ITEM(size_hint, 0));
+		height = PyLong_AsLong(PyTuple_GET_ITEM(size_hint, 1));
+	}
+
+	int viewport[4] = {0, 0, width, height};
+	memcpy(null_state->viewport, viewport, sizeof(viewport));
+	memcpy(null_state->scissor_box, viewport, sizeof(viewport));
+	null_state->integers.erase(GL_DRAW_FRAMEBUFFER_BINDING);
+	null_state->integers.erase(GL_READ_FRAMEBUFFER_BINDING);
+
+#define GL_NULL_LOAD(name) gl.name = GLNullMethod<GL_METHOD_##name, PROC_gl##name>::call;
+
+	GL_METHOD_LIST(GL_NULL_LOAD)
+
+#undef GL_NULL_LOAD
+}
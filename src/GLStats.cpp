@@ -0,0 +1,383 @@
+#include "Types.hpp"
+
+#include "GLMethodList.hpp"
+
+#include <chrono>
+#include <vector>
+
+struct GLStatsEntry {
+	long long calls;
+	long long time;
+	long long upload_bytes;
+	long long readback_bytes;
+};
+
+struct GLStats {
+	void * original[NUM_GL_METHODS];
+	GLStatsEntry functions[NUM_GL_METHODS];
+	GLStatsEntry frame;
+	std::vector<GLStatsEntry> frames;
+	size_t next_frame;
+};
+
+// Only the most recent frames are kept, the oldest frame is overwritten when the history is full.
+
+static const size_t MAX_STATS_FRAMES = 4096;
+
+// The wrappers have no context argument, only the stats of a single context are recorded at a time.
+// Objects look up their methods in the table of the context on every call and never keep a wrapper.
+
+static GLStats * active_stats;
+
+#define GL_ORIGINAL(name) ((PROC_gl##name)active_stats->original[GL_METHOD_##name])
+
+inline long long GLStatsNow() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline void GLStatsAdd(GLStatsEntry & entry, long long time, long long upload_bytes, long long readback_bytes) {
+	entry.calls += 1;
+	entry.time += time;
+	entry.upload_bytes += upload_bytes;
+	entry.readback_bytes += readback_bytes;
+}
+
+// Records a call when the wrapper returns, the time includes the original method only.
+// The bytes are counted before the record is created, the queries they need are not timed.
+
+struct GLStatsCall {
+	int index;
+	long long upload_bytes;
+	long long readback_bytes;
+	long long start;
+
+	GLStatsCall(int index, long long upload_bytes = 0, long long readback_bytes = 0) : index(index), upload_bytes(upload_bytes), readback_bytes(readback_bytes), start(GLStatsNow()) {
+	}
+
+	~GLStatsCall() {
+		long long time = GLStatsNow() - start;
+		GLStatsAdd(active_stats->functions[index], time, upload_bytes, readback_bytes);
+		GLStatsAdd(active_stats->frame, time, upload_bytes, readback_bytes);
+	}
+};
+
+template <int index, typename Proc>
+struct GLStatsWrapper;
+
+template <int index, typename Result, typename ... Args>
+struct GLStatsWrapper<index, Result (GLAPI *)(Args ...)> {
+	static Result GLAPI call(Args ... args) {
+		GLStatsCall record(index);
+		return ((Result (GLAPI *)(Args ...))active_stats->original[index])(args ...);
+	}
+};
+
+// A pixel pointer is an offset into the bound pixel buffer, those transfers do not touch client memory.
+
+bool GLStatsClientPixels(const void * pixels, GLenum binding) {
+	if (!pixels) {
+		return false;
+	}
+
+	int buffer = 0;
+	GL_ORIGINAL(GetIntegerv)(binding, &buffer);
+	return !buffer;
+}
+
+template <>
+struct GLStatsWrapper<GL_METHOD_BufferData, PROC_glBufferData> {
+	static GLvoid GLAPI call(GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage) {
+		GLStatsCall record(GL_METHOD_BufferData, data ? size : 0);
+		GL_ORIGINAL(BufferData)(target, size, data, usage);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_BufferSubData, PROC_glBufferSubData> {
+	static GLvoid GLAPI call(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid * data) {
+		GLStatsCall record(GL_METHOD_BufferSubData, size);
+		GL_ORIGINAL(BufferSubData)(target, offset, size, data);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_BufferStorage, PROC_glBufferStorage> {
+	static GLvoid GLAPI call(GLenum target, GLsizeiptr size, const GLvoid * data, GLbitfield flags) {
+		GLStatsCall record(GL_METHOD_BufferStorage, data ? size : 0);
+		GL_ORIGINAL(BufferStorage)(target, size, data, flags);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_GetBufferSubData, PROC_glGetBufferSubData> {
+	static GLvoid GLAPI call(GLenum target, GLintptr offset, GLsizeiptr size, GLvoid * data) {
+		GLStatsCall record(GL_METHOD_GetBufferSubData, 0, size);
+		GL_ORIGINAL(GetBufferSubData)(target, offset, size, data);
+	}
+};
+
+// Mapped ranges are counted as transferred by the access of the map.
+
+template <>
+struct GLStatsWrapper<GL_METHOD_MapBufferRange, PROC_glMapBufferRange> {
+	static GLvoid * GLAPI call(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+		GLStatsCall record(GL_METHOD_MapBufferRange, (access & GL_MAP_WRITE_BIT) ? length : 0, (access & GL_MAP_READ_BIT) ? length : 0);
+		return GL_ORIGINAL(MapBufferRange)(target, offset, length, access);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_TexImage2D, PROC_glTexImage2D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid * pixels) {
+		long long upload_bytes = GLStatsClientPixels(pixels, GL_PIXEL_UNPACK_BUFFER_BINDING) ? pixel_transfer_size(GL_ORIGINAL(GetIntegerv), false, width, height, 1, format, type) : 0;
+		GLStatsCall record(GL_METHOD_TexImage2D, upload_bytes);
+		GL_ORIGINAL(TexImage2D)(target, level, internalformat, width, height, border, format, type, pixels);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_TexImage3D, PROC_glTexImage3D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels) {
+		long long upload_bytes = GLStatsClientPixels(pixels, GL_PIXEL_UNPACK_BUFFER_BINDING) ? pixel_transfer_size(GL_ORIGINAL(GetIntegerv), false, width, height, depth, format, type) : 0;
+		GLStatsCall record(GL_METHOD_TexImage3D, upload_bytes);
+		GL_ORIGINAL(TexImage3D)(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_TexSubImage2D, PROC_glTexSubImage2D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels) {
+		long long upload_bytes = GLStatsClientPixels(pixels, GL_PIXEL_UNPACK_BUFFER_BINDING) ? pixel_transfer_size(GL_ORIGINAL(GetIntegerv), false, width, height, 1, format, type) : 0;
+		GLStatsCall record(GL_METHOD_TexSubImage2D, upload_bytes);
+		GL_ORIGINAL(TexSubImage2D)(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_TexSubImage3D, PROC_glTexSubImage3D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * pixels) {
+		long long upload_bytes = GLStatsClientPixels(pixels, GL_PIXEL_UNPACK_BUFFER_BINDING) ? pixel_transfer_size(GL_ORIGINAL(GetIntegerv), false, width, height, depth, format, type) : 0;
+		GLStatsCall record(GL_METHOD_TexSubImage3D, upload_bytes);
+		GL_ORIGINAL(TexSubImage3D)(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_CompressedTexImage2D, PROC_glCompressedTexImage2D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data) {
+		long long upload_bytes = GLStatsClientPixels(data, GL_PIXEL_UNPACK_BUFFER_BINDING) ? imageSize : 0;
+		GLStatsCall record(GL_METHOD_CompressedTexImage2D, upload_bytes);
+		GL_ORIGINAL(CompressedTexImage2D)(target, level, internalformat, width, height, border, imageSize, data);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_CompressedTexImage3D, PROC_glCompressedTexImage3D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data) {
+		long long upload_bytes = GLStatsClientPixels(data, GL_PIXEL_UNPACK_BUFFER_BINDING) ? imageSize : 0;
+		GLStatsCall record(GL_METHOD_CompressedTexImage3D, upload_bytes);
+		GL_ORIGINAL(CompressedTexImage3D)(target, level, internalformat, width, height, depth, border, imageSize, data);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_CompressedTexSubImage2D, PROC_glCompressedTexSubImage2D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data) {
+		long long upload_bytes = GLStatsClientPixels(data, GL_PIXEL_UNPACK_BUFFER_BINDING) ? imageSize : 0;
+		GLStatsCall record(GL_METHOD_CompressedTexSubImage2D, upload_bytes);
+		GL_ORIGINAL(CompressedTexSubImage2D)(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_CompressedTexSubImage3D, PROC_glCompressedTexSubImage3D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data) {
+		long long upload_bytes = GLStatsClientPixels(data, GL_PIXEL_UNPACK_BUFFER_BINDING) ? imageSize : 0;
+		GLStatsCall record(GL_METHOD_CompressedTexSubImage3D, upload_bytes);
+		GL_ORIGINAL(CompressedTexSubImage3D)(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_ReadPixels, PROC_glReadPixels> {
+	static GLvoid GLAPI call(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid * pixels) {
+		long long readback_bytes = GLStatsClientPixels(pixels, GL_PIXEL_PACK_BUFFER_BINDING) ? pixel_transfer_size(GL_ORIGINAL(GetIntegerv), true, width, height, 1, format, type) : 0;
+		GLStatsCall record(GL_METHOD_ReadPixels, 0, readback_bytes);
+		GL_ORIGINAL(ReadPixels)(x, y, width, height, format, type, pixels);
+	}
+};
+
+template <>
+struct GLStatsWrapper<GL_METHOD_GetTexImage, PROC_glGetTexImage> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLenum format, GLenum type, GLvoid * pixels) {
+		long long readback_bytes = 0;
+		if (GLStatsClientPixels(pixels, GL_PIXEL_PACK_BUFFER_BINDING)) {
+			int width = 0;
+			int height = 0;
+			int depth = 0;
+			GL_ORIGINAL(GetTexLevelParameteriv)(target, level, GL_TEXTURE_WIDTH, &width);
+			GL_ORIGINAL(GetTexLevelParameteriv)(target, level, GL_TEXTURE_HEIGHT, &height);
+			GL_ORIGINAL(GetTexLevelParameteriv)(target, level, GL_TEXTURE_DEPTH, &depth);
+			readback_bytes = pixel_transfer_size(GL_ORIGINAL(GetIntegerv), true, width, height, depth, format, type);
+		}
+		GLStatsCall record(GL_METHOD_GetTexImage, 0, readback_bytes);
+		GL_ORIGINAL(GetTexImage)(target, level, format, type, pixels);
+	}
+};
+
+void MGLContext_EnableStats(MGLContext * self) {
+	GLMethods & gl = self->gl;
+	GLStats * stats = self->gl_stats;
+
+	// Missing methods stay null, the checks for optional features are not affected.
+
+#define GL_STATS_ENABLE(name) \
+	stats->original[GL_METHOD_##name] = (void *)gl.name; \
+	if (gl.name) { \
+		gl.name = GLStatsWrapper<GL_METHOD_##name, PROC_gl##name>::call; \
+	}
+
+	GL_METHOD_LIST(GL_STATS_ENABLE)
+
+#undef GL_STATS_ENABLE
+
+	active_stats = stats;
+	self->gl_wrapped = true;
+}
+
+void MGLContext_DisableStats(MGLContext * self) {
+	GLMethods & gl = self->gl;
+	GLStats * stats = self->gl_stats;
+
+	if (!stats || active_stats != stats) {
+		return;
+	}
+
+#define GL_STATS_DISABLE(name) \
+	gl.name = (PROC_gl##name)stats->original[GL_METHOD_##name];
+
+	GL_METHOD_LIST(GL_STATS_DISABLE)
+
+#undef GL_STATS_DISABLE
+
+	active_stats = 0;
+	self->gl_wrapped = false;
+}
+
+void MGLContext_ResetStats(MGLContext * self) {
+	GLStats * stats = self->gl_stats;
+
+	memset(stats->functions, 0, sizeof(stats->functions));
+	memset(&stats->frame, 0, sizeof(stats->frame));
+	stats->frames.clear();
+	stats->next_frame = 0;
+}
+
+void MGLContext_ReleaseStats(MGLContext * self) {
+	MGLContext_DisableStats(self);
+	delete self->gl_stats;
+	self->gl_stats = 0;
+}
+
+void MGLContext_EndStatsFrame(MGLContext * self) {
+	GLStats * stats = self->gl_stats;
+
+	if (stats && active_stats == stats) {
+		if (stats->frames.size() < MAX_STATS_FRAMES) {
+			stats->frames.push_back(stats->frame);
+		} else {
+			stats->frames[stats->next_frame] = stats->frame;
+			stats->next_frame = (stats->next_frame + 1) % MAX_STATS_FRAMES;
+		}
+		memset(&stats->frame, 0, sizeof(stats->frame));
+	}
+}
+
+PyObject * MGLContext_get_gl_instrumentation(MGLContext * self) {
+	return PyBool_FromLong(self->gl_stats && active_stats == self->gl_stats);
+}
+
+int MGLContext_set_gl_instrumentation(MGLContext * self, PyObject * value) {
+	bool enabled = self->gl_stats && active_stats == self->gl_stats;
+
+	if (value == Py_True) {
+		if (enabled) {
+			return 0;
+		}
+
+		if (active_stats) {
+			MGLError_Set("the GL calls of another context are instrumented");
+			return -1;
+		}
+
+		if (self->gl_wrapped) {
+			MGLError_Set("the GL calls of the context are traced");
+			return -1;
+		}
+
+		if (!self->gl_stats) {
+			self->gl_stats = new GLStats();
+			MGLContext_ResetStats(self);
+		}
+
+		MGLContext_EnableStats(self);
+		return 0;
+
+	} else if (value == Py_False) {
+		MGLContext_DisableStats(self);
+		return 0;
+	}
+
+	MGLError_Set("invalid value for gl_instrumentation");
+	return -1;
+}
+
+PyObject * MGLContext_gl_stats(MGLContext * self, PyObject * args) {
+	int reset;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"p",
+		&reset
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	GLStats * stats = self->gl_stats;
+
+	PyObject * functions = PyDict_New();
+	PyObject * frames = PyList_New(0);
+
+	if (!stats) {
+		return Py_BuildValue("(NN)", functions, frames);
+	}
+
+	for (int i = 0; i < NUM_GL_METHODS; ++i) {
+		const GLStatsEntry & entry = stats->functions[i];
+
+		if (entry.calls) {
+			PyObject * value = Py_BuildValue("(LLLL)", entry.calls, entry.time, entry.upload_bytes, entry.readback_bytes);
+			PyDict_SetItemString(functions, gl_method_names[i], value);
+			Py_DECREF(value);
+		}
+	}
+
+	size_t num_frames = stats->frames.size();
+
+	for (size_t i = 0; i < num_frames; ++i) {
+		const GLStatsEntry & entry = stats->frames[(stats->next_frame + i) % num_frames];
+		PyObject * value = Py_BuildValue("(LLLL)", entry.calls, entry.time, entry.upload_bytes, entry.readback_bytes);
+		PyList_Append(frames, value);
+		Py_DECREF(value);
+	}
+
+	PyObject * result = Py_BuildValue("(NN)", functions, frames);
+
+	if (reset) {
+		MGLContext_ResetStats(self);
+	}
+
+	return result;
+}
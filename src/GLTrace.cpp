@@ -0,0 +1,1399 @@
+#include "Types.hpp"
+
+#include "GLMethodList.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// A trace is the magic, the version and a stream of records.
+// A record starts with the index of the method, the name of an index is defined by its first record.
+// The arguments follow in order, values as they are in memory and pointers as one of GLTracePointer.
+
+static const char trace_magic[8] = {'M', 'G', 'L', 'T', 'R', 'A', 'C', 'E'};
+static const unsigned trace_version = 1;
+
+enum GLTraceRecord {
+	TRACE_DEFINE = 0xFFFF,
+	TRACE_FRAME = 0xFFFE,
+	TRACE_UNSUPPORTED = 0xFFFD,
+};
+
+enum GLTracePointer {
+	POINTER_NULL,
+	POINTER_OFFSET,
+	POINTER_DATA,
+	POINTER_SCRATCH,
+};
+
+struct GLTraceMapping {
+	char * ptr;
+	long long length;
+	unsigned access;
+};
+
+struct GLTrace {
+	FILE * file;
+	long long written;
+	std::vector<char> buffer;
+	void * original[NUM_GL_METHODS];
+	bool defined[NUM_GL_METHODS];
+	std::unordered_map<unsigned, GLTraceMapping> mappings;
+};
+
+// Like the instrumentation the wrappers have no context argument, a single context is traced at a time.
+// Objects look up their methods in the table of the context on every call and never keep a wrapper.
+
+static GLTrace * active_trace;
+
+#define GL_TRACE_ORIGINAL(name) ((PROC_gl##name)active_trace->original[GL_METHOD_##name])
+
+// The arguments holding object names, used to translate the names of the trace to the names of the replay.
+// Every character is an argument: b buffer, t texture, f framebuffer, r renderbuffer, v vertex array,
+// s sampler, q query, p program or shader, l program pipeline, x transform feedback,
+// u uniform location of the last program argument and . for other values.
+
+static const char * trace_names[NUM_GL_METHODS];
+
+void GLTraceInitNames() {
+	if (trace_names[GL_METHOD_BindBuffer]) {
+		return;
+	}
+
+	for (int i = 0; i < NUM_GL_METHODS; ++i) {
+		if (!strncmp(gl_method_names[i], "glProgramUniform", 16)) {
+			trace_names[i] = "pu";
+		}
+	}
+
+	trace_names[GL_METHOD_ActiveShaderProgram] = "lp";
+	trace_names[GL_METHOD_AttachShader] = "pp";
+	trace_names[GL_METHOD_BeginConditionalRender] = "q";
+	trace_names[GL_METHOD_BeginQuery] = ".q";
+	trace_names[GL_METHOD_BeginQueryIndexed] = "..q";
+	trace_names[GL_METHOD_BindBuffer] = ".b";
+	trace_names[GL_METHOD_BindBufferBase] = "..b";
+	trace_names[GL_METHOD_BindBufferRange] = "..b";
+	trace_names[GL_METHOD_BindFramebuffer] = ".f";
+	trace_names[GL_METHOD_BindImageTexture] = ".t";
+	trace_names[GL_METHOD_BindProgramPipeline] = "l";
+	trace_names[GL_METHOD_BindRenderbuffer] = ".r";
+	trace_names[GL_METHOD_BindSampler] = ".s";
+	trace_names[GL_METHOD_BindTexture] = ".t";
+	trace_names[GL_METHOD_BindTextureUnit] = ".t";
+	trace_names[GL_METHOD_BindTransformFeedback] = ".x";
+	trace_names[GL_METHOD_BindVertexArray] = "v";
+	trace_names[GL_METHOD_CompileShader] = "p";
+	trace_names[GL_METHOD_CopyImageSubData] = "t.....t";
+	trace_names[GL_METHOD_DeleteProgram] = "p";
+	trace_names[GL_METHOD_DeleteShader] = "p";
+	trace_names[GL_METHOD_DetachShader] = "pp";
+	trace_names[GL_METHOD_FramebufferRenderbuffer] = "...r";
+	trace_names[GL_METHOD_FramebufferTexture] = "..t";
+	trace_names[GL_METHOD_FramebufferTexture2D] = "...t";
+	trace_names[GL_METHOD_FramebufferTextureLayer] = "..t";
+	trace_names[GL_METHOD_LinkProgram] = "p";
+	trace_names[GL_METHOD_ProgramParameteri] = "p";
+	trace_names[GL_METHOD_QueryCounter] = "q";
+	trace_names[GL_METHOD_SamplerParameterf] = "s";
+	trace_names[GL_METHOD_SamplerParameterfv] = "s";
+	trace_names[GL_METHOD_SamplerParameteri] = "s";
+	trace_names[GL_METHOD_SamplerParameteriv] = "s";
+	trace_names[GL_METHOD_SamplerParameterIiv] = "s";
+	trace_names[GL_METHOD_SamplerParameterIuiv] = "s";
+	trace_names[GL_METHOD_ShaderStorageBlockBinding] = "p";
+	trace_names[GL_METHOD_TexBuffer] = "..b";
+	trace_names[GL_METHOD_TexBufferRange] = "..b";
+	trace_names[GL_METHOD_TextureView] = "t.t";
+	trace_names[GL_METHOD_UniformBlockBinding] = "p";
+	trace_names[GL_METHOD_UseProgram] = "p";
+	trace_names[GL_METHOD_UseProgramStages] = "l.p";
+	trace_names[GL_METHOD_ValidateProgram] = "p";
+}
+
+void GLTraceFlush(GLTrace * trace) {
+	if (trace->buffer.size()) {
+		fwrite(trace->buffer.data(), 1, trace->buffer.size(), trace->file);
+		trace->written += trace->buffer.size();
+		trace->buffer.clear();
+	}
+}
+
+inline void GLTraceBytes(const void * data, long long size) {
+	const char * bytes = (const char *)data;
+	active_trace->buffer.insert(active_trace->buffer.end(), bytes, bytes + size);
+}
+
+template <typename T>
+inline void GLTraceValue(T value) {
+	GLTraceBytes(&value, sizeof(T));
+}
+
+template <typename T>
+inline void GLTraceArg(T value) {
+	GLTraceValue(value);
+}
+
+// The pointers of the generic wrappers are offsets into the bound buffers.
+
+template <typename T>
+inline void GLTraceArg(T * value) {
+	if (value) {
+		GLTraceValue((unsigned char)POINTER_OFFSET);
+		GLTraceValue((unsigned long long)(size_t)value);
+	} else {
+		GLTraceValue((unsigned char)POINTER_NULL);
+	}
+}
+
+// The data is aligned in the file, the replay passes it to the driver without a copy.
+
+void GLTraceData(const void * data, long long size) {
+	if (!data) {
+		GLTraceValue((unsigned char)POINTER_NULL);
+		return;
+	}
+
+	GLTraceValue((unsigned char)POINTER_DATA);
+	GLTraceValue((unsigned)size);
+
+	long long position = active_trace->written + active_trace->buffer.size();
+	active_trace->buffer.resize(active_trace->buffer.size() + (-position & 7));
+
+	GLTraceBytes(data, size);
+}
+
+void GLTraceScratch(long long size) {
+	GLTraceValue((unsigned char)POINTER_SCRATCH);
+	GLTraceValue((unsigned)size);
+}
+
+void GLTraceString(const char * str, long long size) {
+	GLTraceValue((unsigned)size);
+	GLTraceBytes(str, size);
+}
+
+// Pixels in client memory are stored for uploads and become scratch memory for readbacks.
+
+void GLTracePixels(const void * pixels, bool pack, long long size) {
+	int buffer = 0;
+
+	if (pixels) {
+		GL_TRACE_ORIGINAL(GetIntegerv)(pack ? GL_PIXEL_PACK_BUFFER_BINDING : GL_PIXEL_UNPACK_BUFFER_BINDING, &buffer);
+	}
+
+	if (!pixels || buffer) {
+		GLTraceArg(pixels);
+	} else if (pack) {
+		GLTraceScratch(size);
+	} else {
+		GLTraceData(pixels, size);
+	}
+}
+
+void GLTraceMethod(int index) {
+	GLTrace * trace = active_trace;
+
+	if (!trace->defined[index]) {
+		const char * name = gl_method_names[index];
+		GLTraceValue((unsigned short)TRACE_DEFINE);
+		GLTraceValue((unsigned short)index);
+		GLTraceValue((unsigned short)strlen(name));
+		GLTraceBytes(name, strlen(name));
+		trace->defined[index] = true;
+	}
+
+	if (trace->buffer.size() > (1 << 20)) {
+		GLTraceFlush(trace);
+	}
+
+	GLTraceValue((unsigned short)index);
+}
+
+template <typename ... Args>
+struct GLTraceHasPointer {
+	static const bool value = false;
+};
+
+template <typename T, typename ... Rest>
+struct GLTraceHasPointer<T, Rest ...> {
+	static const bool value = std::is_pointer<T>::value || GLTraceHasPointer<Rest ...>::value;
+};
+
+// The methods with pointers that are always offsets into buffers in the core profile.
+
+template <int index>
+struct GLTraceOffsets {
+	static const bool value = false;
+};
+
+#define GL_TRACE_OFFSETS(name) \
+	template <> \
+	struct GLTraceOffsets<GL_METHOD_##name> { \
+		static const bool value = true; \
+	};
+
+GL_TRACE_OFFSETS(DrawArraysIndirect)
+GL_TRACE_OFFSETS(DrawElements)
+GL_TRACE_OFFSETS(DrawElementsBaseVertex)
+GL_TRACE_OFFSETS(DrawElementsIndirect)
+GL_TRACE_OFFSETS(DrawElementsInstanced)
+GL_TRACE_OFFSETS(DrawElementsInstancedBaseInstance)
+GL_TRACE_OFFSETS(DrawElementsInstancedBaseVertex)
+GL_TRACE_OFFSETS(DrawElementsInstancedBaseVertexBaseInstance)
+GL_TRACE_OFFSETS(DrawRangeElements)
+GL_TRACE_OFFSETS(DrawRangeElementsBaseVertex)
+GL_TRACE_OFFSETS(MultiDrawArraysIndirect)
+GL_TRACE_OFFSETS(MultiDrawArraysIndirectCount)
+GL_TRACE_OFFSETS(MultiDrawElementsIndirect)
+GL_TRACE_OFFSETS(MultiDrawElementsIndirectCount)
+GL_TRACE_OFFSETS(VertexAttribIPointer)
+GL_TRACE_OFFSETS(VertexAttribLPointer)
+GL_TRACE_OFFSETS(VertexAttribPointer)
+
+// The pixels of the pixel transfers are offsets while a pixel buffer is bound.
+
+template <int index>
+struct GLTracePixelOffsets {
+	static const bool value = false;
+};
+
+#define GL_TRACE_PIXEL_OFFSETS(name) \
+	template <> \
+	struct GLTracePixelOffsets<GL_METHOD_##name> { \
+		static const bool value = true; \
+	};
+
+GL_TRACE_PIXEL_OFFSETS(CompressedTexImage2D)
+GL_TRACE_PIXEL_OFFSETS(CompressedTexImage3D)
+GL_TRACE_PIXEL_OFFSETS(CompressedTexSubImage2D)
+GL_TRACE_PIXEL_OFFSETS(CompressedTexSubImage3D)
+GL_TRACE_PIXEL_OFFSETS(GetTexImage)
+GL_TRACE_PIXEL_OFFSETS(ReadPixels)
+GL_TRACE_PIXEL_OFFSETS(TexImage2D)
+GL_TRACE_PIXEL_OFFSETS(TexImage3D)
+GL_TRACE_PIXEL_OFFSETS(TexSubImage2D)
+GL_TRACE_PIXEL_OFFSETS(TexSubImage3D)
+
+// The number of bytes a call touches through the data stored for it, -1 for the methods storing no data.
+// The replay skips the calls with less data than the call touches.
+
+struct GLTraceReplay;
+
+long long GLTraceReplayPixels(GLTraceReplay & replay, bool pack, int width, int height, int depth, GLenum format, GLenum type);
+long long GLTraceReplayLevelPixels(GLTraceReplay & replay, GLenum target, GLint level, GLenum format, GLenum type);
+
+template <int index>
+struct GLTraceDataSize {
+	template <typename ... Args>
+	static long long bytes(GLTraceReplay & replay, Args ... args) {
+		return -1;
+	}
+};
+
+#define GL_TRACE_DATA_SIZE(name, expr, ...) \
+	template <> \
+	struct GLTraceDataSize<GL_METHOD_##name> { \
+		static long long bytes(GLTraceReplay & replay, __VA_ARGS__) { \
+			return (expr); \
+		} \
+	};
+
+template <int index, typename Proc>
+struct GLTraceWrapper;
+
+template <int index, typename Result, typename ... Args>
+struct GLTraceWrapper<index, Result (GLAPI *)(Args ...)> {
+	static Result GLAPI call(Args ... args) {
+		if (GLTraceHasPointer<Args ...>::value && !GLTraceOffsets<index>::value) {
+			GLTraceValue((unsigned short)TRACE_UNSUPPORTED);
+			GLTraceValue((unsigned short)index);
+		} else {
+			GLTraceMethod(index);
+			int order[] = {0, (GLTraceArg(args), 0) ...};
+			(void)order;
+		}
+		return ((Result (GLAPI *)(Args ...))active_trace->original[index])(args ...);
+	}
+};
+
+// The methods with data in client memory store the data.
+
+template <>
+struct GLTraceWrapper<GL_METHOD_BufferData, PROC_glBufferData> {
+	static GLvoid GLAPI call(GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage) {
+		GLTraceMethod(GL_METHOD_BufferData);
+		GLTraceArg(target);
+		GLTraceArg(size);
+		GLTraceData(data, size);
+		GLTraceArg(usage);
+		GL_TRACE_ORIGINAL(BufferData)(target, size, data, usage);
+	}
+};
+
+GL_TRACE_DATA_SIZE(BufferData, size, GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_BufferSubData, PROC_glBufferSubData> {
+	static GLvoid GLAPI call(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid * data) {
+		GLTraceMethod(GL_METHOD_BufferSubData);
+		GLTraceArg(target);
+		GLTraceArg(offset);
+		GLTraceArg(size);
+		GLTraceData(data, size);
+		GL_TRACE_ORIGINAL(BufferSubData)(target, offset, size, data);
+	}
+};
+
+GL_TRACE_DATA_SIZE(BufferSubData, size, GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid * data)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_BufferStorage, PROC_glBufferStorage> {
+	static GLvoid GLAPI call(GLenum target, GLsizeiptr size, const GLvoid * data, GLbitfield flags) {
+		GLTraceMethod(GL_METHOD_BufferStorage);
+		GLTraceArg(target);
+		GLTraceArg(size);
+		GLTraceData(data, size);
+		GLTraceArg(flags);
+		GL_TRACE_ORIGINAL(BufferStorage)(target, size, data, flags);
+	}
+};
+
+GL_TRACE_DATA_SIZE(BufferStorage, size, GLenum target, GLsizeiptr size, const GLvoid * data, GLbitfield flags)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_GetBufferSubData, PROC_glGetBufferSubData> {
+	static GLvoid GLAPI call(GLenum target, GLintptr offset, GLsizeiptr size, GLvoid * data) {
+		GLTraceMethod(GL_METHOD_GetBufferSubData);
+		GLTraceArg(target);
+		GLTraceArg(offset);
+		GLTraceArg(size);
+		GLTraceScratch(size);
+		GL_TRACE_ORIGINAL(GetBufferSubData)(target, offset, size, data);
+	}
+};
+
+GL_TRACE_DATA_SIZE(GetBufferSubData, size, GLenum target, GLintptr offset, GLsizeiptr size, GLvoid * data)
+
+// The data written to a mapped range is stored when the buffer is unmapped.
+
+template <>
+struct GLTraceWrapper<GL_METHOD_MapBufferRange, PROC_glMapBufferRange> {
+	static GLvoid * GLAPI call(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+		GLTraceMethod(GL_METHOD_MapBufferRange);
+		GLTraceArg(target);
+		GLTraceArg(offset);
+		GLTraceArg(length);
+		GLTraceArg(access);
+		void * ptr = GL_TRACE_ORIGINAL(MapBufferRange)(target, offset, length, access);
+		GLTraceMapping mapping = {(char *)ptr, length, access};
+		active_trace->mappings[target] = mapping;
+		return ptr;
+	}
+};
+
+template <>
+struct GLTraceWrapper<GL_METHOD_UnmapBuffer, PROC_glUnmapBuffer> {
+	static GLboolean GLAPI call(GLenum target) {
+		GLTraceMethod(GL_METHOD_UnmapBuffer);
+		GLTraceArg(target);
+		GLTraceMapping mapping = active_trace->mappings[target];
+		active_trace->mappings.erase(target);
+		GLTraceData((mapping.access & GL_MAP_WRITE_BIT) ? mapping.ptr : 0, mapping.length);
+		return GL_TRACE_ORIGINAL(UnmapBuffer)(target);
+	}
+};
+
+template <>
+struct GLTraceWrapper<GL_METHOD_TexImage2D, PROC_glTexImage2D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid * pixels) {
+		GLTraceMethod(GL_METHOD_TexImage2D);
+		int order[] = {(GLTraceArg(target), GLTraceArg(level), GLTraceArg(internalformat), GLTraceArg(width), GLTraceArg(height), GLTraceArg(border), GLTraceArg(format), GLTraceArg(type), 0)};
+		(void)order;
+		GLTracePixels(pixels, false, pixel_transfer_size(GL_TRACE_ORIGINAL(GetIntegerv), false, width, height, 1, format, type));
+		GL_TRACE_ORIGINAL(TexImage2D)(target, level, internalformat, width, height, border, format, type, pixels);
+	}
+};
+
+GL_TRACE_DATA_SIZE(TexImage2D, GLTraceReplayPixels(replay, false, width, height, 1, format, type), GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_TexImage3D, PROC_glTexImage3D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels) {
+		GLTraceMethod(GL_METHOD_TexImage3D);
+		int order[] = {(GLTraceArg(target), GLTraceArg(level), GLTraceArg(internalformat), GLTraceArg(width), GLTraceArg(height), GLTraceArg(depth), GLTraceArg(border), GLTraceArg(format), GLTraceArg(type), 0)};
+		(void)order;
+		GLTracePixels(pixels, false, pixel_transfer_size(GL_TRACE_ORIGINAL(GetIntegerv), false, width, height, depth, format, type));
+		GL_TRACE_ORIGINAL(TexImage3D)(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	}
+};
+
+GL_TRACE_DATA_SIZE(TexImage3D, GLTraceReplayPixels(replay, false, width, height, depth, format, type), GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_TexSubImage2D, PROC_glTexSubImage2D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels) {
+		GLTraceMethod(GL_METHOD_TexSubImage2D);
+		int order[] = {(GLTraceArg(target), GLTraceArg(level), GLTraceArg(xoffset), GLTraceArg(yoffset), GLTraceArg(width), GLTraceArg(height), GLTraceArg(format), GLTraceArg(type), 0)};
+		(void)order;
+		GLTracePixels(pixels, false, pixel_transfer_size(GL_TRACE_ORIGINAL(GetIntegerv), false, width, height, 1, format, type));
+		GL_TRACE_ORIGINAL(TexSubImage2D)(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	}
+};
+
+GL_TRACE_DATA_SIZE(TexSubImage2D, GLTraceReplayPixels(replay, false, width, height, 1, format, type), GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_TexSubImage3D, PROC_glTexSubImage3D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * pixels) {
+		GLTraceMethod(GL_METHOD_TexSubImage3D);
+		int order[] = {(GLTraceArg(target), GLTraceArg(level), GLTraceArg(xoffset), GLTraceArg(yoffset), GLTraceArg(zoffset), GLTraceArg(width), GLTraceArg(height), GLTraceArg(depth), GLTraceArg(format), GLTraceArg(type), 0)};
+		(void)order;
+		GLTracePixels(pixels, false, pixel_transfer_size(GL_TRACE_ORIGINAL(GetIntegerv), false, width, height, depth, format, type));
+		GL_TRACE_ORIGINAL(TexSubImage3D)(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	}
+};
+
+GL_TRACE_DATA_SIZE(TexSubImage3D, GLTraceReplayPixels(replay, false, width, height, depth, format, type), GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * pixels)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_CompressedTexImage2D, PROC_glCompressedTexImage2D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data) {
+		GLTraceMethod(GL_METHOD_CompressedTexImage2D);
+		int order[] = {(GLTraceArg(target), GLTraceArg(level), GLTraceArg(internalformat), GLTraceArg(width), GLTraceArg(height), GLTraceArg(border), GLTraceArg(imageSize), 0)};
+		(void)order;
+		GLTracePixels(data, false, imageSize);
+		GL_TRACE_ORIGINAL(CompressedTexImage2D)(target, level, internalformat, width, height, border, imageSize, data);
+	}
+};
+
+GL_TRACE_DATA_SIZE(CompressedTexImage2D, imageSize, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_CompressedTexImage3D, PROC_glCompressedTexImage3D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data) {
+		GLTraceMethod(GL_METHOD_CompressedTexImage3D);
+		int order[] = {(GLTraceArg(target), GLTraceArg(level), GLTraceArg(internalformat), GLTraceArg(width), GLTraceArg(height), GLTraceArg(depth), GLTraceArg(border), GLTraceArg(imageSize), 0)};
+		(void)order;
+		GLTracePixels(data, false, imageSize);
+		GL_TRACE_ORIGINAL(CompressedTexImage3D)(target, level, internalformat, width, height, depth, border, imageSize, data);
+	}
+};
+
+GL_TRACE_DATA_SIZE(CompressedTexImage3D, imageSize, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_CompressedTexSubImage2D, PROC_glCompressedTexSubImage2D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data) {
+		GLTraceMethod(GL_METHOD_CompressedTexSubImage2D);
+		int order[] = {(GLTraceArg(target), GLTraceArg(level), GLTraceArg(xoffset), GLTraceArg(yoffset), GLTraceArg(width), GLTraceArg(height), GLTraceArg(format), GLTraceArg(imageSize), 0)};
+		(void)order;
+		GLTracePixels(data, false, imageSize);
+		GL_TRACE_ORIGINAL(CompressedTexSubImage2D)(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	}
+};
+
+GL_TRACE_DATA_SIZE(CompressedTexSubImage2D, imageSize, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_CompressedTexSubImage3D, PROC_glCompressedTexSubImage3D> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data) {
+		GLTraceMethod(GL_METHOD_CompressedTexSubImage3D);
+		int order[] = {(GLTraceArg(target), GLTraceArg(level), GLTraceArg(xoffset), GLTraceArg(yoffset), GLTraceArg(zoffset), GLTraceArg(width), GLTraceArg(height), GLTraceArg(depth), GLTraceArg(format), GLTraceArg(imageSize), 0)};
+		(void)order;
+		GLTracePixels(data, false, imageSize);
+		GL_TRACE_ORIGINAL(CompressedTexSubImage3D)(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	}
+};
+
+GL_TRACE_DATA_SIZE(CompressedTexSubImage3D, imageSize, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_ReadPixels, PROC_glReadPixels> {
+	static GLvoid GLAPI call(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid * pixels) {
+		GLTraceMethod(GL_METHOD_ReadPixels);
+		int order[] = {(GLTraceArg(x), GLTraceArg(y), GLTraceArg(width), GLTraceArg(height), GLTraceArg(format), GLTraceArg(type), 0)};
+		(void)order;
+		GLTracePixels(pixels, true, pixel_transfer_size(GL_TRACE_ORIGINAL(GetIntegerv), true, width, height, 1, format, type));
+		GL_TRACE_ORIGINAL(ReadPixels)(x, y, width, height, format, type, pixels);
+	}
+};
+
+GL_TRACE_DATA_SIZE(ReadPixels, GLTraceReplayPixels(replay, true, width, height, 1, format, type), GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid * pixels)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_GetTexImage, PROC_glGetTexImage> {
+	static GLvoid GLAPI call(GLenum target, GLint level, GLenum format, GLenum type, GLvoid * pixels) {
+		int width = 0;
+		int height = 0;
+		int depth = 0;
+		GL_TRACE_ORIGINAL(GetTexLevelParameteriv)(target, level, GL_TEXTURE_WIDTH, &width);
+		GL_TRACE_ORIGINAL(GetTexLevelParameteriv)(target, level, GL_TEXTURE_HEIGHT, &height);
+		GL_TRACE_ORIGINAL(GetTexLevelParameteriv)(target, level, GL_TEXTURE_DEPTH, &depth);
+
+		GLTraceMethod(GL_METHOD_GetTexImage);
+		int order[] = {(GLTraceArg(target), GLTraceArg(level), GLTraceArg(format), GLTraceArg(type), 0)};
+		(void)order;
+		GLTracePixels(pixels, true, pixel_transfer_size(GL_TRACE_ORIGINAL(GetIntegerv), true, width, height, depth, format, type));
+		GL_TRACE_ORIGINAL(GetTexImage)(target, level, format, type, pixels);
+	}
+};
+
+GL_TRACE_DATA_SIZE(GetTexImage, GLTraceReplayLevelPixels(replay, target, level, format, type), GLenum target, GLint level, GLenum format, GLenum type, GLvoid * pixels)
+
+#define GL_TRACE_ARRAY(name, First, Second, Type, Size) \
+	template <> \
+	struct GLTraceWrapper<GL_METHOD_##name, PROC_gl##name> { \
+		static GLvoid GLAPI call(First first, Second second, const Type * value) { \
+			GLTraceMethod(GL_METHOD_##name); \
+			GLTraceArg(first); \
+			GLTraceArg(second); \
+			GLTraceData(value, (Size) * sizeof(Type)); \
+			GL_TRACE_ORIGINAL(name)(first, second, value); \
+		} \
+	}; \
+	GL_TRACE_DATA_SIZE(name, (Size) * sizeof(Type), First first, Second second, const Type * value)
+
+GL_TRACE_ARRAY(UniformSubroutinesuiv, GLenum, GLsizei, GLuint, second)
+GL_TRACE_ARRAY(ClearBufferfv, GLenum, GLint, GLfloat, first == GL_COLOR ? 4 : 1)
+GL_TRACE_ARRAY(ClearBufferiv, GLenum, GLint, GLint, first == GL_COLOR ? 4 : 1)
+GL_TRACE_ARRAY(ClearBufferuiv, GLenum, GLint, GLuint, first == GL_COLOR ? 4 : 1)
+GL_TRACE_ARRAY(SamplerParameterfv, GLuint, GLenum, GLfloat, second == GL_TEXTURE_BORDER_COLOR ? 4 : 1)
+GL_TRACE_ARRAY(SamplerParameteriv, GLuint, GLenum, GLint, second == GL_TEXTURE_BORDER_COLOR ? 4 : 1)
+GL_TRACE_ARRAY(SamplerParameterIiv, GLuint, GLenum, GLint, second == GL_TEXTURE_BORDER_COLOR ? 4 : 1)
+GL_TRACE_ARRAY(SamplerParameterIuiv, GLuint, GLenum, GLuint, second == GL_TEXTURE_BORDER_COLOR ? 4 : 1)
+GL_TRACE_ARRAY(TexParameterfv, GLenum, GLenum, GLfloat, second == GL_TEXTURE_BORDER_COLOR ? 4 : 1)
+GL_TRACE_ARRAY(TexParameteriv, GLenum, GLenum, GLint, second == GL_TEXTURE_BORDER_COLOR ? 4 : 1)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_DrawBuffers, PROC_glDrawBuffers> {
+	static GLvoid GLAPI call(GLsizei n, const GLenum * bufs) {
+		GLTraceMethod(GL_METHOD_DrawBuffers);
+		GLTraceArg(n);
+		GLTraceData(bufs, n * sizeof(GLenum));
+		GL_TRACE_ORIGINAL(DrawBuffers)(n, bufs);
+	}
+};
+
+GL_TRACE_DATA_SIZE(DrawBuffers, (long long)n * sizeof(GLenum), GLsizei n, const GLenum * bufs)
+
+#define GL_TRACE_UNIFORM(name, Type, components) \
+	template <> \
+	struct GLTraceWrapper<GL_METHOD_##name, PROC_gl##name> { \
+		static GLvoid GLAPI call(GLuint program, GLint location, GLsizei count, const Type * value) { \
+			GLTraceMethod(GL_METHOD_##name); \
+			GLTraceArg(program); \
+			GLTraceArg(location); \
+			GLTraceArg(count); \
+			GLTraceData(value, (long long)count * components * sizeof(Type)); \
+			GL_TRACE_ORIGINAL(name)(program, location, count, value); \
+		} \
+	}; \
+	GL_TRACE_DATA_SIZE(name, (long long)count * components * sizeof(Type), GLuint program, GLint location, GLsizei count, const Type * value)
+
+#define GL_TRACE_UNIFORM_MATRIX(name, Type, components) \
+	template <> \
+	struct GLTraceWrapper<GL_METHOD_##name, PROC_gl##name> { \
+		static GLvoid GLAPI call(GLuint program, GLint location, GLsizei count, GLboolean transpose, const Type * value) { \
+			GLTraceMethod(GL_METHOD_##name); \
+			GLTraceArg(program); \
+			GLTraceArg(location); \
+			GLTraceArg(count); \
+			GLTraceArg(transpose); \
+			GLTraceData(value, (long long)count * components * sizeof(Type)); \
+			GL_TRACE_ORIGINAL(name)(program, location, count, transpose, value); \
+		} \
+	}; \
+	GL_TRACE_DATA_SIZE(name, (long long)count * components * sizeof(Type), GLuint program, GLint location, GLsizei count, GLboolean transpose, const Type * value)
+
+GL_TRACE_UNIFORM(ProgramUniform1iv, GLint, 1)
+GL_TRACE_UNIFORM(ProgramUniform2iv, GLint, 2)
+GL_TRACE_UNIFORM(ProgramUniform3iv, GLint, 3)
+GL_TRACE_UNIFORM(ProgramUniform4iv, GLint, 4)
+GL_TRACE_UNIFORM(ProgramUniform1uiv, GLuint, 1)
+GL_TRACE_UNIFORM(ProgramUniform2uiv, GLuint, 2)
+GL_TRACE_UNIFORM(ProgramUniform3uiv, GLuint, 3)
+GL_TRACE_UNIFORM(ProgramUniform4uiv, GLuint, 4)
+GL_TRACE_UNIFORM(ProgramUniform1fv, GLfloat, 1)
+GL_TRACE_UNIFORM(ProgramUniform2fv, GLfloat, 2)
+GL_TRACE_UNIFORM(ProgramUniform3fv, GLfloat, 3)
+GL_TRACE_UNIFORM(ProgramUniform4fv, GLfloat, 4)
+GL_TRACE_UNIFORM(ProgramUniform1dv, GLdouble, 1)
+GL_TRACE_UNIFORM(ProgramUniform2dv, GLdouble, 2)
+GL_TRACE_UNIFORM(ProgramUniform3dv, GLdouble, 3)
+GL_TRACE_UNIFORM(ProgramUniform4dv, GLdouble, 4)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix2fv, GLfloat, 4)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix3fv, GLfloat, 9)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix4fv, GLfloat, 16)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix2x3fv, GLfloat, 6)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix2x4fv, GLfloat, 8)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix3x2fv, GLfloat, 6)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix3x4fv, GLfloat, 12)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix4x2fv, GLfloat, 8)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix4x3fv, GLfloat, 12)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix2dv, GLdouble, 4)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix3dv, GLdouble, 9)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix4dv, GLdouble, 16)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix2x3dv, GLdouble, 6)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix2x4dv, GLdouble, 8)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix3x2dv, GLdouble, 6)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix3x4dv, GLdouble, 12)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix4x2dv, GLdouble, 8)
+GL_TRACE_UNIFORM_MATRIX(ProgramUniformMatrix4x3dv, GLdouble, 12)
+
+// The names are stored after they are generated, the replay maps them to its own names.
+
+#define GL_TRACE_NAMES(name) \
+	template <> \
+	struct GLTraceWrapper<GL_METHOD_##name, PROC_gl##name> { \
+		static GLvoid GLAPI call(GLsizei n, GLuint * names) { \
+			GL_TRACE_ORIGINAL(name)(n, names); \
+			GLTraceMethod(GL_METHOD_##name); \
+			GLTraceArg(n); \
+			GLTraceData(names, n * sizeof(GLuint)); \
+		} \
+	};
+
+#define GL_TRACE_DELETE_NAMES(name) \
+	template <> \
+	struct GLTraceWrapper<GL_METHOD_##name, PROC_gl##name> { \
+		static GLvoid GLAPI call(GLsizei n, const GLuint * names) { \
+			GLTraceMethod(GL_METHOD_##name); \
+			GLTraceArg(n); \
+			GLTraceData(names, n * sizeof(GLuint)); \
+			GL_TRACE_ORIGINAL(name)(n, names); \
+		} \
+	};
+
+GL_TRACE_NAMES(GenBuffers)
+GL_TRACE_NAMES(GenFramebuffers)
+GL_TRACE_NAMES(GenProgramPipelines)
+GL_TRACE_NAMES(GenQueries)
+GL_TRACE_NAMES(GenRenderbuffers)
+GL_TRACE_NAMES(GenSamplers)
+GL_TRACE_NAMES(GenTextures)
+GL_TRACE_NAMES(GenTransformFeedbacks)
+GL_TRACE_NAMES(GenVertexArrays)
+GL_TRACE_DELETE_NAMES(DeleteBuffers)
+GL_TRACE_DELETE_NAMES(DeleteFramebuffers)
+GL_TRACE_DELETE_NAMES(DeleteProgramPipelines)
+GL_TRACE_DELETE_NAMES(DeleteQueries)
+GL_TRACE_DELETE_NAMES(DeleteRenderbuffers)
+GL_TRACE_DELETE_NAMES(DeleteSamplers)
+GL_TRACE_DELETE_NAMES(DeleteTextures)
+GL_TRACE_DELETE_NAMES(DeleteTransformFeedbacks)
+GL_TRACE_DELETE_NAMES(DeleteVertexArrays)
+
+template <>
+struct GLTraceWrapper<GL_METHOD_CreateProgram, PROC_glCreateProgram> {
+	static GLuint GLAPI call() {
+		GLuint program = GL_TRACE_ORIGINAL(CreateProgram)();
+		GLTraceMethod(GL_METHOD_CreateProgram);
+		GLTraceArg(program);
+		return program;
+	}
+};
+
+template <>
+struct GLTraceWrapper<GL_METHOD_CreateShader, PROC_glCreateShader> {
+	static GLuint GLAPI call(GLenum type) {
+		GLuint shader = GL_TRACE_ORIGINAL(CreateShader)(type);
+		GLTraceMethod(GL_METHOD_CreateShader);
+		GLTraceArg(type);
+		GLTraceArg(shader);
+		return shader;
+	}
+};
+
+template <>
+struct GLTraceWrapper<GL_METHOD_GetUniformLocation, PROC_glGetUniformLocation> {
+	static GLint GLAPI call(GLuint program, const GLchar * name) {
+		GLint location = GL_TRACE_ORIGINAL(GetUniformLocation)(program, name);
+		GLTraceMethod(GL_METHOD_GetUniformLocation);
+		GLTraceArg(program);
+		GLTraceString(name, strlen(name));
+		GLTraceArg(location);
+		return location;
+	}
+};
+
+template <>
+struct GLTraceWrapper<GL_METHOD_ShaderSource, PROC_glShaderSource> {
+	static GLvoid GLAPI call(GLuint shader, GLsizei count, const GLchar * const * string, const GLint * length) {
+		GLTraceMethod(GL_METHOD_ShaderSource);
+		GLTraceArg(shader);
+		GLTraceArg(count);
+		for (int i = 0; i < count; ++i) {
+			GLTraceString(string[i], (length && length[i] >= 0) ? length[i] : strlen(string[i]));
+		}
+		GL_TRACE_ORIGINAL(ShaderSource)(shader, count, string, length);
+	}
+};
+
+template <>
+struct GLTraceWrapper<GL_METHOD_TransformFeedbackVaryings, PROC_glTransformFeedbackVaryings> {
+	static GLvoid GLAPI call(GLuint program, GLsizei count, const GLchar * const * varyings, GLenum bufferMode) {
+		GLTraceMethod(GL_METHOD_TransformFeedbackVaryings);
+		GLTraceArg(program);
+		GLTraceArg(count);
+		for (int i = 0; i < count; ++i) {
+			GLTraceString(varyings[i], strlen(varyings[i]));
+		}
+		GLTraceArg(bufferMode);
+		GL_TRACE_ORIGINAL(TransformFeedbackVaryings)(program, count, varyings, bufferMode);
+	}
+};
+
+// The queries of the state are not recorded, they do not change what the replay draws.
+
+bool GLTraceRecorded(int index) {
+	switch (index) {
+		case GL_METHOD_GetBufferSubData:
+		case GL_METHOD_GetTexImage:
+		case GL_METHOD_GetUniformLocation:
+			return true;
+	}
+
+	const char * name = gl_method_names[index];
+	return strncmp(name, "glGet", 5) && strncmp(name, "glIs", 4) && strncmp(name, "glCheck", 7);
+}
+
+void MGLContext_EndTrace(MGLContext * self) {
+	GLTrace * trace = self->gl_trace;
+
+	if (!trace) {
+		return;
+	}
+
+	GLMethods & gl = self->gl;
+
+#define GL_TRACE_DISABLE(name) \
+	gl.name = (PROC_gl##name)trace->original[GL_METHOD_##name];
+
+	GL_METHOD_LIST(GL_TRACE_DISABLE)
+
+#undef GL_TRACE_DISABLE
+
+	GLTraceFlush(trace);
+	fclose(trace->file);
+	delete trace;
+
+	active_trace = 0;
+	self->gl_trace = 0;
+	self->gl_wrapped = false;
+}
+
+void MGLContext_TraceFrame(MGLContext * self) {
+	if (self->gl_trace) {
+		GLTraceValue((unsigned short)TRACE_FRAME);
+	}
+}
+
+PyObject * MGLContext_begin_trace(MGLContext * self, PyObject * args) {
+	const char * path;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"s",
+		&path
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (active_trace) {
+		MGLError_Set("the GL calls of a context are already traced");
+		return 0;
+	}
+
+	if (self->gl_wrapped) {
+		MGLError_Set("the GL calls of the context are instrumented");
+		return 0;
+	}
+
+	FILE * file = fopen(path, "wb");
+
+	if (!file) {
+		MGLError_Set("cannot open %s", path);
+		return 0;
+	}
+
+	GLTrace * trace = new GLTrace();
+	trace->file = file;
+	trace->written = 0;
+
+	GLMethods & gl = self->gl;
+
+#define GL_TRACE_ENABLE(name) \
+	trace->original[GL_METHOD_##name] = (void *)gl.name; \
+	if (gl.name && GLTraceRecorded(GL_METHOD_##name)) { \
+		gl.name = GLTraceWrapper<GL_METHOD_##name, PROC_gl##name>::call; \
+	}
+
+	GL_METHOD_LIST(GL_TRACE_ENABLE)
+
+#undef GL_TRACE_ENABLE
+
+	active_trace = trace;
+	self->gl_trace = trace;
+	self->gl_wrapped = true;
+
+	GLTraceBytes(trace_magic, sizeof(trace_magic));
+	GLTraceValue(trace_version);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLContext_end_trace(MGLContext * self) {
+	if (!self->gl_trace) {
+		MGLError_Set("the context is not traced");
+		return 0;
+	}
+
+	MGLContext_EndTrace(self);
+	Py_RETURN_NONE;
+}
+
+struct GLTraceReplay {
+	const char * data;
+	long long size;
+	long long offset;
+	bool error;
+
+	void * procs[NUM_GL_METHODS];
+	std::vector<int> methods;
+
+	std::unordered_map<long long, unsigned> names;
+	std::unordered_map<long long, int> locations;
+	std::unordered_map<unsigned, GLTraceMapping> mappings;
+	std::vector<char> scratch[16];
+
+	// The kind and the stored size of the pointers of the current call.
+	unsigned char pointer_kinds[16];
+	long long pointer_sizes[16];
+	bool pointer_data;
+
+	unsigned program;
+	long long calls;
+	long long unsupported;
+};
+
+const char * GLTraceRead(GLTraceReplay & replay, long long size) {
+	if (replay.error || size < 0 || replay.offset + size > replay.size) {
+		replay.error = true;
+		return 0;
+	}
+
+	const char * ptr = replay.data + replay.offset;
+	replay.offset += size;
+	return ptr;
+}
+
+template <typename T>
+T GLTraceReadValue(GLTraceReplay & replay) {
+	T value = T();
+	const char * ptr = GLTraceRead(replay, sizeof(T));
+	if (ptr) {
+		memcpy(&value, ptr, sizeof(T));
+	}
+	return value;
+}
+
+inline long long GLTraceKey(char kind, unsigned name) {
+	return ((long long)kind << 32) | name;
+}
+
+unsigned GLTraceName(GLTraceReplay & replay, char kind, unsigned name) {
+	std::unordered_map<long long, unsigned>::iterator it = replay.names.find(GLTraceKey(kind, name));
+	return it != replay.names.end() ? it->second : name;
+}
+
+template <typename T>
+T GLTraceRemap(GLTraceReplay & replay, int index, int arg, T value, std::true_type) {
+	const char * names = trace_names[index];
+
+	if (!names || arg >= (int)strlen(names) || names[arg] == '.') {
+		return value;
+	}
+
+	if (names[arg] == 'u') {
+		std::unordered_map<long long, int>::iterator it = replay.locations.find(GLTraceKey(0, replay.program) << 16 | (unsigned short)value);
+		return it != replay.locations.end() ? (T)it->second : value;
+	}
+
+	T result = (T)GLTraceName(replay, names[arg], (unsigned)value);
+
+	if (names[arg] == 'p') {
+		replay.program = (unsigned)result;
+	}
+
+	return result;
+}
+
+template <typename T>
+T GLTraceRemap(GLTraceReplay & replay, int index, int arg, T value, std::false_type) {
+	return value;
+}
+
+long long GLTraceReplayPixels(GLTraceReplay & replay, bool pack, int width, int height, int depth, GLenum format, GLenum type) {
+	return pixel_transfer_size((PROC_glGetIntegerv)replay.procs[GL_METHOD_GetIntegerv], pack, width, height, depth, format, type);
+}
+
+long long GLTraceReplayLevelPixels(GLTraceReplay & replay, GLenum target, GLint level, GLenum format, GLenum type) {
+	PROC_glGetTexLevelParameteriv get_level_parameter = (PROC_glGetTexLevelParameteriv)replay.procs[GL_METHOD_GetTexLevelParameteriv];
+	int width = 0;
+	int height = 0;
+	int depth = 0;
+	get_level_parameter(target, level, GL_TEXTURE_WIDTH, &width);
+	get_level_parameter(target, level, GL_TEXTURE_HEIGHT, &height);
+	get_level_parameter(target, level, GL_TEXTURE_DEPTH, &depth);
+	return GLTraceReplayPixels(replay, true, width, height, depth, format, type);
+}
+
+const char * GLTraceReadPointer(GLTraceReplay & replay, int arg) {
+	unsigned char kind = GLTraceReadValue<unsigned char>(replay);
+
+	replay.pointer_kinds[arg & 15] = kind;
+	replay.pointer_sizes[arg & 15] = 0;
+
+	switch (kind) {
+		case POINTER_NULL:
+			return 0;
+
+		case POINTER_OFFSET:
+			return (const char *)(size_t)GLTraceReadValue<unsigned long long>(replay);
+
+		case POINTER_DATA: {
+			unsigned size = GLTraceReadValue<unsigned>(replay);
+			GLTraceRead(replay, -replay.offset & 7);
+			replay.pointer_sizes[arg & 15] = size;
+			replay.pointer_data = true;
+			return GLTraceRead(replay, size);
+		}
+
+		case POINTER_SCRATCH: {
+			std::vector<char> & scratch = replay.scratch[arg & 15];
+			scratch.resize(GLTraceReadValue<unsigned>(replay));
+			replay.pointer_sizes[arg & 15] = scratch.size();
+			replay.pointer_data = true;
+			return scratch.data();
+		}
+	}
+
+	replay.error = true;
+	return 0;
+}
+
+template <typename T>
+struct GLTraceReadArg {
+	static T read(GLTraceReplay & replay, int index, int arg) {
+		T value = GLTraceReadValue<T>(replay);
+		return GLTraceRemap(replay, index, arg, value, std::is_integral<T>());
+	}
+};
+
+template <typename T>
+struct GLTraceReadArg<T *> {
+	static T * read(GLTraceReplay & replay, int index, int arg) {
+		return (T *)GLTraceReadPointer(replay, arg);
+	}
+};
+
+bool GLTraceValidData(GLTraceReplay & replay, int arg, long long size) {
+	return replay.pointer_kinds[arg & 15] == POINTER_DATA && size >= 0 && replay.pointer_sizes[arg & 15] >= size;
+}
+
+// Offsets are only valid for the methods recording offsets, stored data only for the inputs
+// and scratch memory only for the outputs of a call.
+
+template <int index, typename T>
+struct GLTraceValidArg {
+	static bool check(GLTraceReplay & replay, int arg, long long size) {
+		return true;
+	}
+};
+
+template <int index, typename T>
+struct GLTraceValidArg<index, T *> {
+	static bool check(GLTraceReplay & replay, int arg, long long size) {
+		switch (replay.pointer_kinds[arg & 15]) {
+			case POINTER_OFFSET:
+				return GLTraceOffsets<index>::value || GLTracePixelOffsets<index>::value;
+
+			case POINTER_DATA:
+				return std::is_const<T>::value && GLTraceValidData(replay, arg, size);
+
+			case POINTER_SCRATCH:
+				return !std::is_const<T>::value && size >= 0 && replay.pointer_sizes[arg & 15] >= size;
+		}
+
+		return true;
+	}
+};
+
+template <int index, typename Proc>
+struct GLTracePlayer;
+
+template <int index, typename Result, typename ... Args>
+struct GLTracePlayer<index, Result (GLAPI *)(Args ...)> {
+	static void play(GLTraceReplay & replay) {
+		call(replay, std::index_sequence_for<Args ...>());
+	}
+
+	template <size_t ... I>
+	static void call(GLTraceReplay & replay, std::index_sequence<I ...>) {
+		replay.pointer_data = false;
+
+		// The arguments of a braced list are read in order.
+		std::tuple<Args ...> args{GLTraceReadArg<Args>::read(replay, index, (int)I) ...};
+		(void)args;
+
+		if (replay.error) {
+			return;
+		}
+
+		// The pixel sizes query the state, they are only computed for the calls with data.
+		long long size = replay.pointer_data ? GLTraceDataSize<index>::bytes(replay, std::get<I>(args) ...) : -1;
+		bool valid = true;
+		int order[] = {0, (valid = valid && GLTraceValidArg<index, Args>::check(replay, (int)I, size), 0) ...};
+		(void)order;
+		(void)size;
+
+		if (!valid) {
+			replay.unsupported += 1;
+			return;
+		}
+
+		((Result (GLAPI *)(Args ...))replay.procs[index])(std::get<I>(args) ...);
+	}
+};
+
+#define GL_PLAY_NAMES(name, kind) \
+	template <> \
+	struct GLTracePlayer<GL_METHOD_##name, PROC_gl##name> { \
+		static void play(GLTraceReplay & replay) { \
+			int n = GLTraceReadValue<GLsizei>(replay); \
+			const GLuint * recorded = (const GLuint *)GLTraceReadPointer(replay, 1); \
+			if (replay.error || n < 0 || !recorded) { \
+				return; \
+			} \
+			if (!GLTraceValidData(replay, 1, (long long)n * sizeof(GLuint))) { \
+				replay.unsupported += 1; \
+				return; \
+			} \
+			std::vector<GLuint> names(n); \
+			((PROC_gl##name)replay.procs[GL_METHOD_##name])(n, names.data()); \
+			for (int i = 0; i < n; ++i) { \
+				replay.names[GLTraceKey(kind, recorded[i])] = names[i]; \
+			} \
+		} \
+	};
+
+#define GL_PLAY_DELETE_NAMES(name, kind) \
+	template <> \
+	struct GLTracePlayer<GL_METHOD_##name, PROC_gl##name> { \
+		static void play(GLTraceReplay & replay) { \
+			int n = GLTraceReadValue<GLsizei>(replay); \
+			const GLuint * recorded = (const GLuint *)GLTraceReadPointer(replay, 1); \
+			if (replay.error || n < 0 || !recorded) { \
+				return; \
+			} \
+			if (!GLTraceValidData(replay, 1, (long long)n * sizeof(GLuint))) { \
+				replay.unsupported += 1; \
+				return; \
+			} \
+			std::vector<GLuint> names(n); \
+			for (int i = 0; i < n; ++i) { \
+				names[i] = GLTraceName(replay, kind, recorded[i]); \
+				replay.names.erase(GLTraceKey(kind, recorded[i])); \
+			} \
+			((PROC_gl##name)replay.procs[GL_METHOD_##name])(n, names.data()); \
+		} \
+	};
+
+GL_PLAY_NAMES(GenBuffers, 'b')
+GL_PLAY_NAMES(GenFramebuffers, 'f')
+GL_PLAY_NAMES(GenProgramPipelines, 'l')
+GL_PLAY_NAMES(GenQueries, 'q')
+GL_PLAY_NAMES(GenRenderbuffers, 'r')
+GL_PLAY_NAMES(GenSamplers, 's')
+GL_PLAY_NAMES(GenTextures, 't')
+GL_PLAY_NAMES(GenTransformFeedbacks, 'x')
+GL_PLAY_NAMES(GenVertexArrays, 'v')
+GL_PLAY_DELETE_NAMES(DeleteBuffers, 'b')
+GL_PLAY_DELETE_NAMES(DeleteFramebuffers, 'f')
+GL_PLAY_DELETE_NAMES(DeleteProgramPipelines, 'l')
+GL_PLAY_DELETE_NAMES(DeleteQueries, 'q')
+GL_PLAY_DELETE_NAMES(DeleteRenderbuffers, 'r')
+GL_PLAY_DELETE_NAMES(DeleteSamplers, 's')
+GL_PLAY_DELETE_NAMES(DeleteTextures, 't')
+GL_PLAY_DELETE_NAMES(DeleteTransformFeedbacks, 'x')
+GL_PLAY_DELETE_NAMES(DeleteVertexArrays, 'v')
+
+template <>
+struct GLTracePlayer<GL_METHOD_CreateProgram, PROC_glCreateProgram> {
+	static void play(GLTraceReplay & replay) {
+		GLuint recorded = GLTraceReadValue<GLuint>(replay);
+		if (!replay.error) {
+			replay.names[GLTraceKey('p', recorded)] = ((PROC_glCreateProgram)replay.procs[GL_METHOD_CreateProgram])();
+		}
+	}
+};
+
+template <>
+struct GLTracePlayer<GL_METHOD_CreateShader, PROC_glCreateShader> {
+	static void play(GLTraceReplay & replay) {
+		GLenum type = GLTraceReadValue<GLenum>(replay);
+		GLuint recorded = GLTraceReadValue<GLuint>(replay);
+		if (!replay.error) {
+			replay.names[GLTraceKey('p', recorded)] = ((PROC_glCreateShader)replay.procs[GL_METHOD_CreateShader])(type);
+		}
+	}
+};
+
+template <>
+struct GLTracePlayer<GL_METHOD_GetUniformLocation, PROC_glGetUniformLocation> {
+	static void play(GLTraceReplay & replay) {
+		GLuint program = GLTraceName(replay, 'p', GLTraceReadValue<GLuint>(replay));
+		unsigned size = GLTraceReadValue<unsigned>(replay);
+		const char * name = GLTraceRead(replay, size);
+		GLint recorded = GLTraceReadValue<GLint>(replay);
+
+		if (replay.error) {
+			return;
+		}
+
+		std::string str(name, size);
+		GLint location = ((PROC_glGetUniformLocation)replay.procs[GL_METHOD_GetUniformLocation])(program, str.c_str());
+		replay.locations[GLTraceKey(0, program) << 16 | (unsigned short)recorded] = location;
+	}
+};
+
+void GLTraceReadStrings(GLTraceReplay & replay, int count, std::vector<std::string> & strings, std::vector<const char *> & pointers) {
+	for (int i = 0; i < count && !replay.error; ++i) {
+		unsigned size = GLTraceReadValue<unsigned>(replay);
+		const char * str = GLTraceRead(replay, size);
+		strings.push_back(std::string(str ? str : "", str ? size : 0));
+	}
+
+	for (size_t i = 0; i < strings.size(); ++i) {
+		pointers.push_back(strings[i].c_str());
+	}
+}
+
+template <>
+struct GLTracePlayer<GL_METHOD_ShaderSource, PROC_glShaderSource> {
+	static void play(GLTraceReplay & replay) {
+		GLuint shader = GLTraceName(replay, 'p', GLTraceReadValue<GLuint>(replay));
+		GLsizei count = GLTraceReadValue<GLsizei>(replay);
+		std::vector<std::string> strings;
+		std::vector<const char *> pointers;
+		GLTraceReadStrings(replay, count, strings, pointers);
+		if (!replay.error) {
+			((PROC_glShaderSource)replay.procs[GL_METHOD_ShaderSource])(shader, count, pointers.data(), 0);
+		}
+	}
+};
+
+template <>
+struct GLTracePlayer<GL_METHOD_TransformFeedbackVaryings, PROC_glTransformFeedbackVaryings> {
+	static void play(GLTraceReplay & replay) {
+		GLuint program = GLTraceName(replay, 'p', GLTraceReadValue<GLuint>(replay));
+		GLsizei count = GLTraceReadValue<GLsizei>(replay);
+		std::vector<std::string> strings;
+		std::vector<const char *> pointers;
+		GLTraceReadStrings(replay, count, strings, pointers);
+		GLenum mode = GLTraceReadValue<GLenum>(replay);
+		if (!replay.error) {
+			((PROC_glTransformFeedbackVaryings)replay.procs[GL_METHOD_TransformFeedbackVaryings])(program, count, pointers.data(), mode);
+		}
+	}
+};
+
+template <>
+struct GLTracePlayer<GL_METHOD_MapBufferRange, PROC_glMapBufferRange> {
+	static void play(GLTraceReplay & replay) {
+		GLenum target = GLTraceReadValue<GLenum>(replay);
+		GLintptr offset = GLTraceReadValue<GLintptr>(replay);
+		GLsizeiptr length = GLTraceReadValue<GLsizeiptr>(replay);
+		GLbitfield access = GLTraceReadValue<GLbitfield>(replay);
+		if (!replay.error) {
+			char * ptr = (char *)((PROC_glMapBufferRange)replay.procs[GL_METHOD_MapBufferRange])(target, offset, length, access);
+			GLTraceMapping mapping = {ptr, length, access};
+			replay.mappings[target] = mapping;
+		}
+	}
+};
+
+template <>
+struct GLTracePlayer<GL_METHOD_UnmapBuffer, PROC_glUnmapBuffer> {
+	static void play(GLTraceReplay & replay) {
+		GLenum target = GLTraceReadValue<GLenum>(replay);
+		const char * data = GLTraceReadPointer(replay, 0);
+
+		if (replay.error) {
+			return;
+		}
+
+		GLTraceMapping mapping = replay.mappings[target];
+		replay.mappings.erase(target);
+
+		// The buffer is unmapped even when the data does not fit the mapped range.
+
+		if (data && (!GLTraceValidData(replay, 0, 0) || replay.pointer_sizes[0] > mapping.length)) {
+			replay.unsupported += 1;
+		} else if (mapping.ptr && data) {
+			memcpy(mapping.ptr, data, replay.pointer_sizes[0]);
+		}
+
+		((PROC_glUnmapBuffer)replay.procs[GL_METHOD_UnmapBuffer])(target);
+	}
+};
+
+typedef void (* GLTracePlay)(GLTraceReplay & replay);
+
+static GLTracePlay trace_players[NUM_GL_METHODS] = {
+#define GL_TRACE_PLAYER(name) GLTracePlayer<GL_METHOD_##name, PROC_gl##name>::play,
+	GL_METHOD_LIST(GL_TRACE_PLAYER)
+#undef GL_TRACE_PLAYER
+};
+
+inline long long GLTraceNow() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+PyObject * MGLContext_replay_trace(MGLContext * self, PyObject * args) {
+	Py_buffer data;
+	int finish;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"y*p",
+		&data,
+		&finish
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	GLTraceInitNames();
+
+	GLTraceReplay * replay = new GLTraceReplay();
+	replay->data = (const char *)data.buf;
+	replay->size = data.len;
+	replay->offset = 0;
+	replay->error = false;
+	replay->methods.resize(TRACE_UNSUPPORTED, -1);
+	replay->program = 0;
+	replay->calls = 0;
+	replay->unsupported = 0;
+
+	const GLMethods & gl = self->gl;
+
+#define GL_TRACE_PROC(name) replay->procs[GL_METHOD_##name] = (void *)gl.name;
+	GL_METHOD_LIST(GL_TRACE_PROC)
+#undef GL_TRACE_PROC
+
+	const char * magic = GLTraceRead(*replay, sizeof(trace_magic));
+	unsigned version = GLTraceReadValue<unsigned>(*replay);
+
+	if (!magic || memcmp(magic, trace_magic, sizeof(trace_magic)) || version != trace_version) {
+		MGLError_Set("not a trace of this version");
+		PyBuffer_Release(&data);
+		delete replay;
+		return 0;
+	}
+
+	PyObject * frames = PyList_New(0);
+	long long frame_start = GLTraceNow();
+	long long frame_calls = 0;
+
+	while (replay->offset < replay->size && !replay->error) {
+		unsigned short record = GLTraceReadValue<unsigned short>(*replay);
+
+		if (record == TRACE_DEFINE) {
+			unsigned short index = GLTraceReadValue<unsigned short>(*replay);
+			unsigned short size = GLTraceReadValue<unsigned short>(*replay);
+			const char * name = GLTraceRead(*replay, size);
+
+			for (int i = 0; name && i < NUM_GL_METHODS; ++i) {
+				if (strlen(gl_method_names[i]) == size && !memcmp(gl_method_names[i], name, size)) {
+					replay->methods[index] = i;
+					break;
+				}
+			}
+
+			if (name && replay->methods[index] < 0) {
+				MGLError_Set("the trace calls the unknown method %s", std::string(name, size).c_str());
+				break;
+			}
+
+		} else if (record == TRACE_FRAME) {
+			if (finish) {
+				gl.Finish();
+			}
+
+			long long now = GLTraceNow();
+			PyObject * frame = PyLong_FromLongLong(now - frame_start);
+			PyList_Append(frames, frame);
+			Py_DECREF(frame);
+			frame_start = now;
+			frame_calls = 0;
+
+		} else if (record == TRACE_UNSUPPORTED) {
+			GLTraceReadValue<unsigned short>(*replay);
+			replay->unsupported += 1;
+
+		} else {
+			int index = replay->methods[record];
+
+			if (index < 0 || !replay->procs[index]) {
+				MGLError_Set("the method %d of the trace is not available", record);
+				break;
+			}
+
+			long long unsupported = replay->unsupported;
+			trace_players[index](*replay);
+
+			if (replay->unsupported == unsupported) {
+				replay->calls += 1;
+				frame_calls += 1;
+			}
+		}
+	}
+
+	if (replay->error) {
+		MGLError_Set("the trace is truncated at %lld", replay->offset);
+	}
+
+	if (PyErr_Occurred()) {
+		Py_DECREF(frames);
+		PyBuffer_Release(&data);
+		delete replay;
+		return 0;
+	}
+
+	// The calls after the last frame are a frame too.
+
+	if (frame_calls) {
+		if (finish) {
+			gl.Finish();
+		}
+
+		PyObject * frame = PyLong_FromLongLong(GLTraceNow() - frame_start);
+		PyList_Append(frames, frame);
+		Py_DECREF(frame);
+	}
+
+	PyObject * result = Py_BuildValue("(NLL)", frames, replay->calls, replay->unsupported);
+	PyBuffer_Release(&data);
+	delete replay;
+	return result;
+}
@@ -0,0 +1,111 @@
+#include "Types.hpp"
+
+// A single level of a texture is bound to an image unit.
+// Layered textures bind every layer unless a single layer is selected.
+
+bool image_binding_from_texture(PyObject * texture, int unit, int level, int layer, int access, const char * format, MGLImageBinding * binding) {
+	MGLContext * context;
+	MGLDataType * data_type;
+	MGLCompressedFormat * compression = 0;
+
+	int texture_obj;
+	int components;
+	int levels;
+	int layers = 0;
+	bool depth = false;
+
+	if (Py_TYPE(texture) == &MGLTexture_Type) {
+		MGLTexture * texture2d = (MGLTexture *)texture;
+		context = texture2d->context;
+		data_type = texture2d->data_type;
+		compression = texture2d->compression;
+		texture_obj = texture2d->texture_obj;
+		components = texture2d->components;
+		levels = texture2d->levels;
+		depth = texture2d->depth;
+	} else if (Py_TYPE(texture) == &MGLTexture3D_Type) {
+		MGLTexture3D * texture3d = (MGLTexture3D *)texture;
+		context = texture3d->context;
+		data_type = texture3d->data_type;
+		texture_obj = texture3d->texture_obj;
+		components = texture3d->components;
+		levels = texture3d->levels;
+		layers = texture3d->depth;
+	} else if (Py_TYPE(texture) == &MGLTextureArray_Type) {
+		MGLTextureArray * texture_array = (MGLTextureArray *)texture;
+		context = texture_array->context;
+		data_type = texture_array->data_type;
+		compression = texture_array->compression;
+		texture_obj = texture_array->texture_obj;
+		components = texture_array->components;
+		levels = texture_array->levels;
+		layers = texture_array->layers;
+	} else if (Py_TYPE(texture) == &MGLTextureCube_Type) {
+		MGLTextureCube * texture_cube = (MGLTextureCube *)texture;
+		context = texture_cube->context;
+		data_type = texture_cube->data_type;
+		compression = texture_cube->compression;
+		texture_obj = texture_cube->texture_obj;
+		components = texture_cube->components;
+		levels = texture_cube->levels;
+		layers = 6;
+	} else {
+		MGLError_Set("invalid texture");
+		return false;
+	}
+
+	if (context->version_code < 420) {
+		MGLError_Set("image load/store requires OpenGL 4.2");
+		return false;
+	}
+
+	if (compression || depth) {
+		MGLError_Set("compressed and depth textures cannot be bound to an image unit");
+		return false;
+	}
+
+	if (!access) {
+		MGLError_Set("the image must be readable or writable");
+		return false;
+	}
+
+	if (level < 0 || level >= levels) {
+		MGLError_Set("the level %d is not allocated", level);
+		return false;
+	}
+
+	if (layer < -1 || layer >= layers || (layer != -1 && !layers)) {
+		MGLError_Set("invalid layer %d", layer);
+		return false;
+	}
+
+	// There are no three component image formats.
+
+	int image_format = 0;
+
+	if (format) {
+		image_format = from_image_format(format, components);
+		if (!image_format) {
+			return false;
+		}
+	} else {
+		if (components == 3) {
+			MGLError_Set("three component textures require an explicit image format");
+			return false;
+		}
+		image_format = data_type->internal_format[components];
+	}
+
+	binding->unit = unit;
+	binding->texture_obj = texture_obj;
+	binding->level = level;
+	binding->layered = layers && layer == -1;
+	binding->layer = layer == -1 ? 0 : layer;
+	binding->access = access;
+	binding->format = image_format;
+	return true;
+}
+
+void bind_image(const GLMethods & gl, const MGLImageBinding & binding) {
+	gl.BindImageTexture(binding.unit, binding.texture_obj, binding.level, binding.layered, binding.layer, binding.access, binding.format);
+}
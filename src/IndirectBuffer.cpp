@@ -0,0 +1,183 @@
+#include "Types.hpp"
+
+// Packs the indirect draw commands from the columns of the command fields.
+// A column is a single integer repeated for every command, a sequence of integers
+// or a contiguous buffer of 4 or 8 byte integers (numpy arrays, array.array).
+
+struct IndirectField {
+	PyObject * object;
+	Py_buffer view;
+	bool has_view;
+	bool is_scalar;
+	long long scalar;
+	Py_ssize_t length;
+};
+
+static bool indirect_field_init(PyObject * object, IndirectField & field) {
+	field.object = object;
+	field.has_view = false;
+	field.is_scalar = false;
+	field.length = -1;
+
+	if (PyLong_Check(object)) {
+		field.scalar = PyLong_AsLongLong(object);
+		if (PyErr_Occurred()) {
+			return false;
+		}
+		field.is_scalar = true;
+		return true;
+	}
+
+	if (PyObject_CheckBuffer(object)) {
+		if (PyObject_GetBuffer(object, &field.view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+			return false;
+		}
+
+		field.has_view = true;
+
+		const char * format = field.view.format ? field.view.format : "B";
+		if (format[0] == '<' || format[0] == '=' || format[0] == '@') {
+			format += 1;
+		}
+
+		bool integer = format[0] && !format[1] && strchr("iIlLqQ", format[0]);
+
+		if (!integer || (field.view.itemsize != 4 && field.view.itemsize != 8)) {
+			MGLError_Set("the buffer format must be a 4 or 8 byte integer not %s", field.view.format);
+			return false;
+		}
+
+		field.length = field.view.len / field.view.itemsize;
+		return true;
+	}
+
+	if (PySequence_Check(object)) {
+		field.length = PySequence_Length(object);
+		return field.length >= 0;
+	}
+
+	MGLError_Set("the command fields must be integers, sequences or buffers not %s", Py_TYPE(object)->tp_name);
+	return false;
+}
+
+static bool indirect_field_get(IndirectField & field, Py_ssize_t index, long long * value) {
+	if (field.is_scalar) {
+		*value = field.scalar;
+		return true;
+	}
+
+	if (field.has_view) {
+		const char * ptr = (const char *)field.view.buf + index * field.view.itemsize;
+		bool is_signed = strpbrk(field.view.format, "ilq") != 0;
+
+		if (field.view.itemsize == 4) {
+			*value = is_signed ? (long long)*(const int *)ptr : (long long)*(const unsigned *)ptr;
+		} else {
+			*value = *(const long long *)ptr;
+		}
+		return true;
+	}
+
+	PyObject * item = PySequence_GetItem(field.object, index);
+	if (!item) {
+		return false;
+	}
+
+	*value = PyLong_AsLongLong(item);
+	Py_DECREF(item);
+	return !PyErr_Occurred();
+}
+
+PyObject * pack_indirect(PyObject * self, PyObject * args) {
+	int indexed;
+	PyObject * fields;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"pO!",
+		&indexed,
+		&PyTuple_Type,
+		&fields
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	// DrawElementsIndirectCommand: count, instanceCount, firstIndex, baseVertex, baseInstance
+	// DrawArraysIndirectCommand: count, instanceCount, first, baseInstance
+
+	int num_fields = indexed ? 5 : 4;
+
+	if (PyTuple_GET_SIZE(fields) != num_fields) {
+		MGLError_Set("the number of command fields must be %d", num_fields);
+		return 0;
+	}
+
+	IndirectField field[5];
+	int ready = 0;
+	Py_ssize_t count = -1;
+	PyObject * result = 0;
+
+	for (ready = 0; ready < num_fields; ++ready) {
+		if (!indirect_field_init(PyTuple_GET_ITEM(fields, ready), field[ready])) {
+			ready += field[ready].has_view ? 1 : 0;
+			goto cleanup;
+		}
+
+		if (field[ready].length >= 0) {
+			if (count >= 0 && count != field[ready].length) {
+				MGLError_Set("the command fields have different lengths %d and %d", (int)count, (int)field[ready].length);
+				ready += 1;
+				goto cleanup;
+			}
+			count = field[ready].length;
+		}
+	}
+
+	if (count < 0) {
+		count = 1;
+	}
+
+	result = PyBytes_FromStringAndSize(0, count * num_fields * 4);
+	if (!result) {
+		goto cleanup;
+	}
+
+	{
+		unsigned * commands = (unsigned *)PyBytes_AS_STRING(result);
+
+		for (Py_ssize_t i = 0; i < count; ++i) {
+			for (int j = 0; j < num_fields; ++j) {
+				long long value;
+
+				if (!indirect_field_get(field[j], i, &value)) {
+					Py_CLEAR(result);
+					goto cleanup;
+				}
+
+				// Only the baseVertex of the indexed commands is signed.
+
+				bool is_signed = indexed && j == 3;
+				bool valid = is_signed ? (value >= -2147483648LL && value <= 2147483647LL) : (value >= 0 && value <= 4294967295LL);
+
+				if (!valid) {
+					MGLError_Set("the command field %d of command %d is out of range: %lld", j, (int)i, value);
+					Py_CLEAR(result);
+					goto cleanup;
+				}
+
+				commands[i * num_fields + j] = (unsigned)value;
+			}
+		}
+	}
+
+cleanup:
+	for (int i = 0; i < ready; ++i) {
+		if (field[i].has_view) {
+			PyBuffer_Release(&field[i].view);
+		}
+	}
+
+	return result;
+}
@@ -162,6 +162,74 @@ inline PyObject * compare_func_to_string(int func) {
 	}
 }
 
+inline int image_access(int read, int write) {
+	if (read && write) {
+		return GL_READ_WRITE;
+	}
+	if (read) {
+		return GL_READ_ONLY;
+	}
+	if (write) {
+		return GL_WRITE_ONLY;
+	}
+	return 0;
+}
+
+inline int texture_level_count(int width, int height, int depth) {
+	int size = width > height ? width : height;
+	size = size > depth ? size : depth;
+
+	int levels = 1;
+	while (size > 1) {
+		size /= 2;
+		levels += 1;
+	}
+
+	return levels;
+}
+
+inline int texture_level_size(int size, int level) {
+	size = size >> level;
+	return size > 1 ? size : 1;
+}
+
+inline long long compressed_image_size(MGLCompressedFormat * format, int width, int height) {
+	long long blocks_x = (width + format->block_width - 1) / format->block_width;
+	long long blocks_y = (height + format->block_height - 1) / format->block_height;
+	return blocks_x * blocks_y * format->block_size;
+}
+
+inline bool compressed_region_aligned(MGLCompressedFormat * format, int x, int y, int width, int height, int level_width, int level_height) {
+	if (x % format->block_width || y % format->block_height) {
+		return false;
+	}
+
+	// Partial blocks are only allowed on the right and bottom edge of the level.
+
+	if (width % format->block_width && x + width != level_width) {
+		return false;
+	}
+
+	if (height % format->block_height && y + height != level_height) {
+		return false;
+	}
+
+	return true;
+}
+
+inline long long texture_level_bytes(int width, int height, int level, int components, MGLDataType * data_type, int alignment, MGLCompressedFormat * compression) {
+	width = texture_level_size(width, level);
+	height = texture_level_size(height, level);
+
+	if (compression) {
+		return compressed_image_size(compression, width, height);
+	}
+
+	long long row = (long long)width * components * data_type->size;
+	row = (row + alignment - 1) / alignment * alignment;
+	return row * height;
+}
+
 inline PyObject * tuple2(PyObject * a, PyObject * b) {
 	PyObject * res = PyTuple_New(2);
 	PyTuple_SET_ITEM(res, 0, a);
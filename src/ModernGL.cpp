@@ -115,7 +115,16 @@ PyObject * create_standalone_context(PyObject * self, PyObject * args) {
 
 	MGLContext * ctx = (MGLContext *)MGLContext_Type.tp_alloc(&MGLContext_Type, 0);
 
-	ctx->gl_context = CreateGLContext(settings);
+	PyObject * backend = (settings != Py_None) ? PyDict_GetItemString(settings, "backend") : 0;
+
+	if (backend && PyUnicode_Check(backend) && !PyUnicode_CompareWithASCIIString(backend, "null")) {
+		ctx->gl_context = {};
+		ctx->null_backend = true;
+		LoadNullMethods(ctx->gl, settings);
+	} else {
+		ctx->gl_context = CreateGLContext(settings);
+	}
+
 	ctx->wireframe = false;
 
 	if (PyErr_Occurred()) {
@@ -160,11 +169,16 @@ PyObject * create_context(PyObject * self) {
 	return result;
 }
 
+PyObject * compress_texture(PyObject * self, PyObject * args);
+PyObject * pack_indirect(PyObject * self, PyObject * args);
+
 PyMethodDef MGL_module_methods[] = {
 	{"strsize", (PyCFunction)strsize, METH_VARARGS, 0},
 	{"create_standalone_context", (PyCFunction)create_standalone_context, METH_VARARGS, 0},
 	{"create_context", (PyCFunction)create_context, METH_NOARGS, 0},
 	{"fmtdebug", (PyCFunction)fmtdebug, METH_VARARGS, 0},
+	{"compress", (PyCFunction)compress_texture, METH_VARARGS, 0},
+	{"pack_indirect", (PyCFunction)pack_indirect, METH_VARARGS, 0},
 	{0},
 };
 
@@ -191,6 +205,17 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "Attribute", (PyObject *)&MGLAttribute_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLBlockWriter_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register BlockWriter in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLBlockWriter_Type);
+
+		PyModule_AddObject(module, "BlockWriter", (PyObject *)&MGLBlockWriter_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLBuffer_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register Buffer in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -257,6 +282,17 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "Program", (PyObject *)&MGLProgram_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLProgramPipeline_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register ProgramPipeline in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLProgramPipeline_Type);
+
+		PyModule_AddObject(module, "ProgramPipeline", (PyObject *)&MGLProgramPipeline_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLQuery_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register Query in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -268,6 +304,17 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "Query", (PyObject *)&MGLQuery_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLQueryPool_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register QueryPool in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLQueryPool_Type);
+
+		PyModule_AddObject(module, "QueryPool", (PyObject *)&MGLQueryPool_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLRenderbuffer_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register Renderbuffer in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -345,6 +392,17 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "Uniform", (PyObject *)&MGLUniform_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLUniformBatch_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register UniformBatch in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLUniformBatch_Type);
+
+		PyModule_AddObject(module, "UniformBatch", (PyObject *)&MGLUniformBatch_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLUniformBlock_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register UniformBlock in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -356,6 +414,17 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "UniformBlock", (PyObject *)&MGLUniformBlock_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLUniformRing_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register UniformRing in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLUniformRing_Type);
+
+		PyModule_AddObject(module, "UniformRing", (PyObject *)&MGLUniformRing_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLVertexArray_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register VertexArray in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
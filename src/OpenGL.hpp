@@ -690,6 +690,8 @@ typedef GLvoid (GLAPI * PROC_glGetnUniformiv)(GLuint program, GLint location, GL
 typedef GLvoid (GLAPI * PROC_glGetnUniformuiv)(GLuint program, GLint location, GLsizei bufSize, GLuint * params);
 typedef GLvoid (GLAPI * PROC_glReadnPixels)(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, GLvoid * data);
 typedef GLvoid (GLAPI * PROC_glTextureBarrier)();
+typedef GLvoid (GLAPI * PROC_glMultiDrawArraysIndirectCount)(GLenum mode, const GLvoid * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride);
+typedef GLvoid (GLAPI * PROC_glMultiDrawElementsIndirectCount)(GLenum mode, GLenum type, const GLvoid * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride);
 
 #define GL_DEPTH_BUFFER_BIT                                           0x0100
 #define GL_STENCIL_BUFFER_BIT                                         0x0400
@@ -2035,3 +2037,15 @@ typedef GLvoid (GLAPI * PROC_glTextureBarrier)();
 #define GL_INVALID_INDEX                                              0xFFFFFFFF
 #define GL_ALL_SHADER_BITS                                            0xFFFFFFFF
 #define GL_ALL_BARRIER_BITS                                           0xFFFFFFFF
+#define GL_PARAMETER_BUFFER                                           0x80EE
+#define GL_PARAMETER_BUFFER_BINDING                                   0x80EF
+#define GL_VERTICES_SUBMITTED                                         0x82EE
+#define GL_PRIMITIVES_SUBMITTED                                       0x82EF
+#define GL_VERTEX_SHADER_INVOCATIONS                                  0x82F0
+#define GL_TESS_CONTROL_SHADER_PATCHES                                0x82F1
+#define GL_TESS_EVALUATION_SHADER_INVOCATIONS                         0x82F2
+#define GL_GEOMETRY_SHADER_PRIMITIVES_EMITTED                         0x82F3
+#define GL_FRAGMENT_SHADER_INVOCATIONS                                0x82F4
+#define GL_COMPUTE_SHADER_INVOCATIONS                                 0x82F5
+#define GL_CLIPPING_INPUT_PRIMITIVES                                  0x82F6
+#define GL_CLIPPING_OUTPUT_PRIMITIVES                                 0x82F7
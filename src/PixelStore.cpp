@@ -0,0 +1,203 @@
+#include "Types.hpp"
+
+// Strided buffer views are transferred in place.
+// The row and image strides of the view become the row length and image height of the pixel store,
+// the first pixel of the view is the start of the transfer so the skip parameters stay zero.
+
+bool pixel_store_from_view(Py_buffer * view, int width, int height, int depth, int components, MGLDataType * data_type, int alignment, MGLPixelStore * store) {
+	store->alignment = alignment;
+	store->row_length = 0;
+	store->image_height = 0;
+	store->strided = false;
+
+	if (PyBuffer_IsContiguous(view, 'C')) {
+		return true;
+	}
+
+	int pixel_size = components * data_type->size;
+
+	// The trailing dimensions of the view must hold whole pixels.
+
+	int max_dims = 3;
+	int dims = view->ndim;
+	Py_ssize_t pixel_bytes = view->itemsize;
+
+	while (dims > 0 && (pixel_bytes < pixel_size || (dims > max_dims && view->shape[dims - 1] == 1))) {
+		if (view->shape[dims - 1] != 1 && view->strides[dims - 1] != pixel_bytes) {
+			MGLError_Set("the components of a pixel must be contiguous");
+			return false;
+		}
+		pixel_bytes *= view->shape[dims - 1];
+		dims -= 1;
+	}
+
+	if (pixel_bytes != pixel_size || dims > max_dims) {
+		MGLError_Set("the data must have the shape (height, width, %d) with %d byte components", components, data_type->size);
+		return false;
+	}
+
+	// Missing leading dimensions have a single element.
+
+	Py_ssize_t shape[3] = {1, 1, 1};
+	Py_ssize_t strides[3] = {0, 0, pixel_size};
+
+	for (int i = 0; i < dims; ++i) {
+		shape[3 - dims + i] = view->shape[i];
+		strides[3 - dims + i] = view->strides[i];
+	}
+
+	if (shape[0] != depth || shape[1] != height || shape[2] != width) {
+		MGLError_Set("data shape mismatch (%d, %d, %d) != (%d, %d, %d)", (int)shape[0], (int)shape[1], (int)shape[2], depth, height, width);
+		return false;
+	}
+
+	if (width > 1 && strides[2] != pixel_size) {
+		MGLError_Set("the pixels of a row must be contiguous");
+		return false;
+	}
+
+	Py_ssize_t row_stride = height > 1 ? strides[1] : width * pixel_size;
+	Py_ssize_t image_stride = depth > 1 ? strides[0] : row_stride * height;
+
+	if (row_stride < width * pixel_size || image_stride < row_stride * height) {
+		MGLError_Set("the strides of the data must be positive and must not overlap");
+		return false;
+	}
+
+	// Rows padded to a whole number of pixels only need the row length.
+	// Other paddings are expressed with the alignment when the components are smaller than it.
+
+	int row_length = (int)(row_stride / pixel_size);
+	int row_alignment = 0;
+
+	if (row_stride % pixel_size == 0) {
+		row_alignment = 1;
+	} else {
+		for (int candidate = 2; candidate <= 8; candidate *= 2) {
+			if (candidate > data_type->size && (row_length * pixel_size + candidate - 1) / candidate * candidate == row_stride) {
+				row_alignment = candidate;
+				break;
+			}
+		}
+	}
+
+	if (!row_alignment) {
+		MGLError_Set("the row stride %d cannot be expressed with the pixel store", (int)row_stride);
+		return false;
+	}
+
+	if (image_stride % row_stride) {
+		MGLError_Set("the image stride %d is not a multiple of the row stride %d", (int)image_stride, (int)row_stride);
+		return false;
+	}
+
+	store->alignment = row_alignment;
+	store->row_length = row_length;
+	store->image_height = (int)(image_stride / row_stride);
+	store->strided = true;
+	return true;
+}
+
+void set_pixel_store(const GLMethods & gl, const MGLPixelStore & store) {
+	gl.PixelStorei(GL_PACK_ALIGNMENT, store.alignment);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, store.alignment);
+
+	if (store.strided) {
+		gl.PixelStorei(GL_PACK_ROW_LENGTH, store.row_length);
+		gl.PixelStorei(GL_UNPACK_ROW_LENGTH, store.row_length);
+		gl.PixelStorei(GL_PACK_IMAGE_HEIGHT, store.image_height);
+		gl.PixelStorei(GL_UNPACK_IMAGE_HEIGHT, store.image_height);
+	}
+}
+
+void reset_pixel_store(const GLMethods & gl, const MGLPixelStore & store) {
+	// The other transfers expect tightly packed rows.
+
+	if (store.strided) {
+		gl.PixelStorei(GL_PACK_ROW_LENGTH, 0);
+		gl.PixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+		gl.PixelStorei(GL_PACK_IMAGE_HEIGHT, 0);
+		gl.PixelStorei(GL_UNPACK_IMAGE_HEIGHT, 0);
+	}
+}
+
+// The size of a pixel in client memory for the format and type of a pixel transfer.
+
+int pixel_format_size(int format, int type) {
+	int components = 4;
+
+	switch (format) {
+		case GL_RED:
+		case GL_GREEN:
+		case GL_BLUE:
+		case GL_ALPHA:
+		case GL_RED_INTEGER:
+		case GL_DEPTH_COMPONENT:
+		case GL_STENCIL_INDEX:
+		case GL_DEPTH_STENCIL:
+			components = 1;
+			break;
+
+		case GL_RG:
+		case GL_RG_INTEGER:
+			components = 2;
+			break;
+
+		case GL_RGB:
+		case GL_BGR:
+		case GL_RGB_INTEGER:
+		case GL_BGR_INTEGER:
+			components = 3;
+			break;
+	}
+
+	switch (type) {
+		case GL_BYTE:
+		case GL_UNSIGNED_BYTE:
+			return components;
+
+		case GL_SHORT:
+		case GL_UNSIGNED_SHORT:
+		case GL_HALF_FLOAT:
+			return components * 2;
+
+		case GL_INT:
+		case GL_UNSIGNED_INT:
+		case GL_FLOAT:
+			return components * 4;
+
+		case GL_UNSIGNED_SHORT_5_6_5:
+		case GL_UNSIGNED_SHORT_4_4_4_4:
+		case GL_UNSIGNED_SHORT_5_5_5_1:
+			return 2;
+
+		case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+			return 8;
+	}
+
+	return 4;
+}
+
+// The size of a pixel transfer in client memory with the current pixel store of the context.
+// The skip parameters are not used by the module.
+
+long long pixel_transfer_size(PROC_glGetIntegerv get_integer, bool pack, int width, int height, int depth, int format, int type) {
+	int alignment = 4;
+	int row_length = 0;
+	int image_height = 0;
+
+	get_integer(pack ? GL_PACK_ALIGNMENT : GL_UNPACK_ALIGNMENT, &alignment);
+	get_integer(pack ? GL_PACK_ROW_LENGTH : GL_UNPACK_ROW_LENGTH, &row_length);
+	get_integer(pack ? GL_PACK_IMAGE_HEIGHT : GL_UNPACK_IMAGE_HEIGHT, &image_height);
+
+	if (width <= 0 || height <= 0 || depth <= 0) {
+		return 0;
+	}
+
+	long long pixel_size = pixel_format_size(format, type);
+	long long row_bytes = (row_length ? row_length : width) * pixel_size;
+	row_bytes = (row_bytes + alignment - 1) / alignment * alignment;
+	long long image_rows = image_height ? image_height : height;
+
+	return row_bytes * (image_rows * (depth - 1) + height - 1) + width * pixel_size;
+}
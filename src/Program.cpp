@@ -5,22 +5,29 @@
 PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 	PyObject * shaders[5];
 	PyObject * outputs;
+	int separable;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OOOOOO",
+		"OOOOOOp",
 		&shaders[0],
 		&shaders[1],
 		&shaders[2],
 		&shaders[3],
 		&shaders[4],
-		&outputs
+		&outputs,
+		&separable
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
+	if (separable && self->version_code < 410) {
+		MGLError_Set("separable programs require OpenGL 4.1");
+		return 0;
+	}
+
 	int num_outputs = (int)PyTuple_GET_SIZE(outputs);
 
 	for (int i = 0; i < num_outputs; ++i) {
@@ -115,6 +122,10 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 		delete[] varyings_array;
 	}
 
+	if (separable) {
+		gl.ProgramParameteri(program_obj, GL_PROGRAM_SEPARABLE, GL_TRUE);
+	}
+
 	gl.LinkProgram(program_obj);
 
 	int linked = GL_FALSE;
@@ -140,6 +151,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 	}
 
 	program->program_obj = program_obj;
+	program->separable = separable ? true : false;
 
 	// int num_vertex_shader_subroutine_locations = 0;
 	// int num_fragment_shader_subroutine_locations = 0;
@@ -433,7 +445,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 		mglo->location = location;
 		mglo->array_length = array_length;
 		mglo->program_obj = program->program_obj;
-		MGLAttribute_Complete(mglo, gl);
+		MGLAttribute_Complete(mglo);
 
 		PyObject * item = PyTuple_New(6);
 		PyTuple_SET_ITEM(item, 0, (PyObject *)mglo);
@@ -485,7 +497,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 		mglo->location = location;
 		mglo->array_length = array_length;
 		mglo->program_obj = program->program_obj;
-		MGLUniform_Complete(mglo, gl);
+		MGLUniform_Complete(mglo);
 
 		PyObject * item = PyTuple_New(5);
 		PyTuple_SET_ITEM(item, 0, (PyObject *)mglo);
@@ -502,6 +514,8 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 		_PyTuple_Resize(&uniforms_lst, uniform_counter);
 	}
 
+	MGLUniformShadow_Initialize(&program->uniform_shadow, uniforms_lst, gl);
+
 	for (int i = 0; i < num_uniform_blocks; ++i) {
 		int size = 0;
 		int name_len = 0;
@@ -515,6 +529,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 
 		MGLUniformBlock * mglo = (MGLUniformBlock *)MGLUniformBlock_Type.tp_alloc(&MGLUniformBlock_Type, 0);
 
+		mglo->interface = GL_UNIFORM_BLOCK;
 		mglo->index = index;
 		mglo->size = size;
 		mglo->program_obj = program->program_obj;
@@ -529,6 +544,14 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 		PyTuple_SET_ITEM(uniform_blocks_lst, i, item);
 	}
 
+	PyObject * storage_blocks_lst = 0;
+
+	if (program->context->version_code >= 430) {
+		storage_blocks_lst = MGLUniformBlock_StorageBlocks(gl, program->program_obj);
+	} else {
+		storage_blocks_lst = PyTuple_New(0);
+	}
+
 	int subroutine_uniforms_base = 0;
 	int subroutines_base = 0;
 
@@ -590,16 +613,17 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 	}
 	PyTuple_SET_ITEM(geom_info, 2, PyLong_FromLong(program->geometry_vertices));
 
-	PyObject * result = PyTuple_New(9);
+	PyObject * result = PyTuple_New(10);
 	PyTuple_SET_ITEM(result, 0, (PyObject *)program);
 	PyTuple_SET_ITEM(result, 1, attributes_lst);
 	PyTuple_SET_ITEM(result, 2, varyings_lst);
 	PyTuple_SET_ITEM(result, 3, uniforms_lst);
 	PyTuple_SET_ITEM(result, 4, uniform_blocks_lst);
-	PyTuple_SET_ITEM(result, 5, subroutines_lst);
-	PyTuple_SET_ITEM(result, 6, subroutine_uniforms_lst);
-	PyTuple_SET_ITEM(result, 7, geom_info);
-	PyTuple_SET_ITEM(result, 8, PyLong_FromLong(program->program_obj));
+	PyTuple_SET_ITEM(result, 5, storage_blocks_lst);
+	PyTuple_SET_ITEM(result, 6, subroutines_lst);
+	PyTuple_SET_ITEM(result, 7, subroutine_uniforms_lst);
+	PyTuple_SET_ITEM(result, 8, geom_info);
+	PyTuple_SET_ITEM(result, 9, PyLong_FromLong(program->program_obj));
 	return result;
 }
 
@@ -621,7 +645,10 @@ PyObject * MGLProgram_release(MGLProgram * self) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLProgram_uniform_batch(MGLProgram * self, PyObject * args);
+
 PyMethodDef MGLProgram_tp_methods[] = {
+	{"uniform_batch", (PyCFunction)MGLProgram_uniform_batch, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLProgram_release, METH_NOARGS, 0},
 	{0},
 };
@@ -674,6 +701,8 @@ void MGLProgram_Invalidate(MGLProgram * program) {
 
 	// TODO: decref
 
+	MGLUniformShadow_Release(&program->uniform_shadow);
+
 	const GLMethods & gl = program->context->gl;
 	gl.DeleteProgram(program->program_obj);
 
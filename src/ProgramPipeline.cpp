@@ -0,0 +1,183 @@
+#include "Types.hpp"
+
+PyObject * MGLContext_program_pipeline(MGLContext * self, PyObject * args) {
+	PyObject * programs;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!",
+		&PyTuple_Type,
+		&programs
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (self->version_code < 410) {
+		MGLError_Set("program pipelines require OpenGL 4.1");
+		return 0;
+	}
+
+	if (PyTuple_GET_SIZE(programs) != NUM_SHADER_SLOTS) {
+		MGLError_Set("invalid programs");
+		return 0;
+	}
+
+	bool empty = true;
+
+	for (int i = 0; i < NUM_SHADER_SLOTS; ++i) {
+		MGLProgram * program = (MGLProgram *)PyTuple_GET_ITEM(programs, i);
+
+		if ((PyObject *)program == Py_None) {
+			continue;
+		}
+
+		if (Py_TYPE(program) != &MGLProgram_Type) {
+			MGLError_Set("programs[%d] must be a Program not %s", i, Py_TYPE(program)->tp_name);
+			return 0;
+		}
+
+		if (program->context != self) {
+			MGLError_Set("programs[%d] belongs to a different context", i);
+			return 0;
+		}
+
+		if (!program->separable) {
+			MGLError_Set("programs[%d] is not a separable program", i);
+			return 0;
+		}
+
+		empty = false;
+	}
+
+	if (empty) {
+		MGLError_Set("the pipeline must have at least one stage");
+		return 0;
+	}
+
+	const GLMethods & gl = self->gl;
+
+	MGLProgramPipeline * pipeline = (MGLProgramPipeline *)MGLProgramPipeline_Type.tp_alloc(&MGLProgramPipeline_Type, 0);
+
+	pipeline->pipeline_obj = 0;
+	gl.GenProgramPipelines(1, (GLuint *)&pipeline->pipeline_obj);
+
+	if (!pipeline->pipeline_obj) {
+		MGLError_Set("cannot create program pipeline");
+		Py_DECREF(pipeline);
+		return 0;
+	}
+
+	// The stages are attached once, binding the pipeline later is a single call.
+
+	const int stage_bits[] = {
+		GL_VERTEX_SHADER_BIT,
+		GL_FRAGMENT_SHADER_BIT,
+		GL_GEOMETRY_SHADER_BIT,
+		GL_TESS_CONTROL_SHADER_BIT,
+		GL_TESS_EVALUATION_SHADER_BIT,
+	};
+
+	for (int i = 0; i < NUM_SHADER_SLOTS; ++i) {
+		MGLProgram * program = (MGLProgram *)PyTuple_GET_ITEM(programs, i);
+
+		if ((PyObject *)program == Py_None) {
+			pipeline->programs[i] = 0;
+			continue;
+		}
+
+		gl.UseProgramStages(pipeline->pipeline_obj, stage_bits[i], program->program_obj);
+
+		Py_INCREF(program);
+		pipeline->programs[i] = program;
+	}
+
+	Py_INCREF(self);
+	pipeline->context = self;
+
+	Py_INCREF(pipeline);
+
+	PyObject * result = PyTuple_New(2);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)pipeline);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(pipeline->pipeline_obj));
+	return result;
+}
+
+PyObject * MGLProgramPipeline_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLProgramPipeline * self = (MGLProgramPipeline *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLProgramPipeline_tp_dealloc(MGLProgramPipeline * self) {
+	MGLProgramPipeline_Type.tp_free((PyObject *)self);
+}
+
+PyObject * MGLProgramPipeline_release(MGLProgramPipeline * self) {
+	MGLProgramPipeline_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLProgramPipeline_tp_methods[] = {
+	{"release", (PyCFunction)MGLProgramPipeline_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyTypeObject MGLProgramPipeline_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.ProgramPipeline",                                  // tp_name
+	sizeof(MGLProgramPipeline),                             // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLProgramPipeline_tp_dealloc,              // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLProgramPipeline_tp_methods,                          // tp_methods
+	0,                                                      // tp_members
+	0,                                                      // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLProgramPipeline_tp_new,                              // tp_new
+};
+
+void MGLProgramPipeline_Invalidate(MGLProgramPipeline * pipeline) {
+	if (Py_TYPE(pipeline) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	// TODO: decref
+
+	const GLMethods & gl = pipeline->context->gl;
+	gl.DeleteProgramPipelines(1, (GLuint *)&pipeline->pipeline_obj);
+
+	Py_TYPE(pipeline) = &MGLInvalidObject_Type;
+	Py_DECREF(pipeline);
+}
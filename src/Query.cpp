@@ -2,27 +2,54 @@
 
 #include "InlineMethods.hpp"
 
+// The targets of the query keys, in the order of MGLQueryKeys.
+
+static const int query_targets[NUM_QUERY_KEYS] = {
+	GL_SAMPLES_PASSED,
+	GL_ANY_SAMPLES_PASSED,
+	GL_TIME_ELAPSED,
+	GL_PRIMITIVES_GENERATED,
+	GL_VERTICES_SUBMITTED,
+	GL_PRIMITIVES_SUBMITTED,
+	GL_VERTEX_SHADER_INVOCATIONS,
+	GL_TESS_CONTROL_SHADER_PATCHES,
+	GL_TESS_EVALUATION_SHADER_INVOCATIONS,
+	GL_GEOMETRY_SHADER_INVOCATIONS,
+	GL_GEOMETRY_SHADER_PRIMITIVES_EMITTED,
+	GL_FRAGMENT_SHADER_INVOCATIONS,
+	GL_COMPUTE_SHADER_INVOCATIONS,
+	GL_CLIPPING_INPUT_PRIMITIVES,
+	GL_CLIPPING_OUTPUT_PRIMITIVES,
+};
+
 PyObject * MGLContext_query(MGLContext * self, PyObject * args) {
 	int samples_passed;
 	int any_samples_passed;
 	int time_elapsed;
 	int primitives_generated;
+	int pipeline_statistics;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"pppp",
+		"ppppp",
 		&samples_passed,
 		&any_samples_passed,
 		&time_elapsed,
-		&primitives_generated
+		&primitives_generated,
+		&pipeline_statistics
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
+	if (pipeline_statistics && !self->pipeline_statistics) {
+		MGLError_Set("pipeline statistics require OpenGL 4.6 or ARB_pipeline_statistics_query");
+		return 0;
+	}
+
 	// If none of them is set, all will be set.
-	if (!(samples_passed + any_samples_passed + time_elapsed + primitives_generated)) {
+	if (!(samples_passed + any_samples_passed + time_elapsed + primitives_generated + pipeline_statistics)) {
 		samples_passed = 1;
 		any_samples_passed = 1;
 		time_elapsed = 1;
@@ -48,6 +75,9 @@ PyObject * MGLContext_query(MGLContext * self, PyObject * args) {
 	if (primitives_generated) {
 		gl.GenQueries(1, (GLuint *)&query->query_obj[PRIMITIVES_GENERATED]);
 	}
+	if (pipeline_statistics) {
+		gl.GenQueries(NUM_QUERY_KEYS - VERTICES_SUBMITTED, (GLuint *)&query->query_obj[VERTICES_SUBMITTED]);
+	}
 
 	// PyObject * result = PyTuple_New(2);
 	// PyTuple_SET_ITEM(result, 0, (PyObject *)query);
@@ -98,6 +128,12 @@ PyObject * MGLQuery_begin(MGLQuery * self, PyObject * args) {
 		gl.BeginQuery(GL_PRIMITIVES_GENERATED, self->query_obj[PRIMITIVES_GENERATED]);
 	}
 
+	for (int i = VERTICES_SUBMITTED; i < NUM_QUERY_KEYS; ++i) {
+		if (self->query_obj[i]) {
+			gl.BeginQuery(query_targets[i], self->query_obj[i]);
+		}
+	}
+
 	Py_RETURN_NONE;
 }
 
@@ -129,6 +165,12 @@ PyObject * MGLQuery_end(MGLQuery * self, PyObject * args) {
 		gl.EndQuery(GL_PRIMITIVES_GENERATED);
 	}
 
+	for (int i = VERTICES_SUBMITTED; i < NUM_QUERY_KEYS; ++i) {
+		if (self->query_obj[i]) {
+			gl.EndQuery(query_targets[i]);
+		}
+	}
+
 	Py_RETURN_NONE;
 }
 
@@ -183,34 +225,73 @@ PyMethodDef MGLQuery_tp_methods[] = {
 PyObject * MGLQuery_get_samples(MGLQuery * self) {
 	const GLMethods & gl = self->context->gl;
 
-	int samples = 0;
-	gl.GetQueryObjectiv(self->query_obj[SAMPLES_PASSED], GL_QUERY_RESULT, &samples);
+	GLint64 samples = 0;
+	gl.GetQueryObjecti64v(self->query_obj[SAMPLES_PASSED], GL_QUERY_RESULT, &samples);
 
-	return PyLong_FromLong(samples);
+	return PyLong_FromLongLong(samples);
 }
 
 PyObject * MGLQuery_get_primitives(MGLQuery * self) {
 	const GLMethods & gl = self->context->gl;
 
-	int primitives = 0;
-	gl.GetQueryObjectiv(self->query_obj[PRIMITIVES_GENERATED], GL_QUERY_RESULT, &primitives);
+	GLint64 primitives = 0;
+	gl.GetQueryObjecti64v(self->query_obj[PRIMITIVES_GENERATED], GL_QUERY_RESULT, &primitives);
 
-	return PyLong_FromLong(primitives);
+	return PyLong_FromLongLong(primitives);
 }
 
 PyObject * MGLQuery_get_elapsed(MGLQuery * self) {
 	const GLMethods & gl = self->context->gl;
 
-	int elapsed = 0;
-	gl.GetQueryObjectiv(self->query_obj[TIME_ELAPSED], GL_QUERY_RESULT, &elapsed);
+	GLint64 elapsed = 0;
+	gl.GetQueryObjecti64v(self->query_obj[TIME_ELAPSED], GL_QUERY_RESULT, &elapsed);
+
+	return PyLong_FromLongLong(elapsed);
+}
+
+PyObject * MGLQuery_get_statistics(MGLQuery * self) {
+	if (!self->query_obj[VERTICES_SUBMITTED]) {
+		Py_RETURN_NONE;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	PyObject * result = PyTuple_New(NUM_QUERY_KEYS - VERTICES_SUBMITTED);
+
+	for (int i = VERTICES_SUBMITTED; i < NUM_QUERY_KEYS; ++i) {
+		GLint64 value = 0;
+		gl.GetQueryObjecti64v(self->query_obj[i], GL_QUERY_RESULT, &value);
+		PyTuple_SET_ITEM(result, i - VERTICES_SUBMITTED, PyLong_FromLongLong(value));
+	}
+
+	return result;
+}
+
+PyObject * MGLQuery_get_ready(MGLQuery * self) {
+	const GLMethods & gl = self->context->gl;
+
+	for (int i = 0; i < NUM_QUERY_KEYS; ++i) {
+		if (!self->query_obj[i]) {
+			continue;
+		}
+
+		int available = 0;
+		gl.GetQueryObjectiv(self->query_obj[i], GL_QUERY_RESULT_AVAILABLE, &available);
+
+		if (!available) {
+			Py_RETURN_FALSE;
+		}
+	}
 
-	return PyLong_FromLong(elapsed);
+	Py_RETURN_TRUE;
 }
 
 PyGetSetDef MGLQuery_tp_getseters[] = {
 	{(char *)"samples", (getter)MGLQuery_get_samples, 0, 0, 0},
 	{(char *)"primitives", (getter)MGLQuery_get_primitives, 0, 0, 0},
 	{(char *)"elapsed", (getter)MGLQuery_get_elapsed, 0, 0, 0},
+	{(char *)"statistics", (getter)MGLQuery_get_statistics, 0, 0, 0},
+	{(char *)"ready", (getter)MGLQuery_get_ready, 0, 0, 0},
 	{0},
 };
 
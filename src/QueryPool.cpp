@@ -0,0 +1,428 @@
+#include "Types.hpp"
+
+PyObject * MGLContext_query_pool(MGLContext * self, PyObject * args) {
+	int size;
+	int target;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"iI",
+		&size,
+		&target
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (size < 1) {
+		MGLError_Set("the size must be greater than zero");
+		return 0;
+	}
+
+	bool statistic = (target >= GL_VERTICES_SUBMITTED && target <= GL_CLIPPING_OUTPUT_PRIMITIVES);
+
+	if ((statistic || target == GL_GEOMETRY_SHADER_INVOCATIONS) && !self->pipeline_statistics) {
+		MGLError_Set("pipeline statistics require OpenGL 4.6 or ARB_pipeline_statistics_query");
+		return 0;
+	}
+
+	const GLMethods & gl = self->gl;
+
+	MGLQueryPool * pool = (MGLQueryPool *)MGLQueryPool_Type.tp_alloc(&MGLQueryPool_Type, 0);
+
+	pool->target = target;
+	pool->size = size;
+	pool->active = -1;
+	pool->num_pending = 0;
+	pool->query_objs = new unsigned[size]();
+	pool->results = new long long[size];
+	pool->pending = new char[size]();
+
+	for (int i = 0; i < size; ++i) {
+		pool->results[i] = -1;
+	}
+
+	// The names are reserved in a single call, the query objects are created by their first use.
+
+	gl.GenQueries(size, pool->query_objs);
+
+	Py_INCREF(self);
+	pool->context = self;
+
+	Py_INCREF(pool);
+	return (PyObject *)pool;
+}
+
+PyObject * MGLQueryPool_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLQueryPool * self = (MGLQueryPool *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLQueryPool_tp_dealloc(MGLQueryPool * self) {
+	MGLQueryPool_Type.tp_free((PyObject *)self);
+}
+
+bool MGLQueryPool_Begin(MGLQueryPool * pool, int index) {
+	if (pool->target == GL_TIMESTAMP) {
+		MGLError_Set("timestamp queries have no begin and end");
+		return false;
+	}
+
+	if (pool->active >= 0) {
+		MGLError_Set("the query %d is still active", pool->active);
+		return false;
+	}
+
+	if (index < 0 || index >= pool->size) {
+		MGLError_Set("the index %d is out of range", index);
+		return false;
+	}
+
+	// A query issued again before its result was read replaces the pending result.
+
+	if (!pool->pending[index]) {
+		pool->pending[index] = 1;
+		pool->num_pending += 1;
+	}
+
+	const GLMethods & gl = pool->context->gl;
+	gl.BeginQuery(pool->target, pool->query_objs[index]);
+	pool->active = index;
+	return true;
+}
+
+void MGLQueryPool_End(MGLQueryPool * pool) {
+	const GLMethods & gl = pool->context->gl;
+	gl.EndQuery(pool->target);
+	pool->active = -1;
+}
+
+void MGLQueryPool_Poll(MGLQueryPool * pool, int first, int count, bool wait) {
+	if (!pool->num_pending) {
+		return;
+	}
+
+	const GLMethods & gl = pool->context->gl;
+
+	for (int i = first; i < first + count; ++i) {
+		if (!pool->pending[i] || i == pool->active) {
+			continue;
+		}
+
+		if (!wait) {
+			int available = 0;
+			gl.GetQueryObjectiv(pool->query_objs[i], GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available) {
+				continue;
+			}
+		}
+
+		GLint64 result = 0;
+		gl.GetQueryObjecti64v(pool->query_objs[i], GL_QUERY_RESULT, &result);
+		pool->results[i] = result;
+		pool->pending[i] = 0;
+		pool->num_pending -= 1;
+	}
+}
+
+PyObject * MGLQueryPool_begin(MGLQueryPool * self, PyObject * args) {
+	int index;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"i",
+		&index
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!MGLQueryPool_Begin(self, index)) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLQueryPool_end(MGLQueryPool * self) {
+	if (self->active < 0) {
+		MGLError_Set("no active query");
+		return 0;
+	}
+
+	MGLQueryPool_End(self);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLQueryPool_timestamp(MGLQueryPool * self, PyObject * args) {
+	int index;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"i",
+		&index
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (self->target != GL_TIMESTAMP) {
+		MGLError_Set("only timestamp queries record the time");
+		return 0;
+	}
+
+	if (index < 0 || index >= self->size) {
+		MGLError_Set("the index %d is out of range", index);
+		return 0;
+	}
+
+	if (!self->pending[index]) {
+		self->pending[index] = 1;
+		self->num_pending += 1;
+	}
+
+	// The time is recorded when the commands before it have completed, without waiting on the CPU.
+
+	const GLMethods & gl = self->context->gl;
+	gl.QueryCounter(self->query_objs[index], GL_TIMESTAMP);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLQueryPool_results(MGLQueryPool * self, PyObject * args) {
+	int first;
+	int count;
+	int wait;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"iip",
+		&first,
+		&count,
+		&wait
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (count < 0) {
+		count = self->size - first;
+	}
+
+	if (first < 0 || count < 0 || first + count > self->size) {
+		MGLError_Set("the queries %d to %d are out of range", first, first + count - 1);
+		return 0;
+	}
+
+	MGLQueryPool_Poll(self, first, count, wait);
+
+	return PyBytes_FromStringAndSize((const char *)(self->results + first), count * sizeof(long long));
+}
+
+PyObject * MGLQueryPool_poll(MGLQueryPool * self, PyObject * args) {
+	int wait;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"p",
+		&wait
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLQueryPool_Poll(self, 0, self->size, wait);
+	return PyLong_FromLong(self->num_pending);
+}
+
+PyObject * MGLQueryPool_ready(MGLQueryPool * self, PyObject * args) {
+	int first;
+	int count;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"ii",
+		&first,
+		&count
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (count < 0) {
+		count = self->size - first;
+	}
+
+	if (first < 0 || count < 0 || first + count > self->size) {
+		MGLError_Set("the queries %d to %d are out of range", first, first + count - 1);
+		return 0;
+	}
+
+	MGLQueryPool_Poll(self, first, count, false);
+
+	for (int i = first; i < first + count; ++i) {
+		if (self->pending[i]) {
+			Py_RETURN_FALSE;
+		}
+	}
+
+	Py_RETURN_TRUE;
+}
+
+PyObject * MGLQueryPool_reset(MGLQueryPool * self) {
+	if (self->active >= 0) {
+		MGLError_Set("the query %d is still active", self->active);
+		return 0;
+	}
+
+	for (int i = 0; i < self->size; ++i) {
+		self->results[i] = -1;
+		self->pending[i] = 0;
+	}
+
+	self->num_pending = 0;
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLQueryPool_begin_render(MGLQueryPool * self, PyObject * args) {
+	int index;
+	int wait;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"ip",
+		&index,
+		&wait
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	switch (self->target) {
+		case GL_SAMPLES_PASSED:
+		case GL_ANY_SAMPLES_PASSED:
+		case GL_ANY_SAMPLES_PASSED_CONSERVATIVE:
+			break;
+
+		default:
+			MGLError_Set("only the sample queries support conditional rendering");
+			return 0;
+	}
+
+	if (index < 0 || index >= self->size || (!self->pending[index] && self->results[index] < 0)) {
+		MGLError_Set("the query %d was never issued", index);
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+	gl.BeginConditionalRender(self->query_objs[index], wait ? GL_QUERY_WAIT : GL_QUERY_NO_WAIT);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLQueryPool_end_render(MGLQueryPool * self) {
+	const GLMethods & gl = self->context->gl;
+	gl.EndConditionalRender();
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLQueryPool_release(MGLQueryPool * self) {
+	MGLQueryPool_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLQueryPool_tp_methods[] = {
+	{"begin", (PyCFunction)MGLQueryPool_begin, METH_VARARGS, 0},
+	{"end", (PyCFunction)MGLQueryPool_end, METH_NOARGS, 0},
+	{"timestamp", (PyCFunction)MGLQueryPool_timestamp, METH_VARARGS, 0},
+	{"results", (PyCFunction)MGLQueryPool_results, METH_VARARGS, 0},
+	{"poll", (PyCFunction)MGLQueryPool_poll, METH_VARARGS, 0},
+	{"ready", (PyCFunction)MGLQueryPool_ready, METH_VARARGS, 0},
+	{"reset", (PyCFunction)MGLQueryPool_reset, METH_NOARGS, 0},
+	{"begin_render", (PyCFunction)MGLQueryPool_begin_render, METH_VARARGS, 0},
+	{"end_render", (PyCFunction)MGLQueryPool_end_render, METH_NOARGS, 0},
+	{"release", (PyCFunction)MGLQueryPool_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLQueryPool_get_pending(MGLQueryPool * self, void * closure) {
+	return PyLong_FromLong(self->num_pending);
+}
+
+PyObject * MGLQueryPool_get_active(MGLQueryPool * self, void * closure) {
+	return PyLong_FromLong(self->active);
+}
+
+PyGetSetDef MGLQueryPool_tp_getseters[] = {
+	{(char *)"pending", (getter)MGLQueryPool_get_pending, 0, 0, 0},
+	{(char *)"active", (getter)MGLQueryPool_get_active, 0, 0, 0},
+	{0},
+};
+
+PyTypeObject MGLQueryPool_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.QueryPool",                                        // tp_name
+	sizeof(MGLQueryPool),                                   // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLQueryPool_tp_dealloc,                    // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLQueryPool_tp_methods,                                // tp_methods
+	0,                                                      // tp_members
+	MGLQueryPool_tp_getseters,                              // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLQueryPool_tp_new,                                    // tp_new
+};
+
+void MGLQueryPool_Invalidate(MGLQueryPool * pool) {
+	if (Py_TYPE(pool) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	// TODO: decref
+
+	const GLMethods & gl = pool->context->gl;
+	gl.DeleteQueries(pool->size, pool->query_objs);
+
+	delete[] pool->query_objs;
+	delete[] pool->results;
+	delete[] pool->pending;
+
+	Py_TYPE(pool) = &MGLInvalidObject_Type;
+	Py_DECREF(pool);
+}
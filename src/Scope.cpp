@@ -8,16 +8,18 @@ PyObject * MGLContext_scope(MGLContext * self, PyObject * args) {
 	PyObject * textures;
 	PyObject * uniform_buffers;
 	PyObject * shader_storage_buffers;
+	PyObject * images;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"O!OOOO",
+		"O!OOOOO",
 		&MGLFramebuffer_Type,
 		&framebuffer,
 		&enable_flags,
 		&textures,
 		&uniform_buffers,
-		&shader_storage_buffers
+		&shader_storage_buffers,
+		&images
 	);
 
 	if (!args_ok) {
@@ -49,11 +51,14 @@ PyObject * MGLContext_scope(MGLContext * self, PyObject * args) {
 	int num_textures = (int)PyTuple_Size(textures);
 	int num_uniform_buffers = (int)PyTuple_Size(uniform_buffers);
 	int num_shader_storage_buffers = (int)PyTuple_Size(shader_storage_buffers);
+	int num_images = (int)PyTuple_Size(images);
 
 	scope->num_textures = num_textures;
 	scope->textures = new int[scope->num_textures * 3];
 	scope->num_buffers = num_uniform_buffers + num_shader_storage_buffers;
 	scope->buffers = new int[scope->num_buffers * 3];
+	scope->num_images = num_images;
+	scope->images = new MGLImageBinding[scope->num_images];
 
 	for (int i = 0; i < num_textures; ++i) {
 		PyObject * tup = PyTuple_GET_ITEM(textures, i);
@@ -70,6 +75,10 @@ PyObject * MGLContext_scope(MGLContext * self, PyObject * args) {
 			MGLTexture3D * texture = (MGLTexture3D *)item;
 			texture_type = GL_TEXTURE_3D;
 			texture_obj = texture->texture_obj;
+		} else if (Py_TYPE(item) == &MGLTextureArray_Type) {
+			MGLTextureArray * texture = (MGLTextureArray *)item;
+			texture_type = GL_TEXTURE_2D_ARRAY;
+			texture_obj = texture->texture_obj;
 		} else if (Py_TYPE(item) == &MGLTextureCube_Type) {
 			MGLTextureCube * texture = (MGLTextureCube *)item;
 			texture_type = GL_TEXTURE_CUBE_MAP;
@@ -117,6 +126,19 @@ PyObject * MGLContext_scope(MGLContext * self, PyObject * args) {
 		}
 	}
 
+	// Images are bound with read and write access to every layer of the base level.
+
+	for (int i = 0; i < num_images; ++i) {
+		PyObject * tup = PyTuple_GET_ITEM(images, i);
+		PyObject * item = PyTuple_GET_ITEM(tup, 0);
+
+		int unit = PyLong_AsLong(PyTuple_GET_ITEM(tup, 1));
+
+		if (!image_binding_from_texture(item, unit, 0, -1, GL_READ_WRITE, 0, &scope->images[i])) {
+			return 0;
+		}
+	}
+
 	return (PyObject *)scope;
 }
 
@@ -126,6 +148,7 @@ PyObject * MGLScope_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwar
 	if (self) {
 		self->textures = 0;
 		self->buffers = 0;
+		self->images = 0;
 	}
 
 	return (PyObject *)self;
@@ -164,6 +187,10 @@ PyObject * MGLScope_begin(MGLScope * self, PyObject * args) {
 		gl.BindBufferBase(self->buffers[i * 3], self->buffers[i * 3 + 1], self->buffers[i * 3 + 2]);
 	}
 
+	for (int i = 0; i < self->num_images; ++i) {
+		bind_image(gl, self->images[i]);
+	}
+
 	if (flags & MGL_BLEND) {
 		gl.Enable(GL_BLEND);
 	} else {
@@ -16,9 +16,14 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	const char * dtype;
 	Py_ssize_t dtype_size;
 
+	int levels;
+	int immutable;
+
+	const char * compression_name;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(II)IOIIs#",
+		"(II)IOIIs#ipz",
 		&width,
 		&height,
 		&components,
@@ -26,13 +31,26 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 		&samples,
 		&alignment,
 		&dtype,
-		&dtype_size
+		&dtype_size,
+		&levels,
+		&immutable,
+		&compression_name
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
+	if (immutable && self->version_code < 420) {
+		MGLError_Set("immutable textures require OpenGL 4.2");
+		return 0;
+	}
+
+	if (immutable && samples && self->version_code < 430) {
+		MGLError_Set("immutable multisample textures require OpenGL 4.3");
+		return 0;
+	}
+
 	if (components < 1 || components > 4) {
 		MGLError_Set("the components must be 1, 2, 3 or 4");
 		return 0;
@@ -53,6 +71,17 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	int max_levels = samples ? 1 : texture_level_count(width, height, 1);
+
+	if (levels == -1) {
+		levels = max_levels;
+	}
+
+	if (levels < 1 || levels > max_levels) {
+		MGLError_Set("the levels must be between 1 and %d", max_levels);
+		return 0;
+	}
+
 	if (dtype_size != 2) {
 		MGLError_Set("invalid dtype");
 		return 0;
@@ -65,10 +94,29 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	MGLCompressedFormat * compression = 0;
+
+	if (compression_name) {
+		if (samples) {
+			MGLError_Set("multisample textures cannot be compressed");
+			return 0;
+		}
+
+		compression = from_compression(self, compression_name, components);
+
+		if (!compression) {
+			return 0;
+		}
+	}
+
 	int expected_size = width * components * data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
+	if (compression) {
+		expected_size = compressed_image_size(compression, width, height);
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -113,11 +161,57 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	gl.BindTexture(texture_target, texture->texture_obj);
 
 	if (samples) {
-		gl.TexImage2DMultisample(texture_target, samples, internal_format, width, height, true);
+		if (immutable) {
+			gl.TexStorage2DMultisample(texture_target, samples, internal_format, width, height, true);
+		} else {
+			gl.TexImage2DMultisample(texture_target, samples, internal_format, width, height, true);
+		}
+	} else if (compression) {
+		int compressed_format = compression->internal_format;
+
+		if (immutable) {
+			gl.TexStorage2D(texture_target, levels, compressed_format, width, height);
+			if (data != Py_None) {
+				gl.CompressedTexSubImage2D(texture_target, 0, 0, 0, width, height, compressed_format, expected_size, buffer_view.buf);
+			}
+		} else {
+			gl.CompressedTexImage2D(texture_target, 0, compressed_format, width, height, 0, expected_size, buffer_view.buf);
+			for (int level = 1; level < levels; ++level) {
+				int level_width = texture_level_size(width, level);
+				int level_height = texture_level_size(height, level);
+				int level_size = compressed_image_size(compression, level_width, level_height);
+				gl.CompressedTexImage2D(texture_target, level, compressed_format, level_width, level_height, 0, level_size, 0);
+			}
+			if (levels > 1) {
+				gl.TexParameteri(texture_target, GL_TEXTURE_MAX_LEVEL, levels - 1);
+			}
+		}
+
+		gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	} else {
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexImage2D(texture_target, 0, internal_format, width, height, 0, base_format, pixel_type, buffer_view.buf);
+
+		// Every level is allocated up front, the driver never has to reallocate the storage later.
+
+		if (immutable) {
+			gl.TexStorage2D(texture_target, levels, internal_format, width, height);
+			if (data != Py_None) {
+				gl.TexSubImage2D(texture_target, 0, 0, 0, width, height, base_format, pixel_type, buffer_view.buf);
+			}
+		} else {
+			gl.TexImage2D(texture_target, 0, internal_format, width, height, 0, base_format, pixel_type, buffer_view.buf);
+			for (int level = 1; level < levels; ++level) {
+				int level_width = texture_level_size(width, level);
+				int level_height = texture_level_size(height, level);
+				gl.TexImage2D(texture_target, level, internal_format, level_width, level_height, 0, base_format, pixel_type, 0);
+			}
+			if (levels > 1) {
+				gl.TexParameteri(texture_target, GL_TEXTURE_MAX_LEVEL, levels - 1);
+			}
+		}
+
 		gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	}
@@ -131,8 +225,11 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	texture->components = components;
 	texture->samples = samples;
 	texture->data_type = data_type;
+	texture->compression = compression;
 
-	texture->max_level = 0;
+	texture->max_level = levels - 1;
+	texture->levels = levels;
+	texture->immutable = immutable;
 	texture->compare_func = 0;
 	texture->anisotropy = 1.0;
 	texture->depth = false;
@@ -255,6 +352,7 @@ PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args) {
 	texture->components = 1;
 	texture->samples = samples;
 	texture->data_type = from_dtype("f4");
+	texture->compression = 0;
 
 	texture->compare_func = GL_LEQUAL;
 	texture->depth = true;
@@ -262,6 +360,8 @@ PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args) {
 	texture->min_filter = GL_LINEAR;
 	texture->mag_filter = GL_LINEAR;
 	texture->max_level = 0;
+	texture->levels = 1;
+	texture->immutable = false;
 
 	texture->repeat_x = false;
 	texture->repeat_y = false;
@@ -434,14 +534,21 @@ PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 
 		Py_buffer buffer_view;
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_WRITABLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDES | PyBUF_WRITABLE);
 		if (get_buffer < 0) {
 			MGLError_Set("the buffer (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
-		if (buffer_view.len < write_offset + expected_size) {
-			MGLError_Set("the buffer is too small");
+		MGLPixelStore store;
+
+		if (!pixel_store_from_view(&buffer_view, width, height, 1, self->components, self->data_type, alignment, &store)) {
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		if (store.strided ? write_offset != 0 : buffer_view.len < write_offset + expected_size) {
+			MGLError_Set(store.strided ? "the write_offset must be zero for strided buffers" : "the buffer is too small");
 			PyBuffer_Release(&buffer_view);
 			return 0;
 		}
@@ -452,9 +559,9 @@ PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 
 		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
 		gl.BindTexture(GL_TEXTURE_2D, self->texture_obj);
-		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
-		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+		set_pixel_store(gl, store);
 		gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, ptr);
+		reset_pixel_store(gl, store);
 
 		PyBuffer_Release(&buffer_view);
 
@@ -497,6 +604,11 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
+	if (self->compression) {
+		MGLError_Set("compressed textures must be written with write_compressed");
+		return 0;
+	}
+
 	int x = 0;
 	int y = 0;
 	int width = self->width / (1 << level);
@@ -563,13 +675,20 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 
 	} else {
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDES);
 		if (get_buffer < 0) {
 			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
-		if (buffer_view.len != expected_size) {
+		MGLPixelStore store;
+
+		if (!pixel_store_from_view(&buffer_view, width, height, 1, self->components, self->data_type, alignment, &store)) {
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		if (!store.strided && buffer_view.len != expected_size) {
 			MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
 			if (data != Py_None) {
 				PyBuffer_Release(&buffer_view);
@@ -581,9 +700,9 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 
 		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
 		gl.BindTexture(texture_target, self->texture_obj);
-		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
-		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+		set_pixel_store(gl, store);
 		gl.TexSubImage2D(texture_target, level, x, y, width, height, format, pixel_type, buffer_view.buf);
+		reset_pixel_store(gl, store);
 
 		PyBuffer_Release(&buffer_view);
 
@@ -592,6 +711,236 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTexture_write_compressed(MGLTexture * self, PyObject * args) {
+	PyObject * data;
+	PyObject * viewport;
+	int level;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OOI",
+		&data,
+		&viewport,
+		&level
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!self->compression) {
+		MGLError_Set("the texture is not compressed");
+		return 0;
+	}
+
+	if (level >= self->levels) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	int level_width = texture_level_size(self->width, level);
+	int level_height = texture_level_size(self->height, level);
+
+	int x = 0;
+	int y = 0;
+	int width = level_width;
+	int height = level_height;
+
+	if (viewport != Py_None) {
+		if (Py_TYPE(viewport) != &PyTuple_Type) {
+			MGLError_Set("the viewport must be a tuple not %s", Py_TYPE(viewport)->tp_name);
+			return 0;
+		}
+
+		if (PyTuple_GET_SIZE(viewport) == 4) {
+
+			x = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+			y = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+			width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 2));
+			height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 3));
+
+		} else if (PyTuple_GET_SIZE(viewport) == 2) {
+
+			width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+			height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+
+		} else {
+
+			MGLError_Set("the viewport size %d is invalid", (int)PyTuple_GET_SIZE(viewport));
+			return 0;
+
+		}
+
+		if (PyErr_Occurred()) {
+			MGLError_Set("wrong values in the viewport");
+			return 0;
+		}
+	}
+
+	if (x < 0 || y < 0 || width < 1 || height < 1 || x + width > level_width || y + height > level_height) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	if (!compressed_region_aligned(self->compression, x, y, width, height, level_width, level_height)) {
+		MGLError_Set("the viewport is not aligned to the %dx%d blocks", self->compression->block_width, self->compression->block_height);
+		return 0;
+	}
+
+	int expected_size = compressed_image_size(self->compression, width, height);
+	int compressed_format = self->compression->internal_format;
+
+	const GLMethods & gl = self->context->gl;
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+
+		MGLBuffer * buffer = (MGLBuffer *)data;
+
+		if (buffer->size < expected_size) {
+			MGLError_Set("data size mismatch %d < %d", (int)buffer->size, expected_size);
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_2D, self->texture_obj);
+		gl.CompressedTexSubImage2D(GL_TEXTURE_2D, level, x, y, width, height, compressed_format, expected_size, 0);
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	} else {
+
+		Py_buffer buffer_view;
+
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		if (get_buffer < 0) {
+			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+			return 0;
+		}
+
+		if (buffer_view.len != expected_size) {
+			MGLError_Set("data size mismatch %d != %d", (int)buffer_view.len, expected_size);
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_2D, self->texture_obj);
+		gl.CompressedTexSubImage2D(GL_TEXTURE_2D, level, x, y, width, height, compressed_format, expected_size, buffer_view.buf);
+
+		PyBuffer_Release(&buffer_view);
+
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTexture_write_levels(MGLTexture * self, PyObject * args) {
+	PyObject * data;
+	int base;
+	int levels;
+	int alignment;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OIiI",
+		&data,
+		&base,
+		&levels,
+		&alignment
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (alignment != 1 && alignment != 2 && alignment != 4 && alignment != 8) {
+		MGLError_Set("the alignment must be 1, 2, 4 or 8");
+		return 0;
+	}
+
+	if (self->samples) {
+		MGLError_Set("multisample textures cannot be written directly");
+		return 0;
+	}
+
+	if (levels == -1) {
+		levels = self->levels - base;
+	}
+
+	if (levels < 1 || base + levels > self->levels) {
+		MGLError_Set("the levels %d to %d are not allocated", base, base + levels - 1);
+		return 0;
+	}
+
+	// The levels are tightly packed one after the other, each row padded to the alignment.
+	// Compressed levels are stored as whole blocks.
+
+	long long expected_size = 0;
+
+	for (int level = base; level < base + levels; ++level) {
+		expected_size += texture_level_bytes(self->width, self->height, level, self->components, self->data_type, alignment, self->compression);
+	}
+
+	int pixel_type = self->data_type->gl_type;
+	int format = self->data_type->base_format[self->components];
+
+	const GLMethods & gl = self->context->gl;
+
+	Py_buffer buffer_view;
+	const char * ptr = 0;
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+		MGLBuffer * buffer = (MGLBuffer *)data;
+
+		if (buffer->size < expected_size) {
+			MGLError_Set("data size mismatch %lld < %lld", (long long)buffer->size, expected_size);
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
+
+	} else {
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		if (get_buffer < 0) {
+			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+			return 0;
+		}
+
+		if (buffer_view.len != expected_size) {
+			MGLError_Set("data size mismatch %lld != %lld", (long long)buffer_view.len, expected_size);
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		ptr = (const char *)buffer_view.buf;
+	}
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_2D, self->texture_obj);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+	for (int level = base; level < base + levels; ++level) {
+		int width = texture_level_size(self->width, level);
+		int height = texture_level_size(self->height, level);
+		long long size = texture_level_bytes(self->width, self->height, level, self->components, self->data_type, alignment, self->compression);
+		if (self->compression) {
+			gl.CompressedTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, self->compression->internal_format, (int)size, ptr);
+		} else {
+			gl.TexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, format, pixel_type, ptr);
+		}
+		ptr += size;
+	}
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	} else {
+		PyBuffer_Release(&buffer_view);
+	}
+
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLTexture_use(MGLTexture * self, PyObject * args) {
 	int index;
 
@@ -614,6 +963,37 @@ PyObject * MGLTexture_use(MGLTexture * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTexture_bind_to_image(MGLTexture * self, PyObject * args) {
+	int unit;
+	int read;
+	int write;
+	int level;
+	const char * format;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"IppIz",
+		&unit,
+		&read,
+		&write,
+		&level,
+		&format
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLImageBinding binding;
+
+	if (!image_binding_from_texture((PyObject *)self, unit, level, -1, image_access(read, write), format, &binding)) {
+		return 0;
+	}
+
+	bind_image(self->context->gl, binding);
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLTexture_build_mipmaps(MGLTexture * self, PyObject * args) {
 	int base = 0;
 	int max = 1000;
@@ -634,6 +1014,20 @@ PyObject * MGLTexture_build_mipmaps(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
+	if (self->compression) {
+		MGLError_Set("cannot build mipmaps for compressed textures");
+		return 0;
+	}
+
+	int max_levels = texture_level_count(self->width, self->height, 1);
+
+	if (self->immutable) {
+		max = max < self->levels - 1 ? max : self->levels - 1;
+	} else {
+		int levels = (max < max_levels - 1 ? max : max_levels - 1) + 1;
+		self->levels = levels > self->levels ? levels : self->levels;
+	}
+
 	int texture_target = self->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
 
 	const GLMethods & gl = self->context->gl;
@@ -656,6 +1050,133 @@ PyObject * MGLTexture_build_mipmaps(MGLTexture * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTexture_view(MGLTexture * self, PyObject * args) {
+	int components;
+	const char * dtype;
+	Py_ssize_t dtype_size;
+	int base_level;
+	int levels;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"Is#ii",
+		&components,
+		&dtype,
+		&dtype_size,
+		&base_level,
+		&levels
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (components < 1 || components > 4) {
+		MGLError_Set("the components must be 1, 2, 3 or 4");
+		return 0;
+	}
+
+	MGLDataType * data_type = dtype_size == 2 ? from_dtype(dtype) : 0;
+
+	if (!data_type) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	if (self->context->version_code < 430) {
+		MGLError_Set("texture views require OpenGL 4.3");
+		return 0;
+	}
+
+	if (!self->immutable) {
+		MGLError_Set("only immutable textures can be viewed");
+		return 0;
+	}
+
+	if (base_level < 0 || base_level >= self->levels) {
+		MGLError_Set("the base level %d is not allocated", base_level);
+		return 0;
+	}
+
+	if (levels == -1) {
+		levels = self->levels - base_level;
+	}
+
+	if (levels < 1 || base_level + levels > self->levels) {
+		MGLError_Set("the levels %d to %d are not allocated", base_level, base_level + levels - 1);
+		return 0;
+	}
+
+	// The view shares the storage, only the interpretation of the texels may change.
+
+	int internal_format = data_type->internal_format[components];
+
+	if (self->compression) {
+		if (components != self->components || data_type != self->data_type) {
+			MGLError_Set("compressed textures can only be viewed with their own format");
+			return 0;
+		}
+		internal_format = self->compression->internal_format;
+	} else if (components * data_type->size != self->components * self->data_type->size) {
+		MGLError_Set("the view format must have the same texel size %d != %d", components * data_type->size, self->components * self->data_type->size);
+		return 0;
+	}
+
+	int texture_target = self->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+
+	const GLMethods & gl = self->context->gl;
+
+	MGLTexture * texture = (MGLTexture *)MGLTexture_Type.tp_alloc(&MGLTexture_Type, 0);
+
+	texture->texture_obj = 0;
+	gl.GenTextures(1, (GLuint *)&texture->texture_obj);
+
+	if (!texture->texture_obj) {
+		MGLError_Set("cannot create texture");
+		Py_DECREF(texture);
+		return 0;
+	}
+
+	gl.TextureView(texture->texture_obj, texture_target, self->texture_obj, internal_format, base_level, levels, 0, 1);
+
+	if (!self->samples) {
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(texture_target, texture->texture_obj);
+		gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	}
+
+	texture->width = texture_level_size(self->width, base_level);
+	texture->height = texture_level_size(self->height, base_level);
+	texture->components = components;
+	texture->samples = self->samples;
+	texture->data_type = data_type;
+	texture->compression = self->compression;
+
+	texture->max_level = levels - 1;
+	texture->levels = levels;
+	texture->immutable = true;
+	texture->compare_func = 0;
+	texture->anisotropy = 1.0;
+	texture->depth = false;
+
+	texture->min_filter = GL_LINEAR;
+	texture->mag_filter = GL_LINEAR;
+
+	texture->repeat_x = true;
+	texture->repeat_y = true;
+
+	Py_INCREF(self->context);
+	texture->context = self->context;
+
+	Py_INCREF(texture);
+
+	PyObject * result = PyTuple_New(2);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)texture);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(texture->texture_obj));
+	return result;
+}
+
 PyObject * MGLTexture_release(MGLTexture * self) {
 	MGLTexture_Invalidate(self);
 	Py_RETURN_NONE;
@@ -664,9 +1185,13 @@ PyObject * MGLTexture_release(MGLTexture * self) {
 PyMethodDef MGLTexture_tp_methods[] = {
 	{"write", (PyCFunction)MGLTexture_write, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLTexture_use, METH_VARARGS, 0},
+	{"bind_to_image", (PyCFunction)MGLTexture_bind_to_image, METH_VARARGS, 0},
+	{"write_compressed", (PyCFunction)MGLTexture_write_compressed, METH_VARARGS, 0},
+	{"write_levels", (PyCFunction)MGLTexture_write_levels, METH_VARARGS, 0},
 	{"build_mipmaps", (PyCFunction)MGLTexture_build_mipmaps, METH_VARARGS, 0},
 	{"read", (PyCFunction)MGLTexture_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLTexture_read_into, METH_VARARGS, 0},
+	{"view", (PyCFunction)MGLTexture_view, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLTexture_release, METH_NOARGS, 0},
 	{0},
 };
@@ -890,6 +1415,22 @@ int MGLTexture_set_anisotropy(MGLTexture * self, PyObject * value) {
 	return 0;
 }
 
+PyObject * MGLTexture_get_levels(MGLTexture * self, void * closure) {
+	return PyLong_FromLong(self->levels);
+}
+
+PyObject * MGLTexture_get_immutable(MGLTexture * self, void * closure) {
+	return PyBool_FromLong(self->immutable);
+}
+
+PyObject * MGLTexture_get_compression(MGLTexture * self, void * closure) {
+	if (!self->compression) {
+		Py_RETURN_NONE;
+	}
+
+	return PyUnicode_FromString(self->compression->name);
+}
+
 PyGetSetDef MGLTexture_tp_getseters[] = {
 	{(char *)"repeat_x", (getter)MGLTexture_get_repeat_x, (setter)MGLTexture_set_repeat_x, 0, 0},
 	{(char *)"repeat_y", (getter)MGLTexture_get_repeat_y, (setter)MGLTexture_set_repeat_y, 0, 0},
@@ -897,6 +1438,9 @@ PyGetSetDef MGLTexture_tp_getseters[] = {
 	{(char *)"swizzle", (getter)MGLTexture_get_swizzle, (setter)MGLTexture_set_swizzle, 0, 0},
 	{(char *)"compare_func", (getter)MGLTexture_get_compare_func, (setter)MGLTexture_set_compare_func, 0, 0},
 	{(char *)"anisotropy", (getter)MGLTexture_get_anisotropy, (setter)MGLTexture_set_anisotropy, 0, 0},
+	{(char *)"levels", (getter)MGLTexture_get_levels, 0, 0, 0},
+	{(char *)"immutable", (getter)MGLTexture_get_immutable, 0, 0, 0},
+	{(char *)"compression", (getter)MGLTexture_get_compression, 0, 0, 0},
 	{0},
 };
 
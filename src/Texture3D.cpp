@@ -16,9 +16,12 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 	const char * dtype;
 	Py_ssize_t dtype_size;
 
+	int levels;
+	int immutable;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(III)IOIs#",
+		"(III)IOIs#ip",
 		&width,
 		&height,
 		&depth,
@@ -26,13 +29,20 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 		&data,
 		&alignment,
 		&dtype,
-		&dtype_size
+		&dtype_size,
+		&levels,
+		&immutable
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
+	if (immutable && self->version_code < 420) {
+		MGLError_Set("immutable textures require OpenGL 4.2");
+		return 0;
+	}
+
 	if (components < 1 || components > 4) {
 		MGLError_Set("the components must be 1, 2, 3 or 4");
 		return 0;
@@ -43,6 +53,17 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	int max_levels = texture_level_count(width, height, depth);
+
+	if (levels == -1) {
+		levels = max_levels;
+	}
+
+	if (levels < 1 || levels > max_levels) {
+		MGLError_Set("the levels must be between 1 and %d", max_levels);
+		return 0;
+	}
+
 	if (dtype_size != 2) {
 		MGLError_Set("invalid dtype");
 		return 0;
@@ -102,7 +123,25 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 
 	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-	gl.TexImage3D(GL_TEXTURE_3D, 0, internal_format, width, height, depth, 0, base_format, pixel_type, buffer_view.buf);
+
+	if (immutable) {
+		gl.TexStorage3D(GL_TEXTURE_3D, levels, internal_format, width, height, depth);
+		if (data != Py_None) {
+			gl.TexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, width, height, depth, base_format, pixel_type, buffer_view.buf);
+		}
+	} else {
+		gl.TexImage3D(GL_TEXTURE_3D, 0, internal_format, width, height, depth, 0, base_format, pixel_type, buffer_view.buf);
+		for (int level = 1; level < levels; ++level) {
+			int level_width = texture_level_size(width, level);
+			int level_height = texture_level_size(height, level);
+			int level_depth = texture_level_size(depth, level);
+			gl.TexImage3D(GL_TEXTURE_3D, level, internal_format, level_width, level_height, level_depth, 0, base_format, pixel_type, 0);
+		}
+		if (levels > 1) {
+			gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+		}
+	}
+
 	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
@@ -118,7 +157,9 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 
 	texture->min_filter = GL_LINEAR;
 	texture->mag_filter = GL_LINEAR;
-	texture->max_level = 0;
+	texture->max_level = levels - 1;
+	texture->levels = levels;
+	texture->immutable = immutable;
 
 	texture->repeat_x = true;
 	texture->repeat_y = true;
@@ -235,14 +276,21 @@ PyObject * MGLTexture3D_read_into(MGLTexture3D * self, PyObject * args) {
 
 		Py_buffer buffer_view;
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_WRITABLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDES | PyBUF_WRITABLE);
 		if (get_buffer < 0) {
 			MGLError_Set("the buffer (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
-		if (buffer_view.len < write_offset + expected_size) {
-			MGLError_Set("the buffer is too small");
+		MGLPixelStore store;
+
+		if (!pixel_store_from_view(&buffer_view, self->width, self->height, self->depth, self->components, self->data_type, alignment, &store)) {
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		if (store.strided ? write_offset != 0 : buffer_view.len < write_offset + expected_size) {
+			MGLError_Set(store.strided ? "the write_offset must be zero for strided buffers" : "the buffer is too small");
 			PyBuffer_Release(&buffer_view);
 			return 0;
 		}
@@ -252,9 +300,9 @@ PyObject * MGLTexture3D_read_into(MGLTexture3D * self, PyObject * args) {
 		const GLMethods & gl = self->context->gl;
 		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
 		gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
-		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
-		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+		set_pixel_store(gl, store);
 		gl.GetTexImage(GL_TEXTURE_3D, 0, format, pixel_type, ptr);
+		reset_pixel_store(gl, store);
 
 		PyBuffer_Release(&buffer_view);
 
@@ -352,13 +400,20 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 
 	} else {
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDES);
 		if (get_buffer < 0) {
 			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
-		if (buffer_view.len != expected_size) {
+		MGLPixelStore store;
+
+		if (!pixel_store_from_view(&buffer_view, width, height, depth, self->components, self->data_type, alignment, &store)) {
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		if (!store.strided && buffer_view.len != expected_size) {
 			MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
 			if (data != Py_None) {
 				PyBuffer_Release(&buffer_view);
@@ -371,9 +426,9 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
 		gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
 
-		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
-		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+		set_pixel_store(gl, store);
 		gl.TexSubImage3D(GL_TEXTURE_3D, 0, x, y, z, width, height, depth, format, pixel_type, buffer_view.buf);
+		reset_pixel_store(gl, store);
 
 		PyBuffer_Release(&buffer_view);
 
@@ -402,6 +457,137 @@ PyObject * MGLTexture3D_use(MGLTexture3D * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTexture3D_bind_to_image(MGLTexture3D * self, PyObject * args) {
+	int unit;
+	int read;
+	int write;
+	int level;
+	int layer;
+	const char * format;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"IppIiz",
+		&unit,
+		&read,
+		&write,
+		&level,
+		&layer,
+		&format
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLImageBinding binding;
+
+	if (!image_binding_from_texture((PyObject *)self, unit, level, layer, image_access(read, write), format, &binding)) {
+		return 0;
+	}
+
+	bind_image(self->context->gl, binding);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTexture3D_write_levels(MGLTexture3D * self, PyObject * args) {
+	PyObject * data;
+	int base;
+	int levels;
+	int alignment;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OIiI",
+		&data,
+		&base,
+		&levels,
+		&alignment
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (alignment != 1 && alignment != 2 && alignment != 4 && alignment != 8) {
+		MGLError_Set("the alignment must be 1, 2, 4 or 8");
+		return 0;
+	}
+
+	if (levels == -1) {
+		levels = self->levels - base;
+	}
+
+	if (levels < 1 || base + levels > self->levels) {
+		MGLError_Set("the levels %d to %d are not allocated", base, base + levels - 1);
+		return 0;
+	}
+
+	int expected_size = 0;
+
+	for (int level = base; level < base + levels; ++level) {
+		int row = texture_level_size(self->width, level) * self->components * self->data_type->size;
+		row = (row + alignment - 1) / alignment * alignment;
+		expected_size += row * texture_level_size(self->height, level) * texture_level_size(self->depth, level);
+	}
+
+	int pixel_type = self->data_type->gl_type;
+	int format = self->data_type->base_format[self->components];
+
+	const GLMethods & gl = self->context->gl;
+
+	Py_buffer buffer_view;
+	const char * ptr = 0;
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+		MGLBuffer * buffer = (MGLBuffer *)data;
+
+		if (buffer->size < expected_size) {
+			MGLError_Set("data size mismatch %d < %d", (int)buffer->size, expected_size);
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
+
+	} else {
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		if (get_buffer < 0) {
+			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+			return 0;
+		}
+
+		if (buffer_view.len != expected_size) {
+			MGLError_Set("data size mismatch %d != %d", (int)buffer_view.len, expected_size);
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		ptr = (const char *)buffer_view.buf;
+	}
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+	for (int level = base; level < base + levels; ++level) {
+		int width = texture_level_size(self->width, level);
+		int height = texture_level_size(self->height, level);
+		int depth = texture_level_size(self->depth, level);
+		int row = (width * self->components * self->data_type->size + alignment - 1) / alignment * alignment;
+		gl.TexSubImage3D(GL_TEXTURE_3D, level, 0, 0, 0, width, height, depth, format, pixel_type, ptr);
+		ptr += row * height * depth;
+	}
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	} else {
+		PyBuffer_Release(&buffer_view);
+	}
+
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLTexture3D_build_mipmaps(MGLTexture3D * self, PyObject * args) {
 	int base = 0;
 	int max = 1000;
@@ -422,6 +608,15 @@ PyObject * MGLTexture3D_build_mipmaps(MGLTexture3D * self, PyObject * args) {
 		return 0;
 	}
 
+	int max_levels = texture_level_count(self->width, self->height, self->depth);
+
+	if (self->immutable) {
+		max = max < self->levels - 1 ? max : self->levels - 1;
+	} else {
+		int levels = (max < max_levels - 1 ? max : max_levels - 1) + 1;
+		self->levels = levels > self->levels ? levels : self->levels;
+	}
+
 	const GLMethods & gl = self->context->gl;
 
 	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
@@ -450,6 +645,8 @@ PyObject * MGLTexture3D_release(MGLTexture3D * self) {
 PyMethodDef MGLTexture3D_tp_methods[] = {
 	{"write", (PyCFunction)MGLTexture3D_write, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLTexture3D_use, METH_VARARGS, 0},
+	{"bind_to_image", (PyCFunction)MGLTexture3D_bind_to_image, METH_VARARGS, 0},
+	{"write_levels", (PyCFunction)MGLTexture3D_write_levels, METH_VARARGS, 0},
 	{"build_mipmaps", (PyCFunction)MGLTexture3D_build_mipmaps, METH_VARARGS, 0},
 	{"read", (PyCFunction)MGLTexture3D_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLTexture3D_read_into, METH_VARARGS, 0},
@@ -630,12 +827,22 @@ int MGLTexture3D_set_swizzle(MGLTexture3D * self, PyObject * value, void * closu
 	return 0;
 }
 
+PyObject * MGLTexture3D_get_levels(MGLTexture3D * self, void * closure) {
+	return PyLong_FromLong(self->levels);
+}
+
+PyObject * MGLTexture3D_get_immutable(MGLTexture3D * self, void * closure) {
+	return PyBool_FromLong(self->immutable);
+}
+
 PyGetSetDef MGLTexture3D_tp_getseters[] = {
 	{(char *)"repeat_x", (getter)MGLTexture3D_get_repeat_x, (setter)MGLTexture3D_set_repeat_x, 0, 0},
 	{(char *)"repeat_y", (getter)MGLTexture3D_get_repeat_y, (setter)MGLTexture3D_set_repeat_y, 0, 0},
 	{(char *)"repeat_z", (getter)MGLTexture3D_get_repeat_z, (setter)MGLTexture3D_set_repeat_z, 0, 0},
 	{(char *)"filter", (getter)MGLTexture3D_get_filter, (setter)MGLTexture3D_set_filter, 0, 0},
 	{(char *)"swizzle", (getter)MGLTexture3D_get_swizzle, (setter)MGLTexture3D_set_swizzle, 0, 0},
+	{(char *)"levels", (getter)MGLTexture3D_get_levels, 0, 0, 0},
+	{(char *)"immutable", (getter)MGLTexture3D_get_immutable, 0, 0, 0},
 	{0},
 };
 
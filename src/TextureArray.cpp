@@ -16,9 +16,14 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 	const char * dtype;
 	Py_ssize_t dtype_size;
 
+	int levels;
+	int immutable;
+
+	const char * compression_name;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(III)IOIs#",
+		"(III)IOIs#ipz",
 		&width,
 		&height,
 		&layers,
@@ -26,13 +31,21 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 		&data,
 		&alignment,
 		&dtype,
-		&dtype_size
+		&dtype_size,
+		&levels,
+		&immutable,
+		&compression_name
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
+	if (immutable && self->version_code < 420) {
+		MGLError_Set("immutable textures require OpenGL 4.2");
+		return 0;
+	}
+
 	if (components < 1 || components > 4) {
 		MGLError_Set("the components must be 1, 2, 3 or 4");
 		return 0;
@@ -43,6 +56,17 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	int max_levels = texture_level_count(width, height, 1);
+
+	if (levels == -1) {
+		levels = max_levels;
+	}
+
+	if (levels < 1 || levels > max_levels) {
+		MGLError_Set("the levels must be between 1 and %d", max_levels);
+		return 0;
+	}
+
 	if (dtype_size != 2) {
 		MGLError_Set("invalid dtype");
 		return 0;
@@ -55,10 +79,24 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	MGLCompressedFormat * compression = 0;
+
+	if (compression_name) {
+		compression = from_compression(self, compression_name, components);
+
+		if (!compression) {
+			return 0;
+		}
+	}
+
 	int expected_size = width * components * data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * layers;
 
+	if (compression) {
+		expected_size = compressed_image_size(compression, width, height) * layers;
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -101,11 +139,48 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 
 	gl.BindTexture(GL_TEXTURE_2D_ARRAY, texture->texture_obj);
 
-    gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
-    gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-    gl.TexImage3D(GL_TEXTURE_2D_ARRAY, 0, internal_format, width, height, layers, 0, base_format, pixel_type, buffer_view.buf);
-    gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+	if (compression) {
+		int compressed_format = compression->internal_format;
+
+		if (immutable) {
+			gl.TexStorage3D(GL_TEXTURE_2D_ARRAY, levels, compressed_format, width, height, layers);
+			if (data != Py_None) {
+				gl.CompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, width, height, layers, compressed_format, expected_size, buffer_view.buf);
+			}
+		} else {
+			gl.CompressedTexImage3D(GL_TEXTURE_2D_ARRAY, 0, compressed_format, width, height, layers, 0, expected_size, buffer_view.buf);
+			for (int level = 1; level < levels; ++level) {
+				int level_width = texture_level_size(width, level);
+				int level_height = texture_level_size(height, level);
+				int level_size = compressed_image_size(compression, level_width, level_height) * layers;
+				gl.CompressedTexImage3D(GL_TEXTURE_2D_ARRAY, level, compressed_format, level_width, level_height, layers, 0, level_size, 0);
+			}
+			if (levels > 1) {
+				gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, levels - 1);
+			}
+		}
+	} else if (immutable) {
+		gl.TexStorage3D(GL_TEXTURE_2D_ARRAY, levels, internal_format, width, height, layers);
+		if (data != Py_None) {
+			gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, width, height, layers, base_format, pixel_type, buffer_view.buf);
+		}
+	} else {
+		gl.TexImage3D(GL_TEXTURE_2D_ARRAY, 0, internal_format, width, height, layers, 0, base_format, pixel_type, buffer_view.buf);
+		for (int level = 1; level < levels; ++level) {
+			int level_width = texture_level_size(width, level);
+			int level_height = texture_level_size(height, level);
+			gl.TexImage3D(GL_TEXTURE_2D_ARRAY, level, internal_format, level_width, level_height, layers, 0, base_format, pixel_type, 0);
+		}
+		if (levels > 1) {
+			gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, levels - 1);
+		}
+	}
+
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
 	if (data != Py_None) {
 		PyBuffer_Release(&buffer_view);
@@ -116,9 +191,13 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 	texture->layers = layers;
 	texture->components = components;
 	texture->data_type = data_type;
+	texture->compression = compression;
 
 	texture->min_filter = GL_LINEAR;
 	texture->mag_filter = GL_LINEAR;
+	texture->max_level = levels - 1;
+	texture->levels = levels;
+	texture->immutable = immutable;
 
 	texture->repeat_x = true;
 	texture->repeat_y = true;
@@ -256,14 +335,21 @@ PyObject * MGLTextureArray_read_into(MGLTextureArray * self, PyObject * args) {
 
 		Py_buffer buffer_view;
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_WRITABLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDES | PyBUF_WRITABLE);
 		if (get_buffer < 0) {
 			MGLError_Set("the buffer (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
-		if (buffer_view.len < write_offset + expected_size) {
-			MGLError_Set("the buffer is too small");
+		MGLPixelStore store;
+
+		if (!pixel_store_from_view(&buffer_view, self->width, self->height, self->layers, self->components, self->data_type, alignment, &store)) {
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		if (store.strided ? write_offset != 0 : buffer_view.len < write_offset + expected_size) {
+			MGLError_Set(store.strided ? "the write_offset must be zero for strided buffers" : "the buffer is too small");
 			PyBuffer_Release(&buffer_view);
 			return 0;
 		}
@@ -274,9 +360,9 @@ PyObject * MGLTextureArray_read_into(MGLTextureArray * self, PyObject * args) {
 
 		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
 		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
-		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
-		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+		set_pixel_store(gl, store);
 		gl.GetTexImage(GL_TEXTURE_2D_ARRAY, 0, format, pixel_type, ptr);
+		reset_pixel_store(gl, store);
 
 		PyBuffer_Release(&buffer_view);
 
@@ -307,6 +393,11 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 		return 0;
 	}
 
+	if (self->compression) {
+		MGLError_Set("compressed textures must be written with write_compressed");
+		return 0;
+	}
+
 	int x = 0;
 	int y = 0;
 	int z = 0;
@@ -374,13 +465,20 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 
 	} else {
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDES);
 		if (get_buffer < 0) {
 			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
-		if (buffer_view.len != expected_size) {
+		MGLPixelStore store;
+
+		if (!pixel_store_from_view(&buffer_view, width, height, layers, self->components, self->data_type, alignment, &store)) {
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		if (!store.strided && buffer_view.len != expected_size) {
 			MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
 			if (data != Py_None) {
 				PyBuffer_Release(&buffer_view);
@@ -392,9 +490,9 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 
 		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
 		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
-		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
-		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+		set_pixel_store(gl, store);
 		gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, x, y, z, width, height, layers, format, pixel_type, buffer_view.buf);
+		reset_pixel_store(gl, store);
 
 		PyBuffer_Release(&buffer_view);
 
@@ -424,6 +522,272 @@ PyObject * MGLTextureArray_use(MGLTextureArray * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTextureArray_bind_to_image(MGLTextureArray * self, PyObject * args) {
+	int unit;
+	int read;
+	int write;
+	int level;
+	int layer;
+	const char * format;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"IppIiz",
+		&unit,
+		&read,
+		&write,
+		&level,
+		&layer,
+		&format
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLImageBinding binding;
+
+	if (!image_binding_from_texture((PyObject *)self, unit, level, layer, image_access(read, write), format, &binding)) {
+		return 0;
+	}
+
+	bind_image(self->context->gl, binding);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureArray_write_compressed(MGLTextureArray * self, PyObject * args) {
+	PyObject * data;
+	PyObject * viewport;
+	int level;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OOI",
+		&data,
+		&viewport,
+		&level
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!self->compression) {
+		MGLError_Set("the texture is not compressed");
+		return 0;
+	}
+
+	if (level >= self->levels) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	int level_width = texture_level_size(self->width, level);
+	int level_height = texture_level_size(self->height, level);
+
+	int x = 0;
+	int y = 0;
+	int z = 0;
+	int width = level_width;
+	int height = level_height;
+	int layers = self->layers;
+
+	if (viewport != Py_None) {
+		if (Py_TYPE(viewport) != &PyTuple_Type) {
+			MGLError_Set("the viewport must be a tuple not %s", Py_TYPE(viewport)->tp_name);
+			return 0;
+		}
+
+		if (PyTuple_GET_SIZE(viewport) == 6) {
+
+			x = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+			y = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+			z = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 2));
+			width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 3));
+			height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 4));
+			layers = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 5));
+
+		} else if (PyTuple_GET_SIZE(viewport) == 3) {
+
+			width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+			height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+			layers = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 2));
+
+		} else {
+
+			MGLError_Set("the viewport size %d is invalid", (int)PyTuple_GET_SIZE(viewport));
+			return 0;
+
+		}
+
+		if (PyErr_Occurred()) {
+			MGLError_Set("wrong values in the viewport");
+			return 0;
+		}
+	}
+
+	if (x < 0 || y < 0 || z < 0 || width < 1 || height < 1 || layers < 1) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	if (x + width > level_width || y + height > level_height || z + layers > self->layers) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	if (!compressed_region_aligned(self->compression, x, y, width, height, level_width, level_height)) {
+		MGLError_Set("the viewport is not aligned to the %dx%d blocks", self->compression->block_width, self->compression->block_height);
+		return 0;
+	}
+
+	int expected_size = compressed_image_size(self->compression, width, height) * layers;
+	int compressed_format = self->compression->internal_format;
+
+	const GLMethods & gl = self->context->gl;
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+
+		MGLBuffer * buffer = (MGLBuffer *)data;
+
+		if (buffer->size < expected_size) {
+			MGLError_Set("data size mismatch %d < %d", (int)buffer->size, expected_size);
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
+		gl.CompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, x, y, z, width, height, layers, compressed_format, expected_size, 0);
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	} else {
+
+		Py_buffer buffer_view;
+
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		if (get_buffer < 0) {
+			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+			return 0;
+		}
+
+		if (buffer_view.len != expected_size) {
+			MGLError_Set("data size mismatch %d != %d", (int)buffer_view.len, expected_size);
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
+		gl.CompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, x, y, z, width, height, layers, compressed_format, expected_size, buffer_view.buf);
+
+		PyBuffer_Release(&buffer_view);
+
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureArray_write_levels(MGLTextureArray * self, PyObject * args) {
+	PyObject * data;
+	int base;
+	int levels;
+	int alignment;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OIiI",
+		&data,
+		&base,
+		&levels,
+		&alignment
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (alignment != 1 && alignment != 2 && alignment != 4 && alignment != 8) {
+		MGLError_Set("the alignment must be 1, 2, 4 or 8");
+		return 0;
+	}
+
+	if (levels == -1) {
+		levels = self->levels - base;
+	}
+
+	if (levels < 1 || base + levels > self->levels) {
+		MGLError_Set("the levels %d to %d are not allocated", base, base + levels - 1);
+		return 0;
+	}
+
+	long long expected_size = 0;
+
+	for (int level = base; level < base + levels; ++level) {
+		expected_size += texture_level_bytes(self->width, self->height, level, self->components, self->data_type, alignment, self->compression) * self->layers;
+	}
+
+	int pixel_type = self->data_type->gl_type;
+	int format = self->data_type->base_format[self->components];
+
+	const GLMethods & gl = self->context->gl;
+
+	Py_buffer buffer_view;
+	const char * ptr = 0;
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+		MGLBuffer * buffer = (MGLBuffer *)data;
+
+		if (buffer->size < expected_size) {
+			MGLError_Set("data size mismatch %lld < %lld", (long long)buffer->size, expected_size);
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
+
+	} else {
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		if (get_buffer < 0) {
+			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+			return 0;
+		}
+
+		if (buffer_view.len != expected_size) {
+			MGLError_Set("data size mismatch %lld != %lld", (long long)buffer_view.len, expected_size);
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		ptr = (const char *)buffer_view.buf;
+	}
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+	for (int level = base; level < base + levels; ++level) {
+		int width = texture_level_size(self->width, level);
+		int height = texture_level_size(self->height, level);
+		int depth = self->layers;
+		long long size = texture_level_bytes(self->width, self->height, level, self->components, self->data_type, alignment, self->compression) * depth;
+		if (self->compression) {
+			gl.CompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, 0, width, height, depth, self->compression->internal_format, (int)size, ptr);
+		} else {
+			gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, 0, width, height, depth, format, pixel_type, ptr);
+		}
+		ptr += size;
+	}
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	} else {
+		PyBuffer_Release(&buffer_view);
+	}
+
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLTextureArray_build_mipmaps(MGLTextureArray * self, PyObject * args) {
 	int base = 0;
 	int max = 1000;
@@ -444,18 +808,32 @@ PyObject * MGLTextureArray_build_mipmaps(MGLTextureArray * self, PyObject * args
 		return 0;
 	}
 
+	if (self->compression) {
+		MGLError_Set("cannot build mipmaps for compressed textures");
+		return 0;
+	}
+
+	int max_levels = texture_level_count(self->width, self->height, 1);
+
+	if (self->immutable) {
+		max = max < self->levels - 1 ? max : self->levels - 1;
+	} else {
+		int levels = (max < max_levels - 1 ? max : max_levels - 1) + 1;
+		self->levels = levels > self->levels ? levels : self->levels;
+	}
+
 	const GLMethods & gl = self->context->gl;
 
 	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
-	gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
+	gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
 
-	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_BASE_LEVEL, base);
-	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAX_LEVEL, max);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BASE_LEVEL, base);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, max);
 
-	gl.GenerateMipmap(GL_TEXTURE_3D);
+	gl.GenerateMipmap(GL_TEXTURE_2D_ARRAY);
 
-	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-	gl.TexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
 	self->min_filter = GL_LINEAR_MIPMAP_LINEAR;
 	self->mag_filter = GL_LINEAR;
@@ -464,6 +842,134 @@ PyObject * MGLTextureArray_build_mipmaps(MGLTextureArray * self, PyObject * args
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTextureArray_view(MGLTextureArray * self, PyObject * args) {
+	int components;
+	const char * dtype;
+	Py_ssize_t dtype_size;
+	int base_level;
+	int levels;
+	int base_layer;
+	int layers;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"Is#IiIi",
+		&components,
+		&dtype,
+		&dtype_size,
+		&base_level,
+		&levels,
+		&base_layer,
+		&layers
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (components < 1 || components > 4) {
+		MGLError_Set("the components must be 1, 2, 3 or 4");
+		return 0;
+	}
+
+	MGLDataType * data_type = dtype_size == 2 ? from_dtype(dtype) : 0;
+
+	if (!data_type) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	if (self->context->version_code < 430) {
+		MGLError_Set("texture views require OpenGL 4.3");
+		return 0;
+	}
+
+	if (!self->immutable) {
+		MGLError_Set("only immutable textures can be viewed");
+		return 0;
+	}
+
+	if (levels == -1) {
+		levels = self->levels - base_level;
+	}
+
+	if (levels < 1 || base_level + levels > self->levels) {
+		MGLError_Set("the levels %d to %d are not allocated", base_level, base_level + levels - 1);
+		return 0;
+	}
+
+	if (layers == -1) {
+		layers = self->layers - base_layer;
+	}
+
+	if (layers < 1 || base_layer + layers > self->layers) {
+		MGLError_Set("the layers %d to %d are not allocated", base_layer, base_layer + layers - 1);
+		return 0;
+	}
+
+	// The view shares the storage, only the interpretation of the texels may change.
+
+	int internal_format = data_type->internal_format[components];
+
+	if (self->compression) {
+		if (components != self->components || data_type != self->data_type) {
+			MGLError_Set("compressed textures can only be viewed with their own format");
+			return 0;
+		}
+		internal_format = self->compression->internal_format;
+	} else if (components * data_type->size != self->components * self->data_type->size) {
+		MGLError_Set("the view format must have the same texel size %d != %d", components * data_type->size, self->components * self->data_type->size);
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	MGLTextureArray * texture = (MGLTextureArray *)MGLTextureArray_Type.tp_alloc(&MGLTextureArray_Type, 0);
+
+	texture->texture_obj = 0;
+	gl.GenTextures(1, (GLuint *)&texture->texture_obj);
+
+	if (!texture->texture_obj) {
+		MGLError_Set("cannot create texture");
+		Py_DECREF(texture);
+		return 0;
+	}
+
+	gl.TextureView(texture->texture_obj, GL_TEXTURE_2D_ARRAY, self->texture_obj, internal_format, base_level, levels, base_layer, layers);
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_2D_ARRAY, texture->texture_obj);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	texture->width = texture_level_size(self->width, base_level);
+	texture->height = texture_level_size(self->height, base_level);
+	texture->layers = layers;
+	texture->components = components;
+	texture->data_type = data_type;
+	texture->compression = self->compression;
+
+	texture->min_filter = GL_LINEAR;
+	texture->mag_filter = GL_LINEAR;
+	texture->max_level = levels - 1;
+	texture->levels = levels;
+	texture->immutable = true;
+
+	texture->repeat_x = true;
+	texture->repeat_y = true;
+	texture->anisotropy = 1.0;
+
+	Py_INCREF(self->context);
+	texture->context = self->context;
+
+	Py_INCREF(texture);
+
+	PyObject * result = PyTuple_New(2);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)texture);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(texture->texture_obj));
+	return result;
+}
+
 PyObject * MGLTextureArray_release(MGLTextureArray * self) {
 	MGLTextureArray_Invalidate(self);
 	Py_RETURN_NONE;
@@ -472,9 +978,13 @@ PyObject * MGLTextureArray_release(MGLTextureArray * self) {
 PyMethodDef MGLTextureArray_tp_methods[] = {
 	{"write", (PyCFunction)MGLTextureArray_write, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLTextureArray_use, METH_VARARGS, 0},
+	{"bind_to_image", (PyCFunction)MGLTextureArray_bind_to_image, METH_VARARGS, 0},
+	{"write_compressed", (PyCFunction)MGLTextureArray_write_compressed, METH_VARARGS, 0},
+	{"write_levels", (PyCFunction)MGLTextureArray_write_levels, METH_VARARGS, 0},
 	{"build_mipmaps", (PyCFunction)MGLTextureArray_build_mipmaps, METH_VARARGS, 0},
 	{"read", (PyCFunction)MGLTextureArray_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLTextureArray_read_into, METH_VARARGS, 0},
+	{"view", (PyCFunction)MGLTextureArray_view, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLTextureArray_release, METH_NOARGS, 0},
 	{0},
 };
@@ -644,12 +1154,31 @@ int MGLTextureArray_set_anisotropy(MGLTextureArray * self, PyObject * value) {
 	return 0;
 }
 
+PyObject * MGLTextureArray_get_levels(MGLTextureArray * self, void * closure) {
+	return PyLong_FromLong(self->levels);
+}
+
+PyObject * MGLTextureArray_get_immutable(MGLTextureArray * self, void * closure) {
+	return PyBool_FromLong(self->immutable);
+}
+
+PyObject * MGLTextureArray_get_compression(MGLTextureArray * self, void * closure) {
+	if (!self->compression) {
+		Py_RETURN_NONE;
+	}
+
+	return PyUnicode_FromString(self->compression->name);
+}
+
 PyGetSetDef MGLTextureArray_tp_getseters[] = {
 	{(char *)"repeat_x", (getter)MGLTextureArray_get_repeat_x, (setter)MGLTextureArray_set_repeat_x, 0, 0},
 	{(char *)"repeat_y", (getter)MGLTextureArray_get_repeat_y, (setter)MGLTextureArray_set_repeat_y, 0, 0},
 	{(char *)"filter", (getter)MGLTextureArray_get_filter, (setter)MGLTextureArray_set_filter, 0, 0},
 	{(char *)"swizzle", (getter)MGLTextureArray_get_swizzle, (setter)MGLTextureArray_set_swizzle, 0, 0},
 	{(char *)"anisotropy", (getter)MGLTextureArray_get_anisotropy, (setter)MGLTextureArray_set_anisotropy, 0, 0},
+	{(char *)"levels", (getter)MGLTextureArray_get_levels, 0, 0, 0},
+	{(char *)"immutable", (getter)MGLTextureArray_get_immutable, 0, 0, 0},
+	{(char *)"compression", (getter)MGLTextureArray_get_compression, 0, 0, 0},
 	{0},
 };
 
@@ -15,22 +15,35 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 	const char * dtype;
 	Py_ssize_t dtype_size;
 
+	int levels;
+	int immutable;
+
+	const char * compression_name;
+
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(II)IOIs#",
+		"(II)IOIs#ipz",
 		&width,
 		&height,
 		&components,
 		&data,
 		&alignment,
 		&dtype,
-		&dtype_size
+		&dtype_size,
+		&levels,
+		&immutable,
+		&compression_name
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
+	if (immutable && self->version_code < 420) {
+		MGLError_Set("immutable textures require OpenGL 4.2");
+		return 0;
+	}
+
 	if (components < 1 || components > 4) {
 		MGLError_Set("the components must be 1, 2, 3 or 4");
 		return 0;
@@ -41,6 +54,17 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	int max_levels = texture_level_count(width, height, 1);
+
+	if (levels == -1) {
+		levels = max_levels;
+	}
+
+	if (levels < 1 || levels > max_levels) {
+		MGLError_Set("the levels must be between 1 and %d", max_levels);
+		return 0;
+	}
+
 	if (dtype_size != 2) {
 		MGLError_Set("invalid dtype");
 		return 0;
@@ -53,10 +77,24 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	MGLCompressedFormat * compression = 0;
+
+	if (compression_name) {
+		compression = from_compression(self, compression_name, components);
+
+		if (!compression) {
+			return 0;
+		}
+	}
+
 	int expected_size = width * components * data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * 6;
 
+	if (compression) {
+		expected_size = compressed_image_size(compression, width, height) * 6;
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -113,12 +151,61 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 
 	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[0]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[1]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[2]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[3]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[4]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[5]);
+
+	if (compression) {
+		int compressed_format = compression->internal_format;
+		int face_size = compressed_image_size(compression, width, height);
+
+		if (immutable) {
+			gl.TexStorage2D(GL_TEXTURE_CUBE_MAP, levels, compressed_format, width, height);
+			if (data != Py_None) {
+				for (int face = 0; face < 6; ++face) {
+					gl.CompressedTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, 0, 0, width, height, compressed_format, face_size, ptr[face]);
+				}
+			}
+		} else {
+			for (int face = 0; face < 6; ++face) {
+				const char * face_data = data != Py_None ? ptr[face] : 0;
+				gl.CompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, compressed_format, width, height, 0, face_size, face_data);
+			}
+			for (int level = 1; level < levels; ++level) {
+				int level_width = texture_level_size(width, level);
+				int level_height = texture_level_size(height, level);
+				int level_size = compressed_image_size(compression, level_width, level_height);
+				for (int face = 0; face < 6; ++face) {
+					gl.CompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, compressed_format, level_width, level_height, 0, level_size, 0);
+				}
+			}
+			if (levels > 1) {
+				gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, levels - 1);
+			}
+		}
+	} else if (immutable) {
+		gl.TexStorage2D(GL_TEXTURE_CUBE_MAP, levels, internal_format, width, height);
+		if (data != Py_None) {
+			for (int face = 0; face < 6; ++face) {
+				gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, 0, 0, width, height, base_format, pixel_type, ptr[face]);
+			}
+		}
+	} else {
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[0]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[1]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[2]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[3]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[4]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[5]);
+		for (int level = 1; level < levels; ++level) {
+			int level_width = texture_level_size(width, level);
+			int level_height = texture_level_size(height, level);
+			for (int face = 0; face < 6; ++face) {
+				gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, internal_format, level_width, level_height, 0, base_format, pixel_type, 0);
+			}
+		}
+		if (levels > 1) {
+			gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, levels - 1);
+		}
+	}
+
 	gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 	gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
@@ -130,10 +217,13 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 	texture->height = height;
 	texture->components = components;
 	texture->data_type = data_type;
+	texture->compression = compression;
 
 	texture->min_filter = GL_LINEAR;
 	texture->mag_filter = GL_LINEAR;
-	texture->max_level = 0;
+	texture->max_level = levels - 1;
+	texture->levels = levels;
+	texture->immutable = immutable;
 	texture->anisotropy = 1.0;
 
 	Py_INCREF(self);
@@ -261,14 +351,21 @@ PyObject * MGLTextureCube_read_into(MGLTextureCube * self, PyObject * args) {
 
 		Py_buffer buffer_view;
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_WRITABLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDES | PyBUF_WRITABLE);
 		if (get_buffer < 0) {
 			MGLError_Set("the buffer (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
-		if (buffer_view.len < write_offset + expected_size) {
-			MGLError_Set("the buffer is too small");
+		MGLPixelStore store;
+
+		if (!pixel_store_from_view(&buffer_view, self->width, self->height, 1, self->components, self->data_type, alignment, &store)) {
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		if (store.strided ? write_offset != 0 : buffer_view.len < write_offset + expected_size) {
+			MGLError_Set(store.strided ? "the write_offset must be zero for strided buffers" : "the buffer is too small");
 			PyBuffer_Release(&buffer_view);
 			return 0;
 		}
@@ -278,9 +375,9 @@ PyObject * MGLTextureCube_read_into(MGLTextureCube * self, PyObject * args) {
 		const GLMethods & gl = self->context->gl;
 		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
 		gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
-		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
-		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+		set_pixel_store(gl, store);
 		gl.GetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, format, pixel_type, ptr);
+		reset_pixel_store(gl, store);
 
 		PyBuffer_Release(&buffer_view);
 
@@ -318,6 +415,11 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 		return 0;
 	}
 
+	if (self->compression) {
+		MGLError_Set("compressed textures must be written with write_compressed");
+		return 0;
+	}
+
 	int x = 0;
 	int y = 0;
 	int width = self->width;
@@ -387,13 +489,20 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 
 	} else {
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDES);
 		if (get_buffer < 0) {
 			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
-		if (buffer_view.len != expected_size) {
+		MGLPixelStore store;
+
+		if (!pixel_store_from_view(&buffer_view, width, height, 1, self->components, self->data_type, alignment, &store)) {
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		if (!store.strided && buffer_view.len != expected_size) {
 			MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
 			PyBuffer_Release(&buffer_view);
 			return 0;
@@ -404,10 +513,243 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
 		gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
 
-		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
-		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+		set_pixel_store(gl, store);
 		gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, x, y, width, height, format, pixel_type, buffer_view.buf);
+		reset_pixel_store(gl, store);
+
+		PyBuffer_Release(&buffer_view);
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureCube_write_compressed(MGLTextureCube * self, PyObject * args) {
+	int face;
+	PyObject * data;
+	PyObject * viewport;
+	int level;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"iOOI",
+		&face,
+		&data,
+		&viewport,
+		&level
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (face < 0 || face > 5) {
+		MGLError_Set("the face must be 0, 1, 2, 3, 4 or 5");
+		return 0;
+	}
+
+	if (!self->compression) {
+		MGLError_Set("the texture is not compressed");
+		return 0;
+	}
+
+	if (level >= self->levels) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	int level_width = texture_level_size(self->width, level);
+	int level_height = texture_level_size(self->height, level);
+
+	int x = 0;
+	int y = 0;
+	int width = level_width;
+	int height = level_height;
+
+	if (viewport != Py_None) {
+		if (Py_TYPE(viewport) != &PyTuple_Type) {
+			MGLError_Set("the viewport must be a tuple not %s", Py_TYPE(viewport)->tp_name);
+			return 0;
+		}
+
+		if (PyTuple_GET_SIZE(viewport) == 4) {
+
+			x = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+			y = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+			width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 2));
+			height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 3));
+
+		} else if (PyTuple_GET_SIZE(viewport) == 2) {
+
+			width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+			height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+
+		} else {
+
+			MGLError_Set("the viewport size %d is invalid", (int)PyTuple_GET_SIZE(viewport));
+			return 0;
+
+		}
+
+		if (PyErr_Occurred()) {
+			MGLError_Set("wrong values in the viewport");
+			return 0;
+		}
+	}
+
+	if (x < 0 || y < 0 || width < 1 || height < 1 || x + width > level_width || y + height > level_height) {
+		MGLError_Set("the viewport is out of range");
+		return 0;
+	}
+
+	if (!compressed_region_aligned(self->compression, x, y, width, height, level_width, level_height)) {
+		MGLError_Set("the viewport is not aligned to the %dx%d blocks", self->compression->block_width, self->compression->block_height);
+		return 0;
+	}
+
+	int expected_size = compressed_image_size(self->compression, width, height);
+	int compressed_format = self->compression->internal_format;
+
+	const GLMethods & gl = self->context->gl;
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+
+		MGLBuffer * buffer = (MGLBuffer *)data;
+
+		if (buffer->size < expected_size) {
+			MGLError_Set("data size mismatch %d < %d", (int)buffer->size, expected_size);
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+		gl.CompressedTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, x, y, width, height, compressed_format, expected_size, 0);
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	} else {
+
+		Py_buffer buffer_view;
+
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		if (get_buffer < 0) {
+			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+			return 0;
+		}
+
+		if (buffer_view.len != expected_size) {
+			MGLError_Set("data size mismatch %d != %d", (int)buffer_view.len, expected_size);
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+		gl.CompressedTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, x, y, width, height, compressed_format, expected_size, buffer_view.buf);
+
+		PyBuffer_Release(&buffer_view);
+
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureCube_write_levels(MGLTextureCube * self, PyObject * args) {
+	PyObject * data;
+	int base;
+	int levels;
+	int alignment;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OIiI",
+		&data,
+		&base,
+		&levels,
+		&alignment
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (alignment != 1 && alignment != 2 && alignment != 4 && alignment != 8) {
+		MGLError_Set("the alignment must be 1, 2, 4 or 8");
+		return 0;
+	}
+
+	if (levels == -1) {
+		levels = self->levels - base;
+	}
+
+	if (levels < 1 || base + levels > self->levels) {
+		MGLError_Set("the levels %d to %d are not allocated", base, base + levels - 1);
+		return 0;
+	}
+
+	// Each level holds the six faces in the order +X, -X, +Y, -Y, +Z, -Z.
+
+	long long expected_size = 0;
+
+	for (int level = base; level < base + levels; ++level) {
+		expected_size += texture_level_bytes(self->width, self->height, level, self->components, self->data_type, alignment, self->compression) * 6;
+	}
 
+	int pixel_type = self->data_type->gl_type;
+	int format = self->data_type->base_format[self->components];
+
+	const GLMethods & gl = self->context->gl;
+
+	Py_buffer buffer_view;
+	const char * ptr = 0;
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+		MGLBuffer * buffer = (MGLBuffer *)data;
+
+		if (buffer->size < expected_size) {
+			MGLError_Set("data size mismatch %lld < %lld", (long long)buffer->size, expected_size);
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
+
+	} else {
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		if (get_buffer < 0) {
+			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+			return 0;
+		}
+
+		if (buffer_view.len != expected_size) {
+			MGLError_Set("data size mismatch %lld != %lld", (long long)buffer_view.len, expected_size);
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		ptr = (const char *)buffer_view.buf;
+	}
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+	for (int level = base; level < base + levels; ++level) {
+		int width = texture_level_size(self->width, level);
+		int height = texture_level_size(self->height, level);
+		long long size = texture_level_bytes(self->width, self->height, level, self->components, self->data_type, alignment, self->compression);
+		for (int face = 0; face < 6; ++face) {
+			if (self->compression) {
+				gl.CompressedTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, 0, 0, width, height, self->compression->internal_format, (int)size, ptr);
+			} else {
+				gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, 0, 0, width, height, format, pixel_type, ptr);
+			}
+			ptr += size;
+		}
+	}
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	} else {
 		PyBuffer_Release(&buffer_view);
 	}
 
@@ -434,6 +776,39 @@ PyObject * MGLTextureCube_use(MGLTextureCube * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTextureCube_bind_to_image(MGLTextureCube * self, PyObject * args) {
+	int unit;
+	int read;
+	int write;
+	int level;
+	int layer;
+	const char * format;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"IppIiz",
+		&unit,
+		&read,
+		&write,
+		&level,
+		&layer,
+		&format
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLImageBinding binding;
+
+	if (!image_binding_from_texture((PyObject *)self, unit, level, layer, image_access(read, write), format, &binding)) {
+		return 0;
+	}
+
+	bind_image(self->context->gl, binding);
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLTextureCube_release(MGLTextureCube * self) {
 	MGLTextureCube_Invalidate(self);
 	Py_RETURN_NONE;
@@ -441,7 +816,10 @@ PyObject * MGLTextureCube_release(MGLTextureCube * self) {
 
 PyMethodDef MGLTextureCube_tp_methods[] = {
 	{"write", (PyCFunction)MGLTextureCube_write, METH_VARARGS, 0},
+	{"write_compressed", (PyCFunction)MGLTextureCube_write_compressed, METH_VARARGS, 0},
+	{"write_levels", (PyCFunction)MGLTextureCube_write_levels, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLTextureCube_use, METH_VARARGS, 0},
+	{"bind_to_image", (PyCFunction)MGLTextureCube_bind_to_image, METH_VARARGS, 0},
 //	{"build_mipmaps", (PyCFunction)MGLTextureCube_build_mipmaps, METH_VARARGS, 0},
 	{"read", (PyCFunction)MGLTextureCube_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLTextureCube_read_into, METH_VARARGS, 0},
@@ -563,10 +941,29 @@ int MGLTextureCube_set_anisotropy(MGLTextureCube * self, PyObject * value) {
 	return 0;
 }
 
+PyObject * MGLTextureCube_get_levels(MGLTextureCube * self, void * closure) {
+	return PyLong_FromLong(self->levels);
+}
+
+PyObject * MGLTextureCube_get_immutable(MGLTextureCube * self, void * closure) {
+	return PyBool_FromLong(self->immutable);
+}
+
+PyObject * MGLTextureCube_get_compression(MGLTextureCube * self, void * closure) {
+	if (!self->compression) {
+		Py_RETURN_NONE;
+	}
+
+	return PyUnicode_FromString(self->compression->name);
+}
+
 PyGetSetDef MGLTextureCube_tp_getseters[] = {
 	{(char *)"filter", (getter)MGLTextureCube_get_filter, (setter)MGLTextureCube_set_filter, 0, 0},
 	{(char *)"swizzle", (getter)MGLTextureCube_get_swizzle, (setter)MGLTextureCube_set_swizzle, 0, 0},
 	{(char *)"anisotropy", (getter)MGLTextureCube_get_anisotropy, (setter)MGLTextureCube_set_anisotropy, 0, 0},
+	{(char *)"levels", (getter)MGLTextureCube_get_levels, 0, 0, 0},
+	{(char *)"immutable", (getter)MGLTextureCube_get_immutable, 0, 0, 0},
+	{(char *)"compression", (getter)MGLTextureCube_get_compression, 0, 0, 0},
 	{0},
 };
 
@@ -0,0 +1,710 @@
+#include "Types.hpp"
+#include "InlineMethods.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Loads KTX2 and DDS containers without decoding them in Python.
+// The file is mapped into memory and every image is uploaded straight from the mapping.
+
+enum TextureFileKind {
+	TEXTURE_FILE_2D,
+	TEXTURE_FILE_ARRAY,
+	TEXTURE_FILE_CUBE,
+	TEXTURE_FILE_3D,
+};
+
+struct TextureFileFormat {
+	unsigned code;
+	int components;
+	const char * dtype;
+	const char * compression;
+};
+
+struct TextureFile {
+	int kind;
+
+	int width;
+	int height;
+	int depth;
+
+	// The number of images in every level: array layers, cube faces or 1.
+	int layers;
+	int levels;
+
+	int components;
+	const char * dtype;
+	const char * compression;
+
+	// KTX2 stores the images of a level together, DDS stores the levels of an image together.
+	bool level_major;
+	unsigned long long level_offset[32];
+	unsigned long long level_length[32];
+	unsigned long long data_offset;
+};
+
+struct MappedFile {
+	const unsigned char * data;
+	unsigned long long size;
+
+#ifdef _WIN32
+	HANDLE file;
+	HANDLE mapping;
+#else
+	int fd;
+#endif
+};
+
+static const TextureFileFormat ktx2_formats[] = {
+	{9, 1, "f1", 0},
+	{16, 2, "f1", 0},
+	{23, 3, "f1", 0},
+	{37, 4, "f1", 0},
+	{76, 1, "f2", 0},
+	{83, 2, "f2", 0},
+	{90, 3, "f2", 0},
+	{97, 4, "f2", 0},
+	{100, 1, "f4", 0},
+	{103, 2, "f4", 0},
+	{106, 3, "f4", 0},
+	{109, 4, "f4", 0},
+	{131, 3, "f1", "bc1"},
+	{133, 4, "f1", "bc1"},
+	{135, 4, "f1", "bc2"},
+	{137, 4, "f1", "bc3"},
+	{139, 1, "f1", "bc4"},
+	{140, 1, "f1", "bc4s"},
+	{141, 2, "f1", "bc5"},
+	{142, 2, "f1", "bc5s"},
+	{143, 3, "f1", "bc6h"},
+	{144, 3, "f1", "bc6hs"},
+	{145, 4, "f1", "bc7"},
+	{146, 4, "f1", "bc7_srgb"},
+	{147, 3, "f1", "etc2"},
+	{148, 3, "f1", "etc2_srgb"},
+	{149, 4, "f1", "etc2_a1"},
+	{151, 4, "f1", "etc2"},
+	{152, 4, "f1", "etc2_srgb"},
+	{153, 1, "f1", "eac_r11"},
+	{154, 1, "f1", "eac_r11s"},
+	{155, 2, "f1", "eac_rg11"},
+	{156, 2, "f1", "eac_rg11s"},
+	{0},
+};
+
+static const TextureFileFormat dxgi_formats[] = {
+	{2, 4, "f4", 0},
+	{6, 3, "f4", 0},
+	{10, 4, "f2", 0},
+	{16, 2, "f4", 0},
+	{28, 4, "f1", 0},
+	{34, 2, "f2", 0},
+	{41, 1, "f4", 0},
+	{49, 2, "f1", 0},
+	{54, 1, "f2", 0},
+	{61, 1, "f1", 0},
+	{71, 4, "f1", "bc1"},
+	{74, 4, "f1", "bc2"},
+	{77, 4, "f1", "bc3"},
+	{80, 1, "f1", "bc4"},
+	{81, 1, "f1", "bc4s"},
+	{83, 2, "f1", "bc5"},
+	{84, 2, "f1", "bc5s"},
+	{95, 3, "f1", "bc6h"},
+	{96, 3, "f1", "bc6hs"},
+	{98, 4, "f1", "bc7"},
+	{99, 4, "f1", "bc7_srgb"},
+	{0},
+};
+
+#define FOURCC(a, b, c, d) ((unsigned)(a) | ((unsigned)(b) << 8) | ((unsigned)(c) << 16) | ((unsigned)(d) << 24))
+
+static const TextureFileFormat fourcc_formats[] = {
+	{FOURCC('D', 'X', 'T', '1'), 4, "f1", "bc1"},
+	{FOURCC('D', 'X', 'T', '3'), 4, "f1", "bc2"},
+	{FOURCC('D', 'X', 'T', '5'), 4, "f1", "bc3"},
+	{FOURCC('A', 'T', 'I', '1'), 1, "f1", "bc4"},
+	{FOURCC('B', 'C', '4', 'U'), 1, "f1", "bc4"},
+	{FOURCC('B', 'C', '4', 'S'), 1, "f1", "bc4s"},
+	{FOURCC('A', 'T', 'I', '2'), 2, "f1", "bc5"},
+	{FOURCC('B', 'C', '5', 'U'), 2, "f1", "bc5"},
+	{FOURCC('B', 'C', '5', 'S'), 2, "f1", "bc5s"},
+	{111, 1, "f2", 0},
+	{112, 2, "f2", 0},
+	{113, 4, "f2", 0},
+	{114, 1, "f4", 0},
+	{115, 2, "f4", 0},
+	{116, 4, "f4", 0},
+	{0},
+};
+
+static const TextureFileFormat * find_format(const TextureFileFormat * formats, unsigned code) {
+	for (int i = 0; formats[i].components; ++i) {
+		if (formats[i].code == code) {
+			return formats + i;
+		}
+	}
+	return 0;
+}
+
+static inline unsigned read_u32(const unsigned char * ptr) {
+	return (unsigned)ptr[0] | ((unsigned)ptr[1] << 8) | ((unsigned)ptr[2] << 16) | ((unsigned)ptr[3] << 24);
+}
+
+// The unsigned header fields that do not fit an int are read as -1 and rejected by the size checks.
+
+static inline int read_int(const unsigned char * ptr) {
+	unsigned value = read_u32(ptr);
+	return value > 0x7fffffff ? -1 : (int)value;
+}
+
+static inline unsigned long long read_u64(const unsigned char * ptr) {
+	return (unsigned long long)read_u32(ptr) | ((unsigned long long)read_u32(ptr + 4) << 32);
+}
+
+static bool map_file(const char * path, MappedFile & file) {
+	file.data = 0;
+	file.size = 0;
+
+#ifdef _WIN32
+	file.file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+	file.mapping = 0;
+
+	if (file.file == INVALID_HANDLE_VALUE) {
+		MGLError_Set("cannot open %s", path);
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	GetFileSizeEx(file.file, &size);
+	file.size = size.QuadPart;
+
+	if (file.size) {
+		file.mapping = CreateFileMappingA(file.file, 0, PAGE_READONLY, 0, 0, 0);
+		file.data = file.mapping ? (const unsigned char *)MapViewOfFile(file.mapping, FILE_MAP_READ, 0, 0, 0) : 0;
+
+		if (!file.data) {
+			MGLError_Set("cannot map %s", path);
+			if (file.mapping) {
+				CloseHandle(file.mapping);
+			}
+			CloseHandle(file.file);
+			return false;
+		}
+	}
+#else
+	file.fd = open(path, O_RDONLY);
+
+	if (file.fd < 0) {
+		MGLError_Set("cannot open %s", path);
+		return false;
+	}
+
+	struct stat info;
+	fstat(file.fd, &info);
+	file.size = info.st_size;
+
+	if (file.size) {
+		void * data = mmap(0, file.size, PROT_READ, MAP_PRIVATE, file.fd, 0);
+
+		if (data == MAP_FAILED) {
+			MGLError_Set("cannot map %s", path);
+			close(file.fd);
+			return false;
+		}
+
+		file.data = (const unsigned char *)data;
+	}
+#endif
+
+	return true;
+}
+
+static void unmap_file(MappedFile & file) {
+#ifdef _WIN32
+	if (file.data) {
+		UnmapViewOfFile(file.data);
+		CloseHandle(file.mapping);
+	}
+	CloseHandle(file.file);
+#else
+	if (file.data) {
+		munmap((void *)file.data, file.size);
+	}
+	close(file.fd);
+#endif
+}
+
+static bool parse_ktx2(const MappedFile & file, TextureFile & info) {
+	const unsigned char * header = file.data;
+
+	if (file.size < 80) {
+		MGLError_Set("the file is truncated");
+		return false;
+	}
+
+	const TextureFileFormat * format = find_format(ktx2_formats, read_u32(header + 12));
+
+	if (!format) {
+		MGLError_Set("unsupported KTX2 format %u", read_u32(header + 12));
+		return false;
+	}
+
+	int width = read_int(header + 20);
+	int height = read_int(header + 24);
+	int depth = read_int(header + 28);
+	int layers = read_int(header + 32);
+	int faces = read_int(header + 36);
+	int levels = read_int(header + 40);
+
+	if (read_u32(header + 44)) {
+		MGLError_Set("supercompressed KTX2 files are not supported");
+		return false;
+	}
+
+	if (faces != 1 && faces != 6) {
+		MGLError_Set("invalid KTX2 face count %d", faces);
+		return false;
+	}
+
+	if (layers && (faces == 6 || depth)) {
+		MGLError_Set("cube map arrays and 3D texture arrays are not supported");
+		return false;
+	}
+
+	if (faces == 6) {
+		info.kind = TEXTURE_FILE_CUBE;
+		info.layers = 6;
+	} else if (depth) {
+		info.kind = TEXTURE_FILE_3D;
+		info.layers = 1;
+	} else if (layers) {
+		info.kind = TEXTURE_FILE_ARRAY;
+		info.layers = layers;
+	} else {
+		info.kind = TEXTURE_FILE_2D;
+		info.layers = 1;
+	}
+
+	// A level count of zero means only the base level is stored, the texture is loaded without mipmaps.
+
+	info.width = width;
+	info.height = height ? height : 1;
+	info.depth = depth ? depth : 1;
+	info.levels = levels ? levels : 1;
+	info.components = format->components;
+	info.dtype = format->dtype;
+	info.compression = format->compression;
+	info.level_major = true;
+
+	if (info.levels < 1 || info.levels > 32) {
+		MGLError_Set("invalid KTX2 level count %d", info.levels);
+		return false;
+	}
+
+	if (file.size < 80 + 24 * (unsigned long long)info.levels) {
+		MGLError_Set("the file is truncated");
+		return false;
+	}
+
+	for (int level = 0; level < info.levels; ++level) {
+		info.level_offset[level] = read_u64(header + 80 + level * 24);
+		info.level_length[level] = read_u64(header + 88 + level * 24);
+	}
+
+	return true;
+}
+
+static bool parse_dds(const MappedFile & file, TextureFile & info) {
+	const unsigned char * header = file.data;
+
+	if (file.size < 128 || read_u32(header + 4) != 124) {
+		MGLError_Set("the file is truncated");
+		return false;
+	}
+
+	int height = read_int(header + 12);
+	int width = read_int(header + 16);
+	int depth = read_int(header + 24);
+	int levels = (read_u32(header + 8) & 0x20000) ? read_int(header + 28) : 1;
+
+	unsigned pixel_flags = read_u32(header + 80);
+	unsigned fourcc = read_u32(header + 84);
+	unsigned caps2 = read_u32(header + 112);
+
+	const TextureFileFormat * format = 0;
+
+	bool cube = (caps2 & 0x200) != 0;
+	bool volume = (caps2 & 0x200000) != 0;
+	int layers = 1;
+
+	info.data_offset = 128;
+
+	if ((pixel_flags & 0x4) && fourcc == FOURCC('D', 'X', '1', '0')) {
+		if (file.size < 148) {
+			MGLError_Set("the file is truncated");
+			return false;
+		}
+
+		format = find_format(dxgi_formats, read_u32(header + 128));
+
+		if (!format) {
+			MGLError_Set("unsupported DXGI format %u", read_u32(header + 128));
+			return false;
+		}
+
+		volume = read_u32(header + 132) == 4;
+		cube = (read_u32(header + 136) & 0x4) != 0;
+		layers = read_int(header + 140);
+		info.data_offset = 148;
+
+		if (layers < 1) {
+			MGLError_Set("invalid DDS array size %d", layers);
+			return false;
+		}
+
+	} else if (pixel_flags & 0x4) {
+		format = find_format(fourcc_formats, fourcc);
+
+		if (!format) {
+			MGLError_Set("unsupported DDS format %.4s", (const char *)(header + 84));
+			return false;
+		}
+
+	} else {
+		// Only the channel orders OpenGL can upload without swizzling are accepted.
+
+		static const TextureFileFormat rgba8 = {0, 4, "f1", 0};
+		static const TextureFileFormat rgb8 = {0, 3, "f1", 0};
+		static const TextureFileFormat rg8 = {0, 2, "f1", 0};
+		static const TextureFileFormat r8 = {0, 1, "f1", 0};
+
+		unsigned bits = read_u32(header + 88);
+		unsigned red_mask = read_u32(header + 92);
+		unsigned green_mask = read_u32(header + 96);
+		unsigned blue_mask = read_u32(header + 100);
+		unsigned alpha_mask = read_u32(header + 104);
+
+		if ((pixel_flags & 0x40) && bits == 32 && red_mask == 0xff && green_mask == 0xff00 && blue_mask == 0xff0000 && alpha_mask == 0xff000000) {
+			format = &rgba8;
+		} else if ((pixel_flags & 0x40) && bits == 24 && red_mask == 0xff && green_mask == 0xff00 && blue_mask == 0xff0000) {
+			format = &rgb8;
+		} else if ((pixel_flags & 0x20000) && bits == 16 && red_mask == 0xff && alpha_mask == 0xff00) {
+			format = &rg8;
+		} else if ((pixel_flags & 0x20000) && bits == 8 && red_mask == 0xff) {
+			format = &r8;
+		} else {
+			MGLError_Set("unsupported DDS pixel format");
+			return false;
+		}
+	}
+
+	if (cube && (layers > 1 || volume)) {
+		MGLError_Set("cube map arrays and 3D texture arrays are not supported");
+		return false;
+	}
+
+	if (cube && (caps2 & 0xfc00) != 0xfc00 && fourcc != FOURCC('D', 'X', '1', '0')) {
+		MGLError_Set("cube maps must have all six faces");
+		return false;
+	}
+
+	if (cube) {
+		info.kind = TEXTURE_FILE_CUBE;
+		info.layers = 6;
+	} else if (volume) {
+		info.kind = TEXTURE_FILE_3D;
+		info.layers = 1;
+	} else if (layers > 1) {
+		info.kind = TEXTURE_FILE_ARRAY;
+		info.layers = layers;
+	} else {
+		info.kind = TEXTURE_FILE_2D;
+		info.layers = 1;
+	}
+
+	info.width = width;
+	info.height = height;
+	info.depth = volume && depth ? depth : 1;
+	info.levels = levels ? levels : 1;
+	info.components = format->components;
+	info.dtype = format->dtype;
+	info.compression = format->compression;
+	info.level_major = false;
+
+	if (info.levels < 1 || info.levels > 32) {
+		MGLError_Set("invalid DDS level count %d", info.levels);
+		return false;
+	}
+
+	return true;
+}
+
+PyObject * MGLContext_texture(MGLContext * self, PyObject * args);
+PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args);
+PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args);
+PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args);
+
+static unsigned long long image_bytes(const TextureFile & info, MGLDataType * data_type, MGLCompressedFormat * compression, int level) {
+	unsigned long long size = texture_level_bytes(info.width, info.height, level, info.components, data_type, 1, compression);
+	return size * texture_level_size(info.depth, level);
+}
+
+PyObject * MGLContext_load_texture(MGLContext * self, PyObject * args) {
+	const char * path;
+	int immutable;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"sp",
+		&path,
+		&immutable
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	static const unsigned char ktx2_identifier[12] = {0xab, 'K', 'T', 'X', ' ', '2', '0', 0xbb, '\r', '\n', 0x1a, '\n'};
+
+	MappedFile file;
+
+	if (!map_file(path, file)) {
+		return 0;
+	}
+
+	TextureFile info = {};
+	bool parsed = false;
+
+	if (file.size >= 12 && !memcmp(file.data, ktx2_identifier, 12)) {
+		parsed = parse_ktx2(file, info);
+	} else if (file.size >= 4 && !memcmp(file.data, "DDS ", 4)) {
+		parsed = parse_dds(file, info);
+	} else {
+		MGLError_Set("%s is not a KTX2 or DDS file", path);
+	}
+
+	if (!parsed) {
+		unmap_file(file);
+		return 0;
+	}
+
+	if (info.width < 1 || info.height < 1 || info.depth < 1 || info.layers < 1) {
+		MGLError_Set("invalid texture size");
+		unmap_file(file);
+		return 0;
+	}
+
+	// The sizes are checked against the limits of the driver before any image size is computed from them.
+
+	const GLMethods & gl = self->gl;
+
+	int max_size = 0;
+	int max_layers = 0;
+
+	switch (info.kind) {
+		case TEXTURE_FILE_3D:
+			gl.GetIntegerv(GL_MAX_3D_TEXTURE_SIZE, &max_size);
+			break;
+
+		case TEXTURE_FILE_CUBE:
+			gl.GetIntegerv(GL_MAX_CUBE_MAP_TEXTURE_SIZE, &max_size);
+			break;
+
+		default:
+			gl.GetIntegerv(GL_MAX_TEXTURE_SIZE, &max_size);
+			break;
+	}
+
+	gl.GetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &max_layers);
+
+	if (info.width > max_size || info.height > max_size || info.depth > max_size) {
+		MGLError_Set("the texture size %dx%dx%d exceeds the limit %d", info.width, info.height, info.depth, max_size);
+		unmap_file(file);
+		return 0;
+	}
+
+	if (info.kind == TEXTURE_FILE_ARRAY && info.layers > max_layers) {
+		MGLError_Set("the %d layers exceed the limit %d", info.layers, max_layers);
+		unmap_file(file);
+		return 0;
+	}
+
+	if (info.kind == TEXTURE_FILE_CUBE && info.width != info.height) {
+		MGLError_Set("the faces of a cube map must be square");
+		unmap_file(file);
+		return 0;
+	}
+
+	if (info.kind == TEXTURE_FILE_3D && info.compression) {
+		MGLError_Set("compressed 3D textures are not supported");
+		unmap_file(file);
+		return 0;
+	}
+
+	MGLDataType * data_type = from_dtype(info.dtype);
+	MGLCompressedFormat * compression = 0;
+
+	if (info.compression) {
+		compression = from_compression(self, info.compression, info.components);
+		if (!compression) {
+			unmap_file(file);
+			return 0;
+		}
+	}
+
+	// Every image is located and checked against the file size before anything is allocated.
+
+	unsigned long long layer_stride = 0;
+
+	for (int level = 0; level < info.levels; ++level) {
+		layer_stride += image_bytes(info, data_type, compression, level);
+	}
+
+	unsigned long long level_start = 0;
+
+	for (int level = 0; level < info.levels; ++level) {
+		unsigned long long size = image_bytes(info, data_type, compression, level);
+		unsigned long long offset = 0;
+		unsigned long long length = 0;
+
+		if (info.level_major) {
+			offset = info.level_offset[level];
+			length = size * info.layers;
+
+			if (info.level_length[level] < length) {
+				MGLError_Set("the level %d is too small", level);
+				unmap_file(file);
+				return 0;
+			}
+		} else {
+			offset = info.data_offset + level_start;
+			length = layer_stride * (info.layers - 1) + size;
+		}
+
+		if (offset > file.size || length > file.size - offset) {
+			MGLError_Set("the file is truncated");
+			unmap_file(file);
+			return 0;
+		}
+
+		level_start += size;
+	}
+
+	PyObject * immutable_arg = immutable ? Py_True : Py_False;
+	PyObject * create_args = 0;
+	PyObject * created = 0;
+
+	switch (info.kind) {
+		case TEXTURE_FILE_2D:
+			create_args = Py_BuildValue("(ii)iOiisiOz", info.width, info.height, info.components, Py_None, 0, 1, info.dtype, info.levels, immutable_arg, info.compression);
+			created = MGLContext_texture(self, create_args);
+			break;
+
+		case TEXTURE_FILE_ARRAY:
+			create_args = Py_BuildValue("(iii)iOisiOz", info.width, info.height, info.layers, info.components, Py_None, 1, info.dtype, info.levels, immutable_arg, info.compression);
+			created = MGLContext_texture_array(self, create_args);
+			break;
+
+		case TEXTURE_FILE_CUBE:
+			create_args = Py_BuildValue("(ii)iOisiOz", info.width, info.height, info.components, Py_None, 1, info.dtype, info.levels, immutable_arg, info.compression);
+			created = MGLContext_texture_cube(self, create_args);
+			break;
+
+		case TEXTURE_FILE_3D:
+			create_args = Py_BuildValue("(iii)iOisiO", info.width, info.height, info.depth, info.components, Py_None, 1, info.dtype, info.levels, immutable_arg);
+			created = MGLContext_texture3d(self, create_args);
+			break;
+	}
+
+	Py_XDECREF(create_args);
+
+	if (!created) {
+		unmap_file(file);
+		return 0;
+	}
+
+	PyObject * texture = PyTuple_GET_ITEM(created, 0);
+	int texture_obj = PyLong_AsLong(PyTuple_GET_ITEM(created, 1));
+
+	static const int targets[] = {GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_3D};
+	static const char * kinds[] = {"texture", "texture_array", "texture_cube", "texture3d"};
+
+	int pixel_type = data_type->gl_type;
+	int format = data_type->base_format[info.components];
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->default_texture_unit);
+	gl.BindTexture(targets[info.kind], texture_obj);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	for (int level = 0; level < info.levels; ++level) {
+		int width = texture_level_size(info.width, level);
+		int height = texture_level_size(info.height, level);
+		int depth = texture_level_size(info.depth, level);
+		unsigned long long size = image_bytes(info, data_type, compression, level);
+
+		level_start = 0;
+
+		for (int previous = 0; previous < level; ++previous) {
+			level_start += image_bytes(info, data_type, compression, previous);
+		}
+
+		for (int layer = 0; layer < info.layers; ++layer) {
+			const unsigned char * ptr = file.data;
+
+			if (info.level_major) {
+				ptr += info.level_offset[level] + layer * size;
+			} else {
+				ptr += info.data_offset + layer * layer_stride + level_start;
+			}
+
+			switch (info.kind) {
+				case TEXTURE_FILE_2D:
+				case TEXTURE_FILE_CUBE: {
+					int target = info.kind == TEXTURE_FILE_CUBE ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + layer : GL_TEXTURE_2D;
+					if (compression) {
+						gl.CompressedTexSubImage2D(target, level, 0, 0, width, height, compression->internal_format, (int)size, ptr);
+					} else {
+						gl.TexSubImage2D(target, level, 0, 0, width, height, format, pixel_type, ptr);
+					}
+					break;
+				}
+
+				case TEXTURE_FILE_ARRAY:
+					if (compression) {
+						gl.CompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, layer, width, height, 1, compression->internal_format, (int)size, ptr);
+					} else {
+						gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, layer, width, height, 1, format, pixel_type, ptr);
+					}
+					break;
+
+				case TEXTURE_FILE_3D:
+					gl.TexSubImage3D(GL_TEXTURE_3D, level, 0, 0, 0, width, height, depth, format, pixel_type, ptr);
+					break;
+			}
+		}
+	}
+
+	unmap_file(file);
+
+	PyObject * size;
+
+	if (info.kind == TEXTURE_FILE_ARRAY) {
+		size = Py_BuildValue("(iii)", info.width, info.height, info.layers);
+	} else if (info.kind == TEXTURE_FILE_3D) {
+		size = Py_BuildValue("(iii)", info.width, info.height, info.depth);
+	} else {
+		size = Py_BuildValue("(ii)", info.width, info.height);
+	}
+
+	PyObject * result = Py_BuildValue("(sOOOis)", kinds[info.kind], texture, PyTuple_GET_ITEM(created, 1), size, info.components, info.dtype);
+	Py_DECREF(size);
+	Py_DECREF(created);
+	return result;
+}
@@ -5,8 +5,16 @@
 #include "GLMethods.hpp"
 #include "Error.hpp"
 
+#include <cstddef>
+
 typedef void (* MGLProc)();
 
+// Objects keep the offset of a method in GLMethods rather than the method itself,
+// the methods of the context are replaced while its calls are instrumented or traced.
+
+#define GL_METHOD_OFFSET(name) ((int)offsetof(GLMethods, name))
+#define GL_METHOD_AT(gl, offset) (*(const MGLProc *)((const char *)&(gl) + (offset)))
+
 enum MGLEnableFlag {
 	MGL_NOTHING = 0,
 	MGL_BLEND = 1,
@@ -34,22 +42,38 @@ static const int SHADER_TYPE[] = {
 };
 
 struct MGLAttribute;
+struct MGLBlockWriter;
 struct MGLBuffer;
 struct MGLComputeShader;
+struct GLStats;
+struct GLTrace;
 struct MGLContext;
 struct MGLFramebuffer;
 struct MGLInvalidObject;
 struct MGLProgram;
+struct MGLProgramPipeline;
 struct MGLRenderbuffer;
 struct MGLTexture;
 struct MGLTexture3D;
 struct MGLTextureArray;
 struct MGLTextureCube;
 struct MGLUniform;
+struct MGLUniformBatch;
 struct MGLUniformBlock;
+struct MGLUniformRing;
+struct MGLQueryPool;
+struct MGLUniformShadow;
 struct MGLVertexArray;
 struct MGLSampler;
 
+struct MGLUniformShadow {
+	MGLUniform ** uniforms;
+	char * data;
+
+	int num_uniforms;
+	bool dirty;
+};
+
 struct MGLDataType {
 	int * base_format;
 	int * internal_format;
@@ -57,10 +81,36 @@ struct MGLDataType {
 	int size;
 };
 
+struct MGLPixelStore {
+	int alignment;
+	int row_length;
+	int image_height;
+	bool strided;
+};
+
+struct MGLImageBinding {
+	int unit;
+	int texture_obj;
+	int level;
+	int layered;
+	int layer;
+	int access;
+	int format;
+};
+
+struct MGLCompressedFormat {
+	const char * name;
+	int internal_format;
+	int components;
+	int block_width;
+	int block_height;
+	int block_size;
+};
+
 struct MGLAttribute {
 	PyObject_HEAD
 
-	void * gl_attrib_ptr_proc;
+	int gl_attrib_ptr_method;
 
 	int program_obj;
 
@@ -80,6 +130,33 @@ struct MGLAttribute {
 	bool normalizable;
 };
 
+struct MGLBlockMember {
+	int type;
+	int offset;
+	int array_length;
+	int array_stride;
+	int matrix_stride;
+
+	int columns;
+	int rows;
+	int scalar_size;
+
+	char shape;
+	bool row_major;
+};
+
+struct MGLBlockWriter {
+	PyObject_HEAD
+
+	MGLBlockMember * members;
+	PyObject * names;
+
+	char * data;
+
+	int num_members;
+	int size;
+};
+
 struct MGLBuffer {
 	PyObject_HEAD
 
@@ -98,6 +175,8 @@ struct MGLComputeShader {
 
 	int program_obj;
 	int shader_obj;
+
+	MGLUniformShadow uniform_shadow;
 };
 
 struct MGLContext {
@@ -118,8 +197,11 @@ struct MGLContext {
 	int default_texture_unit;
 	float max_anisotropy;
 
+	int uniform_buffer_offset_alignment;
+
 	int enable_flags;
 	int front_face;
+	int compute_barrier;
 
 	int depth_func;
 	int blend_func_src;
@@ -127,6 +209,13 @@ struct MGLContext {
 
 	bool wireframe;
 	bool multisample;
+	bool indirect_parameters;
+	bool pipeline_statistics;
+
+	GLStats * gl_stats;
+	GLTrace * gl_trace;
+	bool gl_wrapped;
+	bool null_backend;
 
 	GLMethods gl;
 };
@@ -177,6 +266,20 @@ struct MGLProgram {
 
 	int geometry_vertices;
 	int num_varyings;
+
+	bool separable;
+
+	MGLUniformShadow uniform_shadow;
+};
+
+struct MGLProgramPipeline {
+	PyObject_HEAD
+
+	MGLContext * context;
+
+	MGLProgram * programs[NUM_SHADER_SLOTS];
+
+	int pipeline_obj;
 };
 
 enum MGLQueryKeys {
@@ -184,6 +287,18 @@ enum MGLQueryKeys {
 	ANY_SAMPLES_PASSED,
 	TIME_ELAPSED,
 	PRIMITIVES_GENERATED,
+	VERTICES_SUBMITTED,
+	PRIMITIVES_SUBMITTED,
+	VERTEX_SHADER_INVOCATIONS,
+	TESS_CONTROL_SHADER_PATCHES,
+	TESS_EVALUATION_SHADER_INVOCATIONS,
+	GEOMETRY_SHADER_INVOCATIONS,
+	GEOMETRY_SHADER_PRIMITIVES_EMITTED,
+	FRAGMENT_SHADER_INVOCATIONS,
+	COMPUTE_SHADER_INVOCATIONS,
+	CLIPPING_INPUT_PRIMITIVES,
+	CLIPPING_OUTPUT_PRIMITIVES,
+	NUM_QUERY_KEYS,
 };
 
 struct MGLQuery {
@@ -191,7 +306,23 @@ struct MGLQuery {
 
 	MGLContext * context;
 
-	int query_obj[4];
+	int query_obj[NUM_QUERY_KEYS];
+};
+
+struct MGLQueryPool {
+	PyObject_HEAD
+
+	MGLContext * context;
+
+	unsigned * query_objs;
+	long long * results;
+	char * pending;
+
+	int target;
+	int size;
+
+	int active;
+	int num_pending;
 };
 
 struct MGLRenderbuffer {
@@ -222,9 +353,11 @@ struct MGLScope {
 
 	int * textures;
 	int * buffers;
+	MGLImageBinding * images;
 
 	int num_textures;
 	int num_buffers;
+	int num_images;
 
 	int enable_flags;
 	int old_enable_flags;
@@ -250,6 +383,9 @@ struct MGLTexture {
 	int min_filter;
 	int mag_filter;
 	int max_level;
+	int levels;
+
+	MGLCompressedFormat * compression;
 
 	int compare_func;
 	int anisotropy;
@@ -258,6 +394,7 @@ struct MGLTexture {
 
 	bool repeat_x;
 	bool repeat_y;
+	bool immutable;
 };
 
 struct MGLTexture3D {
@@ -277,10 +414,12 @@ struct MGLTexture3D {
 	int min_filter;
 	int mag_filter;
 	int max_level;
+	int levels;
 
 	bool repeat_x;
 	bool repeat_y;
 	bool repeat_z;
+	bool immutable;
 };
 
 struct MGLTextureArray {
@@ -302,10 +441,14 @@ struct MGLTextureArray {
 	int min_filter;
 	int mag_filter;
 	int max_level;
+	int levels;
+
+	MGLCompressedFormat * compression;
 
 	bool repeat_x;
 	bool repeat_y;
 	float anisotropy;
+	bool immutable;
 };
 
 struct MGLTextureCube {
@@ -325,7 +468,10 @@ struct MGLTextureCube {
 	int min_filter;
 	int mag_filter;
 	int max_level;
+	int levels;
+	MGLCompressedFormat * compression;
 	float anisotropy;
+	bool immutable;
 };
 
 struct MGLUniform {
@@ -333,8 +479,11 @@ struct MGLUniform {
 
 	MGLProc value_getter;
 	MGLProc value_setter;
-	MGLProc gl_value_reader_proc;
-	MGLProc gl_value_writer_proc;
+	int gl_value_reader_method;
+	int gl_value_writer_method;
+
+	MGLUniformShadow * shadow;
+	char * shadow_data;
 
 	int program_obj;
 
@@ -347,6 +496,19 @@ struct MGLUniform {
 	int array_length;
 
 	bool matrix;
+	bool dirty;
+};
+
+struct MGLUniformBatch {
+	PyObject_HEAD
+
+	MGLProgram * program;
+
+	MGLUniform ** uniforms;
+	PyObject * names;
+
+	int num_uniforms;
+	int size;
 };
 
 struct MGLUniformBlock {
@@ -356,16 +518,36 @@ struct MGLUniformBlock {
 
 	int program_obj;
 
+	int interface;
 	int index;
 	int size;
 };
 
+struct MGLUniformRing {
+	PyObject_HEAD
+
+	MGLContext * context;
+
+	char * data;
+
+	int buffer_obj;
+	int binding;
+
+	int block_size;
+	int stride;
+	int count;
+
+	int used;
+	int committed;
+};
+
 struct MGLVertexArray {
 	PyObject_HEAD
 
 	MGLContext * context;
 
 	MGLProgram * program;
+	MGLProgramPipeline * pipeline;
 	MGLBuffer * index_buffer;
 	int index_element_size;
 	int index_element_type;
@@ -400,6 +582,17 @@ struct MGLSampler {
 };
 
 MGLDataType * from_dtype(const char * dtype);
+MGLCompressedFormat * from_compression(MGLContext * context, const char * name, int components);
+int from_image_format(const char * name, int components);
+
+bool pixel_store_from_view(Py_buffer * view, int width, int height, int depth, int components, MGLDataType * data_type, int alignment, MGLPixelStore * store);
+void set_pixel_store(const GLMethods & gl, const MGLPixelStore & store);
+void reset_pixel_store(const GLMethods & gl, const MGLPixelStore & store);
+int pixel_format_size(int format, int type);
+long long pixel_transfer_size(PROC_glGetIntegerv get_integer, bool pack, int width, int height, int depth, int format, int type);
+
+bool image_binding_from_texture(PyObject * texture, int unit, int level, int layer, int access, const char * format, MGLImageBinding * binding);
+void bind_image(const GLMethods & gl, const MGLImageBinding & binding);
 
 void MGLAttribute_Invalidate(MGLAttribute * attribute);
 void MGLBuffer_Invalidate(MGLBuffer * buffer);
@@ -407,37 +600,61 @@ void MGLComputeShader_Invalidate(MGLComputeShader * program);
 void MGLContext_Invalidate(MGLContext * context);
 void MGLFramebuffer_Invalidate(MGLFramebuffer * framebuffer);
 void MGLProgram_Invalidate(MGLProgram * program);
+void MGLProgramPipeline_Invalidate(MGLProgramPipeline * pipeline);
+void MGLQueryPool_Invalidate(MGLQueryPool * pool);
 void MGLRenderbuffer_Invalidate(MGLRenderbuffer * renderbuffer);
 void MGLTexture3D_Invalidate(MGLTexture3D * texture);
 void MGLTextureCube_Invalidate(MGLTextureCube * texture);
 void MGLTexture_Invalidate(MGLTexture * texture);
 void MGLTextureArray_Invalidate(MGLTextureArray * texture);
 void MGLUniform_Invalidate(MGLUniform * uniform);
+void MGLUniformRing_Invalidate(MGLUniformRing * ring);
 void MGLVertexArray_Invalidate(MGLVertexArray * vertex_array);
 void MGLSampler_Invalidate(MGLSampler * sampler);
 
-void MGLAttribute_Complete(MGLAttribute * attribute, const GLMethods & gl);
-void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl);
+void MGLAttribute_Complete(MGLAttribute * attribute);
+void MGLUniform_Complete(MGLUniform * self);
+void MGLUniformShadow_Initialize(MGLUniformShadow * shadow, PyObject * uniforms, const GLMethods & gl);
+void MGLUniformShadow_Release(MGLUniformShadow * shadow);
+void MGLUniformShadow_Flush(MGLUniformShadow * shadow, const GLMethods & gl);
 void MGLUniformBlock_Complete(MGLUniformBlock * uniform_block, const GLMethods & gl);
+int MGLUniformBlock_Members(MGLUniformBlock * uniform_block, MGLBlockMember ** members, PyObject ** names);
+PyObject * MGLUniformBlock_StorageBlocks(const GLMethods & gl, int program_obj);
+bool MGLBlockMember_Complete(MGLBlockMember * member);
+void MGLUniformRing_Commit(MGLUniformRing * ring);
+bool MGLUniformRing_Bind(MGLUniformRing * ring, int slot);
+bool MGLQueryPool_Begin(MGLQueryPool * pool, int index);
+void MGLQueryPool_End(MGLQueryPool * pool);
 void MGLVertexArray_Complete(MGLVertexArray * vertex_array);
 
 void MGLContext_Initialize(MGLContext * self);
+void MGLContext_DisableStats(MGLContext * self);
+void MGLContext_ReleaseStats(MGLContext * self);
+void MGLContext_EndStatsFrame(MGLContext * self);
+void MGLContext_EndTrace(MGLContext * self);
+void MGLContext_TraceFrame(MGLContext * self);
+void LoadNullMethods(GLMethods & gl, PyObject * settings);
 
 extern PyTypeObject MGLAttribute_Type;
+extern PyTypeObject MGLBlockWriter_Type;
 extern PyTypeObject MGLBuffer_Type;
 extern PyTypeObject MGLComputeShader_Type;
 extern PyTypeObject MGLContext_Type;
 extern PyTypeObject MGLFramebuffer_Type;
 extern PyTypeObject MGLInvalidObject_Type;
 extern PyTypeObject MGLProgram_Type;
+extern PyTypeObject MGLProgramPipeline_Type;
 extern PyTypeObject MGLQuery_Type;
+extern PyTypeObject MGLQueryPool_Type;
 extern PyTypeObject MGLRenderbuffer_Type;
 extern PyTypeObject MGLScope_Type;
 extern PyTypeObject MGLTexture3D_Type;
 extern PyTypeObject MGLTextureCube_Type;
 extern PyTypeObject MGLTexture_Type;
 extern PyTypeObject MGLTextureArray_Type;
+extern PyTypeObject MGLUniformBatch_Type;
 extern PyTypeObject MGLUniformBlock_Type;
+extern PyTypeObject MGLUniformRing_Type;
 extern PyTypeObject MGLUniform_Type;
 extern PyTypeObject MGLVertexArray_Type;
 extern PyTypeObject MGLSampler_Type;
@@ -16,21 +16,38 @@ void MGLUniform_tp_dealloc(MGLUniform * self) {
 }
 
 PyObject * MGLUniform_get_value(MGLUniform * self, void * closure) {
+	if (!self->shadow) {
+		MGLError_Set("the program was released");
+		return 0;
+	}
+
 	return ((MGLUniform_Getter)self->value_getter)(self);
 }
 
 int MGLUniform_set_value(MGLUniform * self, PyObject * value, void * closure) {
+	if (!self->shadow) {
+		MGLError_Set("the program was released");
+		return -1;
+	}
+
 	return ((MGLUniform_Setter)self->value_setter)(self, value);
 }
 
 PyObject * MGLUniform_get_data(MGLUniform * self, void * closure) {
-	PyObject * result = PyBytes_FromStringAndSize(0, self->element_size);
-	char * data = PyBytes_AS_STRING(result);
-	((gl_uniform_reader_proc)self->gl_value_reader_proc)(self->program_obj, self->location, data);
-	return result;
+	if (!self->shadow) {
+		MGLError_Set("the program was released");
+		return 0;
+	}
+
+	return PyBytes_FromStringAndSize(self->shadow_data, self->array_length * self->element_size);
 }
 
 int MGLUniform_set_data(MGLUniform * self, PyObject * value, void * closure) {
+	if (!self->shadow) {
+		MGLError_Set("the program was released");
+		return -1;
+	}
+
 	Py_buffer buffer_view;
 
 	int get_buffer = PyObject_GetBuffer(value, &buffer_view, PyBUF_SIMPLE);
@@ -45,11 +62,7 @@ int MGLUniform_set_data(MGLUniform * self, PyObject * value, void * closure) {
 		return -1;
 	}
 
-	if (self->matrix) {
-		((gl_uniform_matrix_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, self->array_length, false, buffer_view.buf);
-	} else {
-		((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, self->array_length, buffer_view.buf);
-	}
+	MGLUniform_write(self, buffer_view.buf);
 
 	PyBuffer_Release(&buffer_view);
 	return 0;
@@ -113,14 +126,14 @@ void MGLUniform_Invalidate(MGLUniform * uniform) {
 	Py_DECREF(uniform);
 }
 
-void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
+void MGLUniform_Complete(MGLUniform * self) {
 	switch (self->type) {
 		case GL_BOOL:
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 4;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform1iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_bool_array_value_getter;
 				self->value_setter = (MGLProc)MGLUniform_bool_array_value_setter;
@@ -134,8 +147,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 2;
 			self->element_size = 8;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform2iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform2iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_bvec_array_value_getter<2>;
 				self->value_setter = (MGLProc)MGLUniform_bvec_array_value_setter<2>;
@@ -149,8 +162,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 3;
 			self->element_size = 12;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform3iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform3iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_bvec_array_value_getter<3>;
 				self->value_setter = (MGLProc)MGLUniform_bvec_array_value_setter<3>;
@@ -164,8 +177,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 4;
 			self->element_size = 16;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform4iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform4iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_bvec_array_value_getter<4>;
 				self->value_setter = (MGLProc)MGLUniform_bvec_array_value_setter<4>;
@@ -179,8 +192,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 4;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform1iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_int_array_value_getter;
 				self->value_setter = (MGLProc)MGLUniform_int_array_value_setter;
@@ -194,8 +207,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 2;
 			self->element_size = 8;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform2iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform2iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_ivec_array_value_getter<2>;
 				self->value_setter = (MGLProc)MGLUniform_ivec_array_value_setter<2>;
@@ -209,8 +222,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 3;
 			self->element_size = 12;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform3iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform3iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_ivec_array_value_getter<3>;
 				self->value_setter = (MGLProc)MGLUniform_ivec_array_value_setter<3>;
@@ -224,8 +237,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 4;
 			self->element_size = 16;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform4iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform4iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_ivec_array_value_getter<4>;
 				self->value_setter = (MGLProc)MGLUniform_ivec_array_value_setter<4>;
@@ -239,8 +252,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 4;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformuiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1uiv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformuiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform1uiv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_uint_array_value_getter;
 				self->value_setter = (MGLProc)MGLUniform_uint_array_value_setter;
@@ -254,8 +267,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 2;
 			self->element_size = 8;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformuiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform2uiv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformuiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform2uiv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_uvec_array_value_getter<2>;
 				self->value_setter = (MGLProc)MGLUniform_uvec_array_value_setter<2>;
@@ -269,8 +282,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 3;
 			self->element_size = 12;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformuiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform3uiv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformuiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform3uiv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_uvec_array_value_getter<3>;
 				self->value_setter = (MGLProc)MGLUniform_uvec_array_value_setter<3>;
@@ -284,8 +297,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 4;
 			self->element_size = 16;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformuiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform4uiv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformuiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform4uiv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_uvec_array_value_getter<4>;
 				self->value_setter = (MGLProc)MGLUniform_uvec_array_value_setter<4>;
@@ -299,8 +312,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 4;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform1fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_float_array_value_getter;
 				self->value_setter = (MGLProc)MGLUniform_float_array_value_setter;
@@ -314,8 +327,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 2;
 			self->element_size = 8;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform2fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform2fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_vec_array_value_getter<2>;
 				self->value_setter = (MGLProc)MGLUniform_vec_array_value_setter<2>;
@@ -329,8 +342,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 3;
 			self->element_size = 12;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform3fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform3fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_vec_array_value_getter<3>;
 				self->value_setter = (MGLProc)MGLUniform_vec_array_value_setter<3>;
@@ -344,8 +357,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 4;
 			self->element_size = 16;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform4fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform4fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_vec_array_value_getter<4>;
 				self->value_setter = (MGLProc)MGLUniform_vec_array_value_setter<4>;
@@ -359,8 +372,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 8;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform1dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_double_array_value_getter;
 				self->value_setter = (MGLProc)MGLUniform_double_array_value_setter;
@@ -374,8 +387,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 2;
 			self->element_size = 16;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform2dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform2dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_dvec_array_value_getter<2>;
 				self->value_setter = (MGLProc)MGLUniform_dvec_array_value_setter<2>;
@@ -389,8 +402,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 3;
 			self->element_size = 24;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform3dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform3dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_dvec_array_value_getter<3>;
 				self->value_setter = (MGLProc)MGLUniform_dvec_array_value_setter<3>;
@@ -404,8 +417,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 4;
 			self->element_size = 32;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform4dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform4dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_dvec_array_value_getter<4>;
 				self->value_setter = (MGLProc)MGLUniform_dvec_array_value_setter<4>;
@@ -419,8 +432,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 4;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform1iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
 				self->value_setter = (MGLProc)MGLUniform_sampler_array_value_setter;
@@ -434,8 +447,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 4;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform1iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
 				self->value_setter = (MGLProc)MGLUniform_sampler_array_value_setter;
@@ -449,8 +462,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 4;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform1iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
 				self->value_setter = (MGLProc)MGLUniform_sampler_array_value_setter;
@@ -464,8 +477,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 4;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform1iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
 				self->value_setter = (MGLProc)MGLUniform_sampler_array_value_setter;
@@ -479,8 +492,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 4;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform1iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
 				self->value_setter = (MGLProc)MGLUniform_sampler_array_value_setter;
@@ -494,8 +507,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 4;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformiv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform1iv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
 				self->value_setter = (MGLProc)MGLUniform_sampler_array_value_setter;
@@ -509,8 +522,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 4;
 			self->element_size = 16;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix2fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix2fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 2, 2>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<float, 2, 2>;
@@ -524,8 +537,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 6;
 			self->element_size = 24;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix2x3fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix2x3fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 2, 3>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<float, 2, 3>;
@@ -539,8 +552,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 8;
 			self->element_size = 32;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix2x4fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix2x4fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 2, 4>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<float, 2, 4>;
@@ -554,8 +567,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 6;
 			self->element_size = 24;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix3x2fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix3x2fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 3, 2>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<float, 3, 2>;
@@ -569,8 +582,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 9;
 			self->element_size = 36;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix3fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix3fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 3, 3>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<float, 3, 3>;
@@ -584,8 +597,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 12;
 			self->element_size = 48;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix3x4fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix3x4fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 3, 4>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<float, 3, 4>;
@@ -599,8 +612,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 8;
 			self->element_size = 32;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix4x2fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix4x2fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 4, 2>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<float, 4, 2>;
@@ -614,8 +627,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 12;
 			self->element_size = 48;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix4x3fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix4x3fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 4, 3>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<float, 4, 3>;
@@ -629,8 +642,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 16;
 			self->element_size = 64;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix4fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix4fv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 4, 4>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<float, 4, 4>;
@@ -644,8 +657,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 4;
 			self->element_size = 32;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix2dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix2dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 2, 2>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<double, 2, 2>;
@@ -659,8 +672,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 6;
 			self->element_size = 48;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix2x3dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix2x3dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 2, 3>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<double, 2, 3>;
@@ -674,8 +687,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 8;
 			self->element_size = 64;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix2x4dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix2x4dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 2, 4>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<double, 2, 4>;
@@ -689,8 +702,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 6;
 			self->element_size = 48;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix3x2dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix3x2dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 3, 2>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<double, 3, 2>;
@@ -704,8 +717,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 9;
 			self->element_size = 72;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix3dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix3dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 3, 3>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<double, 3, 3>;
@@ -719,8 +732,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 12;
 			self->element_size = 96;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix3x4dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix3x4dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 3, 4>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<double, 3, 4>;
@@ -734,8 +747,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 8;
 			self->element_size = 64;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix4x2dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix4x2dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 4, 2>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<double, 4, 2>;
@@ -749,8 +762,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 12;
 			self->element_size = 96;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix4x3dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix4x3dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 4, 3>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<double, 4, 3>;
@@ -764,8 +777,8 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = true;
 			self->dimension = 16;
 			self->element_size = 128;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix4dv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformdv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniformMatrix4dv);
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 4, 4>;
 				self->value_setter = (MGLProc)MGLUniform_matrix_array_value_setter<double, 4, 4>;
@@ -779,10 +792,87 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 4;
-			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
-			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1fv;
+			self->gl_value_reader_method = GL_METHOD_OFFSET(GetUniformfv);
+			self->gl_value_writer_method = GL_METHOD_OFFSET(ProgramUniform1fv);
 			self->value_getter = (MGLProc)MGLUniform_invalid_getter;
 			self->value_setter = (MGLProc)MGLUniform_invalid_setter;
 			break;
 	}
 }
+
+void MGLUniformShadow_Initialize(MGLUniformShadow * shadow, PyObject * uniforms, const GLMethods & gl) {
+	int num_uniforms = (int)PyTuple_GET_SIZE(uniforms);
+	int size = 0;
+
+	for (int i = 0; i < num_uniforms; ++i) {
+		MGLUniform * uniform = (MGLUniform *)PyTuple_GET_ITEM(PyTuple_GET_ITEM(uniforms, i), 0);
+		size += uniform->array_length * uniform->element_size;
+	}
+
+	shadow->uniforms = new MGLUniform * [num_uniforms];
+	shadow->data = new char[size];
+	shadow->num_uniforms = num_uniforms;
+	shadow->dirty = false;
+
+	char * ptr = shadow->data;
+
+	for (int i = 0; i < num_uniforms; ++i) {
+		MGLUniform * uniform = (MGLUniform *)PyTuple_GET_ITEM(PyTuple_GET_ITEM(uniforms, i), 0);
+
+		// The initial values are read back once, right after linking
+
+		for (int j = 0; j < uniform->array_length; ++j) {
+			((gl_uniform_reader_proc)GL_METHOD_AT(gl, uniform->gl_value_reader_method))(uniform->program_obj, uniform->location + j, ptr + j * uniform->element_size);
+		}
+
+		Py_INCREF(uniform);
+		uniform->shadow = shadow;
+		uniform->shadow_data = ptr;
+		uniform->dirty = false;
+
+		shadow->uniforms[i] = uniform;
+		ptr += uniform->array_length * uniform->element_size;
+	}
+}
+
+void MGLUniformShadow_Release(MGLUniformShadow * shadow) {
+	for (int i = 0; i < shadow->num_uniforms; ++i) {
+		MGLUniform * uniform = shadow->uniforms[i];
+		uniform->shadow = 0;
+		uniform->shadow_data = 0;
+		uniform->dirty = false;
+		Py_DECREF(uniform);
+	}
+
+	delete[] shadow->uniforms;
+	delete[] shadow->data;
+
+	shadow->uniforms = 0;
+	shadow->data = 0;
+	shadow->num_uniforms = 0;
+	shadow->dirty = false;
+}
+
+void MGLUniformShadow_Flush(MGLUniformShadow * shadow, const GLMethods & gl) {
+	if (!shadow->dirty) {
+		return;
+	}
+
+	for (int i = 0; i < shadow->num_uniforms; ++i) {
+		MGLUniform * uniform = shadow->uniforms[i];
+
+		if (!uniform->dirty) {
+			continue;
+		}
+
+		if (uniform->matrix) {
+			((gl_uniform_matrix_writer_proc)GL_METHOD_AT(gl, uniform->gl_value_writer_method))(uniform->program_obj, uniform->location, uniform->array_length, false, uniform->shadow_data);
+		} else {
+			((gl_uniform_vector_writer_proc)GL_METHOD_AT(gl, uniform->gl_value_writer_method))(uniform->program_obj, uniform->location, uniform->array_length, uniform->shadow_data);
+		}
+
+		uniform->dirty = false;
+	}
+
+	shadow->dirty = false;
+}
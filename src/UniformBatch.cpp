@@ -0,0 +1,216 @@
+#include "Types.hpp"
+
+#include "UniformGetSetters.hpp"
+
+PyObject * MGLProgram_uniform_batch(MGLProgram * self, PyObject * args) {
+	PyObject * uniforms;
+	PyObject * names;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!O!",
+		&PyTuple_Type,
+		&uniforms,
+		&PyTuple_Type,
+		&names
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	int num_uniforms = (int)PyTuple_GET_SIZE(uniforms);
+
+	if (PyTuple_GET_SIZE(names) != num_uniforms) {
+		MGLError_Set("the number of names is %d not %d", (int)PyTuple_GET_SIZE(names), num_uniforms);
+		return 0;
+	}
+
+	for (int i = 0; i < num_uniforms; ++i) {
+		MGLUniform * uniform = (MGLUniform *)PyTuple_GET_ITEM(uniforms, i);
+
+		if (Py_TYPE(uniform) != &MGLUniform_Type) {
+			MGLError_Set("uniforms[%d] must be a Uniform not %s", i, Py_TYPE(uniform)->tp_name);
+			return 0;
+		}
+
+		if (uniform->shadow != &self->uniform_shadow) {
+			MGLError_Set("uniforms[%d] belongs to a different program", i);
+			return 0;
+		}
+	}
+
+	MGLUniformBatch * batch = (MGLUniformBatch *)MGLUniformBatch_Type.tp_alloc(&MGLUniformBatch_Type, 0);
+
+	// The uniforms point into the shadow block of the program.
+
+	Py_INCREF(self);
+	batch->program = self;
+
+	batch->uniforms = new MGLUniform * [num_uniforms];
+	batch->num_uniforms = num_uniforms;
+	batch->size = 0;
+
+	for (int i = 0; i < num_uniforms; ++i) {
+		MGLUniform * uniform = (MGLUniform *)PyTuple_GET_ITEM(uniforms, i);
+		Py_INCREF(uniform);
+		batch->uniforms[i] = uniform;
+		batch->size += uniform->array_length * uniform->element_size;
+	}
+
+	Py_INCREF(names);
+	batch->names = names;
+
+	PyObject * result = PyTuple_New(2);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)batch);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(batch->size));
+	return result;
+}
+
+PyObject * MGLUniformBatch_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLUniformBatch * self = (MGLUniformBatch *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLUniformBatch_tp_dealloc(MGLUniformBatch * self) {
+	for (int i = 0; i < self->num_uniforms; ++i) {
+		Py_DECREF(self->uniforms[i]);
+	}
+
+	delete[] self->uniforms;
+	Py_XDECREF(self->names);
+	Py_XDECREF(self->program);
+
+	MGLUniformBatch_Type.tp_free((PyObject *)self);
+}
+
+PyObject * MGLUniformBatch_write(MGLUniformBatch * self, PyObject * args) {
+	PyObject * data;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O",
+		&data
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (Py_TYPE(self->program) == &MGLInvalidObject_Type) {
+		MGLError_Set("the program was released");
+		return 0;
+	}
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+	if (get_buffer < 0) {
+		MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+		return 0;
+	}
+
+	if (buffer_view.len != self->size) {
+		MGLError_Set("data size mismatch %d != %d", (int)buffer_view.len, self->size);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	char * ptr = (char *)buffer_view.buf;
+
+	for (int i = 0; i < self->num_uniforms; ++i) {
+		MGLUniform * uniform = self->uniforms[i];
+		MGLUniform_write(uniform, ptr);
+		ptr += uniform->array_length * uniform->element_size;
+	}
+
+	PyBuffer_Release(&buffer_view);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLUniformBatch_update(MGLUniformBatch * self, PyObject * args) {
+	PyObject * values;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!",
+		&PyDict_Type,
+		&values
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (Py_TYPE(self->program) == &MGLInvalidObject_Type) {
+		MGLError_Set("the program was released");
+		return 0;
+	}
+
+	for (int i = 0; i < self->num_uniforms; ++i) {
+		PyObject * value = PyDict_GetItem(values, PyTuple_GET_ITEM(self->names, i));
+
+		if (!value) {
+			continue;
+		}
+
+		MGLUniform * uniform = self->uniforms[i];
+
+		if (((MGLUniform_Setter)uniform->value_setter)(uniform, value) < 0) {
+			return 0;
+		}
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLUniformBatch_tp_methods[] = {
+	{"write", (PyCFunction)MGLUniformBatch_write, METH_VARARGS, 0},
+	{"update", (PyCFunction)MGLUniformBatch_update, METH_VARARGS, 0},
+	{0},
+};
+
+PyTypeObject MGLUniformBatch_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.UniformBatch",                                     // tp_name
+	sizeof(MGLUniformBatch),                                // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLUniformBatch_tp_dealloc,                 // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLUniformBatch_tp_methods,                             // tp_methods
+	0,                                                      // tp_members
+	0,                                                      // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLUniformBatch_tp_new,                                 // tp_new
+};
@@ -1,5 +1,10 @@
 #include "Types.hpp"
 
+#include <string>
+#include <vector>
+
+#include "InlineMethods.hpp"
+
 PyObject * MGLUniformBlock_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
 	MGLUniformBlock * self = (MGLUniformBlock *)type->tp_alloc(type, 0);
 
@@ -14,13 +19,55 @@ void MGLUniformBlock_tp_dealloc(MGLUniformBlock * self) {
 	Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
+PyObject * MGLUniformBlock_members(MGLUniformBlock * self) {
+	MGLBlockMember * members = 0;
+	PyObject * names = 0;
+
+	int num_members = MGLUniformBlock_Members(self, &members, &names);
+
+	PyObject * result = PyTuple_New(num_members);
+
+	for (int i = 0; i < num_members; ++i) {
+		MGLBlockMember & member = members[i];
+
+		PyObject * item = PyTuple_New(9);
+		PyTuple_SET_ITEM(item, 0, PyTuple_GET_ITEM(names, i));
+		PyTuple_SET_ITEM(item, 1, PyLong_FromLong(member.type));
+		PyTuple_SET_ITEM(item, 2, PyLong_FromLong(member.offset));
+		PyTuple_SET_ITEM(item, 3, PyLong_FromLong(member.array_length));
+		PyTuple_SET_ITEM(item, 4, PyLong_FromLong(member.array_stride));
+		PyTuple_SET_ITEM(item, 5, PyLong_FromLong(member.matrix_stride));
+		PyTuple_SET_ITEM(item, 6, PyLong_FromLong(member.columns * member.rows));
+		PyTuple_SET_ITEM(item, 7, PyUnicode_FromFormat("%c", member.shape));
+		PyTuple_SET_ITEM(item, 8, PyBool_FromLong(member.row_major));
+		Py_INCREF(PyTuple_GET_ITEM(names, i));
+
+		PyTuple_SET_ITEM(result, i, item);
+	}
+
+	delete[] members;
+	Py_DECREF(names);
+	return result;
+}
+
+PyObject * MGLUniformBlock_writer(MGLUniformBlock * self, PyObject * args);
+
 PyMethodDef MGLUniformBlock_tp_methods[] = {
+	{"members", (PyCFunction)MGLUniformBlock_members, METH_NOARGS, 0},
+	{"writer", (PyCFunction)MGLUniformBlock_writer, METH_VARARGS, 0},
 	{0},
 };
 
 PyObject * MGLUniformBlock_get_binding(MGLUniformBlock * self, void * closure) {
 	int binding = 0;
-	self->gl->GetActiveUniformBlockiv(self->program_obj, self->index, GL_UNIFORM_BLOCK_BINDING, &binding);
+
+	if (self->interface == GL_SHADER_STORAGE_BLOCK) {
+		const GLenum prop = GL_BUFFER_BINDING;
+		self->gl->GetProgramResourceiv(self->program_obj, GL_SHADER_STORAGE_BLOCK, self->index, 1, &prop, 1, 0, &binding);
+	} else {
+		self->gl->GetActiveUniformBlockiv(self->program_obj, self->index, GL_UNIFORM_BLOCK_BINDING, &binding);
+	}
+
 	return PyLong_FromLong(binding);
 }
 
@@ -32,7 +79,12 @@ int MGLUniformBlock_set_binding(MGLUniformBlock * self, PyObject * value, void *
 		return -1;
 	}
 
-	self->gl->UniformBlockBinding(self->program_obj, self->index, binding);
+	if (self->interface == GL_SHADER_STORAGE_BLOCK) {
+		self->gl->ShaderStorageBlockBinding(self->program_obj, self->index, binding);
+	} else {
+		self->gl->UniformBlockBinding(self->program_obj, self->index, binding);
+	}
+
 	return 0;
 }
 
@@ -84,3 +136,150 @@ PyTypeObject MGLUniformBlock_Type = {
 
 void MGLUniformBlock_Complete(MGLUniformBlock * uniform_block, const GLMethods & gl) {
 }
+
+// Members are reflected with glGetActiveUniformsiv for uniform blocks
+// and with the program interface query for shader storage blocks.
+// The offsets and strides are the ones chosen by the driver for the std140, std430 or shared layout.
+
+int MGLUniformBlock_Members(MGLUniformBlock * uniform_block, MGLBlockMember ** members, PyObject ** names) {
+	const GLMethods & gl = *uniform_block->gl;
+
+	int program_obj = uniform_block->program_obj;
+	int num_variables = 0;
+
+	if (uniform_block->interface == GL_SHADER_STORAGE_BLOCK) {
+		const GLenum prop = GL_NUM_ACTIVE_VARIABLES;
+		gl.GetProgramResourceiv(program_obj, GL_SHADER_STORAGE_BLOCK, uniform_block->index, 1, &prop, 1, 0, &num_variables);
+	} else {
+		gl.GetActiveUniformBlockiv(program_obj, uniform_block->index, GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &num_variables);
+	}
+
+	int * indices = new int[num_variables];
+
+	if (uniform_block->interface == GL_SHADER_STORAGE_BLOCK) {
+		const GLenum prop = GL_ACTIVE_VARIABLES;
+		gl.GetProgramResourceiv(program_obj, GL_SHADER_STORAGE_BLOCK, uniform_block->index, 1, &prop, num_variables, 0, indices);
+	} else {
+		gl.GetActiveUniformBlockiv(program_obj, uniform_block->index, GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES, indices);
+	}
+
+	// A buffer variable of an array of structs is reported for the first element of the top-level array only,
+	// it is expanded to every element with the top-level array size and stride.
+	// Runtime sized arrays report a size of zero and keep their first element.
+
+	std::vector<MGLBlockMember> variables(num_variables);
+	std::vector<std::string> variable_names(num_variables);
+	std::vector<int> top_level_sizes(num_variables, 1);
+	std::vector<int> top_level_strides(num_variables, 0);
+	int num_members = 0;
+
+	for (int i = 0; i < num_variables; ++i) {
+		MGLBlockMember & member = variables[i];
+		GLuint index = indices[i];
+
+		int values[8] = {};
+		int name_len = 0;
+		char name[256];
+
+		if (uniform_block->interface == GL_SHADER_STORAGE_BLOCK) {
+			const GLenum props[8] = {GL_TYPE, GL_ARRAY_SIZE, GL_OFFSET, GL_ARRAY_STRIDE, GL_MATRIX_STRIDE, GL_IS_ROW_MAJOR, GL_TOP_LEVEL_ARRAY_SIZE, GL_TOP_LEVEL_ARRAY_STRIDE};
+			gl.GetProgramResourceiv(program_obj, GL_BUFFER_VARIABLE, index, 8, props, 8, 0, values);
+			gl.GetProgramResourceName(program_obj, GL_BUFFER_VARIABLE, index, 256, &name_len, name);
+		} else {
+			const GLenum pnames[6] = {GL_UNIFORM_TYPE, GL_UNIFORM_SIZE, GL_UNIFORM_OFFSET, GL_UNIFORM_ARRAY_STRIDE, GL_UNIFORM_MATRIX_STRIDE, GL_UNIFORM_IS_ROW_MAJOR};
+			for (int j = 0; j < 6; ++j) {
+				gl.GetActiveUniformsiv(program_obj, 1, &index, pnames[j], &values[j]);
+			}
+			gl.GetActiveUniformName(program_obj, index, 256, &name_len, name);
+		}
+
+		clean_glsl_name(name, name_len);
+
+		member.type = values[0];
+		member.array_length = values[1];
+		member.offset = values[2];
+		member.array_stride = values[3];
+		member.matrix_stride = values[4];
+		member.row_major = values[5] ? true : false;
+
+		MGLBlockMember_Complete(&member);
+
+		variable_names[i].assign(name, name_len);
+
+		// The top-level array of a plain array member is the member itself.
+
+		size_t bracket = variable_names[i].find("[0].");
+
+		if (uniform_block->interface == GL_SHADER_STORAGE_BLOCK && values[6] > 1 && bracket != std::string::npos && variable_names[i].find('[') == bracket) {
+			top_level_sizes[i] = values[6];
+			top_level_strides[i] = values[7];
+		}
+
+		num_members += top_level_sizes[i];
+	}
+
+	*members = new MGLBlockMember[num_members];
+	*names = PyTuple_New(num_members);
+
+	int member_index = 0;
+
+	for (int i = 0; i < num_variables; ++i) {
+		const std::string & name = variable_names[i];
+		size_t bracket = name.find('[');
+
+		for (int j = 0; j < top_level_sizes[i]; ++j) {
+			MGLBlockMember & member = (*members)[member_index];
+			member = variables[i];
+			member.offset += j * top_level_strides[i];
+
+			std::string element_name = name;
+
+			if (j) {
+				element_name = name.substr(0, bracket) + "[" + std::to_string(j) + name.substr(bracket + 2);
+			}
+
+			PyTuple_SET_ITEM(*names, member_index, PyUnicode_FromStringAndSize(element_name.c_str(), element_name.size()));
+			member_index += 1;
+		}
+	}
+
+	delete[] indices;
+	return num_members;
+}
+
+PyObject * MGLUniformBlock_StorageBlocks(const GLMethods & gl, int program_obj) {
+	int num_storage_blocks = 0;
+	gl.GetProgramInterfaceiv(program_obj, GL_SHADER_STORAGE_BLOCK, GL_ACTIVE_RESOURCES, &num_storage_blocks);
+
+	PyObject * storage_blocks_lst = PyTuple_New(num_storage_blocks);
+
+	for (int i = 0; i < num_storage_blocks; ++i) {
+		int size = 0;
+		int name_len = 0;
+		char name[256];
+
+		const GLenum prop = GL_BUFFER_DATA_SIZE;
+		gl.GetProgramResourceName(program_obj, GL_SHADER_STORAGE_BLOCK, i, 256, &name_len, name);
+		gl.GetProgramResourceiv(program_obj, GL_SHADER_STORAGE_BLOCK, i, 1, &prop, 1, 0, &size);
+
+		clean_glsl_name(name, name_len);
+
+		MGLUniformBlock * mglo = (MGLUniformBlock *)MGLUniformBlock_Type.tp_alloc(&MGLUniformBlock_Type, 0);
+
+		mglo->interface = GL_SHADER_STORAGE_BLOCK;
+		mglo->index = i;
+		mglo->size = size;
+		mglo->program_obj = program_obj;
+		mglo->gl = &gl;
+
+		PyObject * item = PyTuple_New(4);
+		PyTuple_SET_ITEM(item, 0, (PyObject *)mglo);
+		PyTuple_SET_ITEM(item, 1, PyLong_FromLong(i));
+		PyTuple_SET_ITEM(item, 2, PyLong_FromLong(size));
+		PyTuple_SET_ITEM(item, 3, PyUnicode_FromStringAndSize(name, name_len));
+
+		PyTuple_SET_ITEM(storage_blocks_lst, i, item);
+	}
+
+	return storage_blocks_lst;
+}
@@ -10,6 +10,25 @@ typedef void (GLAPI * gl_uniform_matrix_writer_proc)(GLuint program, GLint locat
 typedef PyObject * (* MGLUniform_Getter)(MGLUniform * self);
 typedef int (* MGLUniform_Setter)(MGLUniform * self, PyObject * value);
 
+// The values are kept in the shadow block of the program.
+// Writes are compared against the shadow and only the changed uniforms are flushed before the next draw.
+
+inline void MGLUniform_read(MGLUniform * self, int index, void * value) {
+	memcpy(value, self->shadow_data + index * self->element_size, self->element_size);
+}
+
+inline void MGLUniform_write(MGLUniform * self, const void * values) {
+	int size = self->array_length * self->element_size;
+
+	if (!memcmp(self->shadow_data, values, size)) {
+		return;
+	}
+
+	memcpy(self->shadow_data, values, size);
+	self->shadow->dirty = true;
+	self->dirty = true;
+}
+
 PyObject * MGLUniform_invalid_getter(MGLUniform * self);
 
 PyObject * MGLUniform_bool_value_getter(MGLUniform * self);
@@ -0,0 +1,297 @@
+#include "Types.hpp"
+
+PyObject * MGLContext_uniform_ring(MGLContext * self, PyObject * args) {
+	int block_size;
+	int count;
+	int binding;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"III",
+		&block_size,
+		&count,
+		&binding
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!block_size || !count) {
+		MGLError_Set("the block_size and count must be greater than zero");
+		return 0;
+	}
+
+	const GLMethods & gl = self->gl;
+
+	// Every slot starts at a multiple of GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT,
+	// so the slots can be bound with glBindBufferRange without further checks.
+
+	int alignment = self->uniform_buffer_offset_alignment > 0 ? self->uniform_buffer_offset_alignment : 256;
+
+	MGLUniformRing * ring = (MGLUniformRing *)MGLUniformRing_Type.tp_alloc(&MGLUniformRing_Type, 0);
+
+	ring->block_size = block_size;
+	ring->stride = (block_size + alignment - 1) / alignment * alignment;
+	ring->count = count;
+	ring->binding = binding;
+	ring->used = 0;
+	ring->committed = 0;
+	ring->data = new char[ring->stride * count]();
+
+	ring->buffer_obj = 0;
+	gl.GenBuffers(1, (GLuint *)&ring->buffer_obj);
+
+	if (!ring->buffer_obj) {
+		MGLError_Set("cannot create buffer");
+		Py_DECREF(ring);
+		return 0;
+	}
+
+	gl.BindBuffer(GL_UNIFORM_BUFFER, ring->buffer_obj);
+	gl.BufferData(GL_UNIFORM_BUFFER, ring->stride * count, 0, GL_STREAM_DRAW);
+
+	Py_INCREF(self);
+	ring->context = self;
+
+	Py_INCREF(ring);
+
+	PyObject * result = PyTuple_New(3);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)ring);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(ring->stride));
+	PyTuple_SET_ITEM(result, 2, PyLong_FromLong(ring->buffer_obj));
+	return result;
+}
+
+PyObject * MGLUniformRing_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLUniformRing * self = (MGLUniformRing *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLUniformRing_tp_dealloc(MGLUniformRing * self) {
+	delete[] self->data;
+	MGLUniformRing_Type.tp_free((PyObject *)self);
+}
+
+void MGLUniformRing_Commit(MGLUniformRing * ring) {
+	if (ring->committed == ring->used) {
+		return;
+	}
+
+	const GLMethods & gl = ring->context->gl;
+
+	// Only the slots pushed since the last commit are uploaded, in a single copy.
+
+	int offset = ring->committed * ring->stride;
+	int size = (ring->used - ring->committed) * ring->stride;
+
+	gl.BindBuffer(GL_UNIFORM_BUFFER, ring->buffer_obj);
+	gl.BufferSubData(GL_UNIFORM_BUFFER, (GLintptr)offset, size, ring->data + offset);
+
+	ring->committed = ring->used;
+}
+
+bool MGLUniformRing_Bind(MGLUniformRing * ring, int slot) {
+	if (slot < 0 || slot >= ring->used) {
+		MGLError_Set("the slot %d is not in use", slot);
+		return false;
+	}
+
+	MGLUniformRing_Commit(ring);
+
+	const GLMethods & gl = ring->context->gl;
+	gl.BindBufferRange(GL_UNIFORM_BUFFER, ring->binding, ring->buffer_obj, (GLintptr)slot * ring->stride, ring->block_size);
+	return true;
+}
+
+PyObject * MGLUniformRing_push(MGLUniformRing * self, PyObject * args) {
+	PyObject * data;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O",
+		&data
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (self->used == self->count) {
+		MGLError_Set("the ring is full (%d slots)", self->count);
+		return 0;
+	}
+
+	char * ptr = self->data + self->used * self->stride;
+
+	if (Py_TYPE(data) == &MGLBlockWriter_Type) {
+		MGLBlockWriter * writer = (MGLBlockWriter *)data;
+
+		if (writer->size > self->block_size) {
+			MGLError_Set("data size mismatch %d > %d", writer->size, self->block_size);
+			return 0;
+		}
+
+		memcpy(ptr, writer->data, writer->size);
+
+	} else {
+		Py_buffer buffer_view;
+
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		if (get_buffer < 0) {
+			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+			return 0;
+		}
+
+		if (buffer_view.len > self->block_size) {
+			MGLError_Set("data size mismatch %d > %d", (int)buffer_view.len, self->block_size);
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		memcpy(ptr, buffer_view.buf, buffer_view.len);
+		PyBuffer_Release(&buffer_view);
+	}
+
+	return PyLong_FromLong(self->used++);
+}
+
+PyObject * MGLUniformRing_commit(MGLUniformRing * self) {
+	MGLUniformRing_Commit(self);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLUniformRing_reset(MGLUniformRing * self) {
+	const GLMethods & gl = self->context->gl;
+
+	// The storage is orphaned so the next frame does not wait for draws still reading the previous one.
+
+	gl.BindBuffer(GL_UNIFORM_BUFFER, self->buffer_obj);
+	gl.BufferData(GL_UNIFORM_BUFFER, self->stride * self->count, 0, GL_STREAM_DRAW);
+
+	self->used = 0;
+	self->committed = 0;
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLUniformRing_bind(MGLUniformRing * self, PyObject * args) {
+	int slot;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"i",
+		&slot
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!MGLUniformRing_Bind(self, slot)) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLUniformRing_release(MGLUniformRing * self) {
+	MGLUniformRing_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLUniformRing_tp_methods[] = {
+	{"push", (PyCFunction)MGLUniformRing_push, METH_VARARGS, 0},
+	{"commit", (PyCFunction)MGLUniformRing_commit, METH_NOARGS, 0},
+	{"reset", (PyCFunction)MGLUniformRing_reset, METH_NOARGS, 0},
+	{"bind", (PyCFunction)MGLUniformRing_bind, METH_VARARGS, 0},
+	{"release", (PyCFunction)MGLUniformRing_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLUniformRing_get_used(MGLUniformRing * self, void * closure) {
+	return PyLong_FromLong(self->used);
+}
+
+PyObject * MGLUniformRing_get_binding(MGLUniformRing * self, void * closure) {
+	return PyLong_FromLong(self->binding);
+}
+
+int MGLUniformRing_set_binding(MGLUniformRing * self, PyObject * value, void * closure) {
+	int binding = PyLong_AsLong(value);
+
+	if (PyErr_Occurred()) {
+		MGLError_Set("invalid value for binding");
+		return -1;
+	}
+
+	self->binding = binding;
+	return 0;
+}
+
+PyGetSetDef MGLUniformRing_tp_getseters[] = {
+	{(char *)"used", (getter)MGLUniformRing_get_used, 0, 0, 0},
+	{(char *)"binding", (getter)MGLUniformRing_get_binding, (setter)MGLUniformRing_set_binding, 0, 0},
+	{0},
+};
+
+PyTypeObject MGLUniformRing_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.UniformRing",                                      // tp_name
+	sizeof(MGLUniformRing),                                 // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLUniformRing_tp_dealloc,                  // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLUniformRing_tp_methods,                              // tp_methods
+	0,                                                      // tp_members
+	MGLUniformRing_tp_getseters,                            // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLUniformRing_tp_new,                                  // tp_new
+};
+
+void MGLUniformRing_Invalidate(MGLUniformRing * ring) {
+	if (Py_TYPE(ring) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	// TODO: decref
+
+	const GLMethods & gl = ring->context->gl;
+	gl.DeleteBuffers(1, (GLuint *)&ring->buffer_obj);
+
+	delete[] ring->data;
+	ring->data = 0;
+
+	Py_TYPE(ring) = &MGLInvalidObject_Type;
+	Py_DECREF(ring);
+}
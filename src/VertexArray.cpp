@@ -3,7 +3,7 @@
 #include "BufferFormat.hpp"
 
 PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
-	MGLProgram * program;
+	PyObject * program_or_pipeline;
 	PyObject * content;
 	MGLBuffer * index_buffer;
 	int index_element_size;
@@ -11,9 +11,8 @@ PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"O!OOIp",
-		&MGLProgram_Type,
-		&program,
+		"OOOIp",
+		&program_or_pipeline,
 		&content,
 		&index_buffer,
 		&index_element_size,
@@ -24,6 +23,39 @@ PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	MGLProgram * program = 0;
+	MGLProgramPipeline * pipeline = 0;
+
+	if (Py_TYPE(program_or_pipeline) == &MGLProgramPipeline_Type) {
+		pipeline = (MGLProgramPipeline *)program_or_pipeline;
+
+		if (!pipeline->programs[VERTEX_SHADER_SLOT]) {
+			MGLError_Set("the pipeline has no vertex stage");
+			return 0;
+		}
+
+		// The varyings for transform feedback are captured from the last vertex processing stage.
+
+		program = pipeline->programs[VERTEX_SHADER_SLOT];
+
+		// The programs are in the same order as SHADER_TYPE, the tess_evaluation_shader is the last one.
+
+		if (pipeline->programs[NUM_SHADER_SLOTS - 1]) {
+			program = pipeline->programs[NUM_SHADER_SLOTS - 1];
+		}
+
+		if (pipeline->programs[GEOMETRY_SHADER_SLOT]) {
+			program = pipeline->programs[GEOMETRY_SHADER_SLOT];
+		}
+
+	} else if (Py_TYPE(program_or_pipeline) == &MGLProgram_Type) {
+		program = (MGLProgram *)program_or_pipeline;
+
+	} else {
+		MGLError_Set("the program must be a Program or a ProgramPipeline not %s", Py_TYPE(program_or_pipeline)->tp_name);
+		return 0;
+	}
+
 	if (program->context != self) {
 		MGLError_Set("the program belongs to a different context");
 		return 0;
@@ -126,6 +158,9 @@ PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 	Py_INCREF(program);
 	array->program = program;
 
+	Py_XINCREF(pipeline);
+	array->pipeline = pipeline;
+
 	array->vertex_array_obj = 0;
 	gl.GenVertexArrays(1, (GLuint *)&array->vertex_array_obj);
 
@@ -192,9 +227,9 @@ PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 				int count = node->count / attribute->rows_length;
 
 				if (attribute->normalizable) {
-					((gl_attribute_normal_ptr_proc)attribute->gl_attrib_ptr_proc)(location, count, node->type, node->normalize, format_info.size, ptr);
+					((gl_attribute_normal_ptr_proc)GL_METHOD_AT(gl, attribute->gl_attrib_ptr_method))(location, count, node->type, node->normalize, format_info.size, ptr);
 				} else {
-					((gl_attribute_ptr_proc)attribute->gl_attrib_ptr_proc)(location, count, node->type, format_info.size, ptr);
+					((gl_attribute_ptr_proc)GL_METHOD_AT(gl, attribute->gl_attrib_ptr_method))(location, count, node->type, format_info.size, ptr);
 				}
 
 				gl.VertexAttribDivisor(location, format_info.divisor);
@@ -233,26 +268,36 @@ void MGLVertexArray_tp_dealloc(MGLVertexArray * self) {
 }
 
 inline void MGLVertexArray_SET_SUBROUTINES(MGLVertexArray * self, const GLMethods & gl);
+inline void MGLVertexArray_USE_PROGRAM(MGLVertexArray * self, const GLMethods & gl);
 
 PyObject * MGLVertexArray_render(MGLVertexArray * self, PyObject * args) {
 	int mode;
 	int vertices;
 	int first;
 	int instances;
+	PyObject * ring;
+	int slot;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"IIII",
+		"IIIIOi",
 		&mode,
 		&vertices,
 		&first,
-		&instances
+		&instances,
+		&ring,
+		&slot
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
+	if (ring != Py_None && Py_TYPE(ring) != &MGLUniformRing_Type) {
+		MGLError_Set("ring must be a UniformRing not %s", Py_TYPE(ring)->tp_name);
+		return 0;
+	}
+
 	if (vertices < 0) {
 		if (self->num_vertices < 0) {
 			MGLError_Set("cannot detect the number of vertices");
@@ -264,7 +309,11 @@ PyObject * MGLVertexArray_render(MGLVertexArray * self, PyObject * args) {
 
 	const GLMethods & gl = self->context->gl;
 
-	gl.UseProgram(self->program->program_obj);
+	if (ring != Py_None && !MGLUniformRing_Bind((MGLUniformRing *)ring, slot)) {
+		return 0;
+	}
+
+	MGLVertexArray_USE_PROGRAM(self, gl);
 	gl.BindVertexArray(self->vertex_array_obj);
 
 	MGLVertexArray_SET_SUBROUTINES(self, gl);
@@ -279,44 +328,209 @@ PyObject * MGLVertexArray_render(MGLVertexArray * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLVertexArray_render_ring(MGLVertexArray * self, PyObject * args) {
+	MGLUniformRing * ring;
+	int mode;
+	int vertices;
+	int first;
+	int instances;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!IIII",
+		&MGLUniformRing_Type,
+		&ring,
+		&mode,
+		&vertices,
+		&first,
+		&instances
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (vertices < 0) {
+		if (self->num_vertices < 0) {
+			MGLError_Set("cannot detect the number of vertices");
+			return 0;
+		}
+
+		vertices = self->num_vertices;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	MGLUniformRing_Commit(ring);
+	MGLVertexArray_USE_PROGRAM(self, gl);
+	gl.BindVertexArray(self->vertex_array_obj);
+
+	MGLVertexArray_SET_SUBROUTINES(self, gl);
+
+	// One draw per slot, only the binding offset changes between the draws.
+
+	for (int slot = 0; slot < ring->used; ++slot) {
+		gl.BindBufferRange(GL_UNIFORM_BUFFER, ring->binding, ring->buffer_obj, (GLintptr)slot * ring->stride, ring->block_size);
+
+		if (self->index_buffer != (MGLBuffer *)Py_None) {
+			const void * ptr = (const void *)((GLintptr)first * 4);
+			gl.DrawElementsInstanced(mode, vertices, self->index_element_type, ptr, instances);
+		} else {
+			gl.DrawArraysInstanced(mode, first, vertices, instances);
+		}
+	}
+
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLVertexArray_render_indirect(MGLVertexArray * self, PyObject * args) {
 	MGLBuffer * buffer;
 	int mode;
 	int count;
 	int first;
+	PyObject * count_buffer;
+	Py_ssize_t count_offset;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"O!III",
+		"O!IiIOn",
 		&MGLBuffer_Type,
 		&buffer,
 		&mode,
 		&count,
-		&first
+		&first,
+		&count_buffer,
+		&count_offset
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
+	// DrawArraysIndirectCommand is 4 integers, DrawElementsIndirectCommand is 5 integers.
+
+	bool indexed = self->index_buffer != (MGLBuffer *)Py_None;
+	int stride = indexed ? 20 : 16;
+
 	if (count < 0) {
-		count = buffer->size / 20 - first;
+		count = (int)(buffer->size / stride) - first;
+	}
+
+	if (count < 0 || (Py_ssize_t)(first + count) * stride > buffer->size) {
+		MGLError_Set("the draw commands %d to %d do not fit in the buffer", first, first + count - 1);
+		return 0;
+	}
+
+	if (count_buffer != Py_None) {
+		if (Py_TYPE(count_buffer) != &MGLBuffer_Type) {
+			MGLError_Set("the count_buffer must be a Buffer not %s", Py_TYPE(count_buffer)->tp_name);
+			return 0;
+		}
+
+		if (!self->context->indirect_parameters) {
+			MGLError_Set("count_buffer requires OpenGL 4.6 or ARB_indirect_parameters");
+			return 0;
+		}
+
+		if (count_offset < 0 || count_offset % 4 || count_offset + 4 > ((MGLBuffer *)count_buffer)->size) {
+			MGLError_Set("invalid count_offset %d", (int)count_offset);
+			return 0;
+		}
 	}
 
 	const GLMethods & gl = self->context->gl;
 
-	gl.UseProgram(self->program->program_obj);
+	MGLVertexArray_USE_PROGRAM(self, gl);
 	gl.BindVertexArray(self->vertex_array_obj);
 	gl.BindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer->buffer_obj);
 
 	MGLVertexArray_SET_SUBROUTINES(self, gl);
 
-	const void * ptr = (const void *)((GLintptr)first * 20);
+	const void * ptr = (const void *)((GLintptr)first * stride);
 
-	if (self->index_buffer != (MGLBuffer *)Py_None) {
-		gl.MultiDrawElementsIndirect(mode, self->index_element_type, ptr, count, 20);
+	// The draw count is read from the parameter buffer, the count argument is the upper limit.
+
+	if (count_buffer != Py_None) {
+		gl.BindBuffer(GL_PARAMETER_BUFFER, ((MGLBuffer *)count_buffer)->buffer_obj);
+
+		if (indexed) {
+			gl.MultiDrawElementsIndirectCount(mode, self->index_element_type, ptr, (GLintptr)count_offset, count, stride);
+		} else {
+			gl.MultiDrawArraysIndirectCount(mode, ptr, (GLintptr)count_offset, count, stride);
+		}
+
+		// Some drivers keep reading the draw count of later indirect draws from a bound parameter buffer.
+
+		gl.BindBuffer(GL_PARAMETER_BUFFER, 0);
+	} else if (indexed) {
+		gl.MultiDrawElementsIndirect(mode, self->index_element_type, ptr, count, stride);
 	} else {
-		gl.MultiDrawArraysIndirect(mode, ptr, count, 20);
+		gl.MultiDrawArraysIndirect(mode, ptr, count, stride);
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLVertexArray_render_queries(MGLVertexArray * self, PyObject * args) {
+	MGLQueryPool * pool;
+	int mode;
+	int vertices;
+	int first;
+	int count;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!IIIi",
+		&MGLQueryPool_Type,
+		&pool,
+		&mode,
+		&vertices,
+		&first,
+		&count
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (count < 0) {
+		count = pool->size - first;
+	}
+
+	if (count < 0 || first + count > pool->size) {
+		MGLError_Set("the queries %d to %d are out of range", first, first + count - 1);
+		return 0;
+	}
+
+	if (self->num_vertices >= 0 && (long long)(first + count) * vertices > self->num_vertices) {
+		MGLError_Set("the vertex array has less than %d vertices", (first + count) * vertices);
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	MGLVertexArray_USE_PROGRAM(self, gl);
+	gl.BindVertexArray(self->vertex_array_obj);
+
+	MGLVertexArray_SET_SUBROUTINES(self, gl);
+
+	// Every query counts the samples of its own proxy, the vertices of query i start at i * vertices.
+
+	bool indexed = self->index_buffer != (MGLBuffer *)Py_None;
+
+	for (int i = first; i < first + count; ++i) {
+		if (!MGLQueryPool_Begin(pool, i)) {
+			return 0;
+		}
+
+		if (indexed) {
+			const void * ptr = (const void *)((GLintptr)i * vertices * self->index_element_size);
+			gl.DrawElements(mode, vertices, self->index_element_type, ptr);
+		} else {
+			gl.DrawArrays(mode, i * vertices, vertices);
+		}
+
+		MGLQueryPool_End(pool);
 	}
 
 	Py_RETURN_NONE;
@@ -360,7 +574,7 @@ PyObject * MGLVertexArray_transform(MGLVertexArray * self, PyObject * args) {
 
 	const GLMethods & gl = self->context->gl;
 
-	gl.UseProgram(self->program->program_obj);
+	MGLVertexArray_USE_PROGRAM(self, gl);
 	gl.BindVertexArray(self->vertex_array_obj);
 
 	gl.BindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, output->buffer_obj);
@@ -471,6 +685,8 @@ PyObject * MGLVertexArray_release(MGLVertexArray * self) {
 PyMethodDef MGLVertexArray_tp_methods[] = {
 	{"render", (PyCFunction)MGLVertexArray_render, METH_VARARGS, 0},
 	{"render_indirect", (PyCFunction)MGLVertexArray_render_indirect, METH_VARARGS, 0},
+	{"render_ring", (PyCFunction)MGLVertexArray_render_ring, METH_VARARGS, 0},
+	{"render_queries", (PyCFunction)MGLVertexArray_render_queries, METH_VARARGS, 0},
 	{"transform", (PyCFunction)MGLVertexArray_transform, METH_VARARGS, 0},
 	{"bind", (PyCFunction)MGLVertexArray_bind, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLVertexArray_release, METH_NOARGS, 0},
@@ -607,6 +823,12 @@ void MGLVertexArray_Complete(MGLVertexArray * vertex_array) {
 	vertex_array->num_subroutines += vertex_array->program->num_tess_evaluation_shader_subroutines;
 	vertex_array->num_subroutines += vertex_array->program->num_tess_control_shader_subroutines;
 
+	// Subroutine uniforms are per program, they are not supported for pipelines.
+
+	if (vertex_array->pipeline) {
+		vertex_array->num_subroutines = 0;
+	}
+
 	if (vertex_array->num_subroutines) {
 		vertex_array->subroutines = new unsigned[vertex_array->num_subroutines];
 	} else {
@@ -614,6 +836,23 @@ void MGLVertexArray_Complete(MGLVertexArray * vertex_array) {
 	}
 }
 
+inline void MGLVertexArray_USE_PROGRAM(MGLVertexArray * self, const GLMethods & gl) {
+	if (self->pipeline) {
+		for (int i = 0; i < NUM_SHADER_SLOTS; ++i) {
+			if (self->pipeline->programs[i]) {
+				MGLUniformShadow_Flush(&self->pipeline->programs[i]->uniform_shadow, gl);
+			}
+		}
+
+		gl.UseProgram(0);
+		gl.BindProgramPipeline(self->pipeline->pipeline_obj);
+	} else {
+		MGLUniformShadow_Flush(&self->program->uniform_shadow, gl);
+
+		gl.UseProgram(self->program->program_obj);
+	}
+}
+
 inline void MGLVertexArray_SET_SUBROUTINES(MGLVertexArray * self, const GLMethods & gl) {
 		if (self->subroutines) {
 		unsigned * subroutines = self->subroutines;
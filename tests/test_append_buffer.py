@@ -0,0 +1,122 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 430:
+            raise unittest.SkipTest('OpenGL 4.3 is not supported')
+
+        # Appends the odd invocation indices.
+        cls.emitter = cls.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 16) in;
+
+            layout (std430, binding = 0) buffer Output {
+                uint items[];
+            };
+
+            layout (binding = 0, offset = 0) uniform atomic_uint emitted;
+
+            void main() {
+                uint value = gl_GlobalInvocationID.x;
+                if (value % 2u == 1u) {
+                    uint index = atomicCounterIncrement(emitted);
+                    if (index < items.length()) {
+                        items[index] = value;
+                    }
+                }
+            }
+        ''')
+
+    def test_bind_to_atomic_counter(self):
+        counter = self.ctx.buffer(struct.pack('2I', 0, 10))
+        output = self.ctx.buffer(reserve=256)
+        output.bind_to_storage_buffer(0)
+        counter.bind_to_atomic_counter(0, offset=4, size=4)
+        self.emitter.run(2)
+        self.ctx.memory_barrier()
+        self.assertEqual(struct.unpack('2I', counter.read()), (0, 26))
+
+        with self.assertRaises(moderngl.Error):
+            counter.bind_to_atomic_counter(0, offset=2)
+
+        with self.assertRaises(moderngl.Error):
+            counter.bind_to_atomic_counter(0, offset=4, size=8)
+
+    def test_append(self):
+        items = self.ctx.append_buffer(64, 4)
+        self.assertEqual(items.capacity, 64)
+        self.assertEqual(items.item_size, 4)
+        self.assertEqual(items.count, 0)
+
+        items.bind(0, 0)
+        self.emitter.run(4)
+        self.assertEqual(items.count, 32)
+        self.assertEqual(sorted(struct.unpack('32I', items.read())), list(range(1, 64, 2)))
+
+        items.reset()
+        self.assertEqual(items.count, 0)
+
+    def test_overflow(self):
+        items = self.ctx.append_buffer(8, 4)
+        items.bind()
+        self.emitter.run(4)
+        self.assertEqual(items.count, 8)
+        self.assertEqual(len(items.read()), 32)
+
+    def test_copy_count_to_indirect_dispatch(self):
+        consumer = self.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 1) in;
+
+            layout (std430, binding = 1) buffer Result {
+                uint invocations;
+            };
+
+            void main() {
+                atomicAdd(invocations, 1u);
+            }
+        ''')
+
+        items = self.ctx.append_buffer(64, 4)
+        items.bind()
+        self.emitter.run(2)
+
+        command = self.ctx.buffer(struct.pack('3I', 0, 1, 1))
+        items.copy_count(command)
+        self.assertEqual(struct.unpack('3I', command.read()), (16, 1, 1))
+
+        result = self.ctx.buffer(reserve=4)
+        result.clear()
+        result.bind_to_storage_buffer(1)
+        consumer.run_indirect(command)
+        self.ctx.memory_barrier()
+        self.assertEqual(struct.unpack('I', result.read()), (16,))
+
+    def test_copy_count_clamped(self):
+        items = self.ctx.append_buffer(8, 4)
+        items.bind()
+        self.emitter.run(4)
+
+        command = self.ctx.buffer(struct.pack('4I', 0, 0, 1, 1))
+        items.copy_count(command, offset=4)
+        self.assertEqual(struct.unpack('4I', command.read()), (0, 8, 1, 1))
+
+        items.reset(3)
+        items.copy_count(command, offset=4)
+        self.assertEqual(struct.unpack('4I', command.read()), (0, 3, 1, 1))
+        self.assertEqual(struct.unpack('I', items.counter.read()), (3,))
+
+
+if __name__ == '__main__':
+    unittest.main()
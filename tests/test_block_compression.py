@@ -0,0 +1,101 @@
+import unittest
+
+import moderngl
+from common import get_context
+
+
+def gradient(width, height, components):
+    data = bytearray()
+    for y in range(height):
+        for x in range(width):
+            t = (x + y) / (width + height - 2)
+            pixel = [int(t * 255), int(40 + t * 160), int(200 - t * 120), int(255 - t * 100)]
+            data.extend(pixel[:components])
+    return bytes(data)
+
+
+def mean_error(a, b):
+    return sum(abs(x - y) for x, y in zip(a, b)) / len(a)
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 420:
+            raise unittest.SkipTest('OpenGL 4.2 is not supported')
+
+    def decode(self, blocks, size, components, compression):
+        texture = self.ctx.texture(size, components, blocks, compression=compression)
+        return texture.read()
+
+    def test_solid_colors(self):
+        red = bytes([255, 0, 0, 255]) * 64
+        self.assertEqual(self.decode(moderngl.compress(red, (8, 8), 'bc1'), (8, 8), 4, 'bc1'), red)
+
+        color = bytes([36, 200, 90, 128]) * 64
+        self.assertEqual(self.decode(moderngl.compress(color, (8, 8), 'bc7'), (8, 8), 4, 'bc7'), color)
+
+        color = bytes([37, 200, 91, 128]) * 64
+        decoded = self.decode(moderngl.compress(color, (8, 8), 'bc7'), (8, 8), 4, 'bc7')
+        self.assertLessEqual(max(abs(a - b) for a, b in zip(color, decoded)), 1)
+
+        alpha = bytes([10, 20, 30, 77]) * 16
+        decoded = self.decode(moderngl.compress(alpha, (4, 4), 'bc3'), (4, 4), 4, 'bc3')
+        self.assertEqual(decoded[3::4], bytes([77]) * 16)
+
+    def test_gradients(self):
+        cases = [
+            ('bc1', 3, 'bc1', 3.0),
+            ('bc3', 4, 'bc3', 3.0),
+            ('bc4', 1, 'bc4', 1.5),
+            ('bc5', 2, 'bc5', 1.5),
+            ('bc7', 4, 'bc7', 1.5),
+        ]
+
+        for fmt, components, compression, limit in cases:
+            pixels = gradient(32, 16, components)
+            for quality in range(4):
+                blocks = moderngl.compress(pixels, (32, 16), fmt, quality, components=components)
+                decoded = self.decode(blocks, (32, 16), components, compression)
+                self.assertLess(mean_error(pixels, decoded), limit, msg='%s quality=%d' % (fmt, quality))
+
+    def test_partial_blocks(self):
+        pixels = gradient(10, 6, 4)
+        blocks = moderngl.compress(pixels, (10, 6), 'bc7')
+        self.assertEqual(len(blocks), 3 * 2 * 16)
+        self.assertLess(mean_error(pixels, self.decode(blocks, (10, 6), 4, 'bc7')), 1.5)
+
+    def test_threads(self):
+        pixels = gradient(64, 64, 4)
+        single = moderngl.compress(pixels, (64, 64), 'bc7', 2, threads=1)
+        multi = moderngl.compress(pixels, (64, 64), 'bc7', 2, threads=5)
+        self.assertEqual(single, multi)
+
+    def test_buffer(self):
+        pixels = gradient(16, 8, 4)
+        buffer = self.ctx.buffer(reserve=16 + 64)
+        moderngl.compress(pixels, (16, 8), 'bc1', buffer=buffer, offset=16)
+        self.assertEqual(buffer.read(64, offset=16), moderngl.compress(pixels, (16, 8), 'bc1'))
+
+        texture = self.ctx.texture((16, 8), 4, compression='bc1')
+        texture.write_levels(self.ctx.buffer(buffer.read(64, offset=16)))
+
+        with self.assertRaises(moderngl.Error):
+            moderngl.compress(pixels, (16, 8), 'bc1', buffer=buffer, offset=17)
+
+    def test_errors(self):
+        with self.assertRaises(moderngl.Error):
+            moderngl.compress(bytes(64), (4, 4), 'bc6h')
+
+        with self.assertRaises(moderngl.Error):
+            moderngl.compress(bytes(63), (4, 4), 'bc1')
+
+        with self.assertRaises(moderngl.Error):
+            moderngl.compress(bytes(64), (4, 4), 'bc1', 4)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,176 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                layout (std140) uniform Block {
+                    float a;
+                    vec3 b;
+                    mat3 m;
+                    float arr[3];
+                };
+
+                in float vert;
+                out float result;
+
+                void main() {
+                    result = vert + a + b.y + m[1][2] + arr[2];
+                }
+            ''',
+            varyings=['result']
+        )
+
+    def test_std140_reflection(self):
+        block = self.prog['Block']
+        members = block.members
+        self.assertEqual(block.size, 128)
+        self.assertEqual(sorted(members), ['a', 'arr', 'b', 'm'])
+        self.assertEqual(members['a'].offset, 0)
+        self.assertEqual(members['b'].offset, 16)
+        self.assertEqual(members['b'].dimension, 3)
+        self.assertEqual(members['m'].offset, 32)
+        self.assertEqual(members['m'].matrix_stride, 16)
+        self.assertEqual(members['arr'].offset, 80)
+        self.assertEqual(members['arr'].array_length, 3)
+        self.assertEqual(members['arr'].array_stride, 16)
+        self.assertEqual(members['arr'].shape, 'f')
+
+    def test_std140_padding(self):
+        writer = self.prog['Block'].writer()
+        self.assertEqual(writer.size, 128)
+
+        writer['a'] = 1.0
+        writer['b'] = (2.0, 3.0, 4.0)
+        writer['m'] = struct.pack('9f', *range(9))
+        writer.update({'arr': [5.0, 6.0, 7.0]})
+
+        data = writer.read()
+        self.assertEqual(struct.unpack_from('f', data, 0), (1.0,))
+        self.assertEqual(struct.unpack_from('3f', data, 16), (2.0, 3.0, 4.0))
+        self.assertEqual(struct.unpack_from('3f', data, 48), (3.0, 4.0, 5.0))
+        self.assertEqual(struct.unpack_from('f', data, 112), (7.0,))
+
+    def test_write_to_uniform_buffer(self):
+        writer = self.prog['Block'].writer()
+        writer.update({'a': 1.0, 'b': (0.0, 2.0, 0.0), 'm': [0.0] * 5 + [4.0] + [0.0] * 3, 'arr': [0.0, 0.0, 8.0]})
+
+        ubo = self.ctx.buffer(reserve=writer.size)
+        writer.write_to(ubo)
+        self.assertEqual(ubo.read(), writer.read())
+
+        self.prog['Block'].binding = 3
+        ubo.bind_to_uniform_block(3)
+
+        vbo = self.ctx.buffer(struct.pack('f', 0.5))
+        res = self.ctx.buffer(reserve=4)
+        vao = self.ctx.simple_vertex_array(self.prog, vbo, 'vert')
+        vao.transform(res)
+        self.assertAlmostEqual(struct.unpack('f', res.read())[0], 15.5)
+
+    def test_invalid_member(self):
+        writer = self.prog['Block'].writer()
+
+        with self.assertRaises(moderngl.Error):
+            writer['missing'] = 1.0
+
+        with self.assertRaises(moderngl.Error):
+            writer['b'] = (1.0, 2.0)
+
+    def test_std430_storage_block(self):
+        if self.ctx.version_code < 430:
+            self.skipTest('OpenGL 4.3 is not supported')
+
+        compute_shader = self.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 1) in;
+
+            layout (std430, binding = 1) buffer Data {
+                vec2 scale;
+                float values[];
+            };
+
+            void main() {
+                for (int i = 0; i < values.length(); ++i) {
+                    values[i] *= scale.y;
+                }
+            }
+        ''')
+
+        block = compute_shader['Data']
+        self.assertEqual(block.members['values'].offset, 8)
+        self.assertEqual(block.members['values'].array_stride, 4)
+        self.assertEqual(block.members['values'].array_length, 0)
+
+        writer = block.writer(runtime_length=4)
+        self.assertEqual(writer.size, 24)
+        writer['scale'] = (0.0, 2.0)
+        writer['values'] = struct.pack('4f', 1.0, 2.0, 3.0, 4.0)
+
+        ssbo = self.ctx.buffer(reserve=writer.size)
+        writer.write_to(ssbo)
+        ssbo.bind_to_storage_buffer(1)
+        compute_shader.run()
+
+        self.assertEqual(struct.unpack('4f', ssbo.read(16, offset=8)), (2.0, 4.0, 6.0, 8.0))
+
+    def test_std430_array_of_structs(self):
+        if self.ctx.version_code < 430:
+            self.skipTest('OpenGL 4.3 is not supported')
+
+        compute_shader = self.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 1) in;
+
+            struct Light {
+                vec3 position;
+                float radius;
+            };
+
+            layout (std430, binding = 1) buffer Lights {
+                Light lights[4];
+                float total;
+            };
+
+            void main() {
+                total = 0.0;
+                for (int i = 0; i < 4; ++i) {
+                    total += lights[i].radius * lights[i].position.x;
+                }
+            }
+        ''')
+
+        members = compute_shader['Lights'].members
+        for i in range(4):
+            self.assertEqual(members['lights[%d].position' % i].offset, i * 16)
+            self.assertEqual(members['lights[%d].radius' % i].offset, i * 16 + 12)
+        self.assertEqual(members['total'].offset, 64)
+
+        writer = compute_shader['Lights'].writer()
+        for i in range(4):
+            writer['lights[%d].position' % i] = (1.0, 0.0, 0.0)
+            writer['lights[%d].radius' % i] = float(i + 1)
+
+        ssbo = self.ctx.buffer(reserve=writer.size)
+        writer.write_to(ssbo)
+        ssbo.bind_to_storage_buffer(1)
+        compute_shader.run()
+
+        self.assertEqual(struct.unpack('f', ssbo.read(4, offset=64)), (10.0,))
+
+
+if __name__ == '__main__':
+    unittest.main()
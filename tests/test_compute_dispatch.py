@@ -0,0 +1,111 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 430:
+            raise unittest.SkipTest('OpenGL 4.3 is not supported')
+
+        cls.counter = cls.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 2, local_size_y = 3, local_size_z = 1) in;
+
+            layout (std430, binding = 0) buffer Output {
+                uint groups[];
+            };
+
+            void main() {
+                if (gl_LocalInvocationIndex == 0) {
+                    atomicAdd(groups[0], 1u);
+                }
+            }
+        ''')
+
+    def tearDown(self):
+        self.ctx.compute_barrier = 0
+
+    def test_group_size(self):
+        self.assertEqual(self.counter.group_size, (2, 3, 1))
+
+    def test_run_indirect(self):
+        output = self.ctx.buffer(reserve=4)
+        output.clear()
+        output.bind_to_storage_buffer(0)
+
+        command = self.ctx.buffer(struct.pack('5I', 0, 0, 3, 2, 1))
+        self.counter.run_indirect(command, offset=8)
+        self.ctx.memory_barrier(moderngl.BUFFER_UPDATE_BARRIER_BIT)
+
+        self.assertEqual(struct.unpack('I', output.read()), (6,))
+
+    def test_indirect_command_written_by_compute(self):
+        # One dispatch sizes the next without reading the counts back.
+        sizer = self.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 1) in;
+
+            layout (std430, binding = 1) buffer Command {
+                uint command[3];
+            };
+
+            void main() {
+                command = uint[3](4u, 1u, 1u);
+            }
+        ''')
+
+        output = self.ctx.buffer(reserve=4)
+        output.clear()
+        output.bind_to_storage_buffer(0)
+
+        command = self.ctx.buffer(reserve=12)
+        command.bind_to_storage_buffer(1)
+
+        sizer.run()
+        self.ctx.memory_barrier(moderngl.COMMAND_BARRIER_BIT)
+        self.counter.run_indirect(command)
+        self.ctx.memory_barrier()
+
+        self.assertEqual(struct.unpack('I', output.read()), (4,))
+
+    def test_compute_barrier(self):
+        self.assertEqual(self.ctx.compute_barrier, 0)
+        self.ctx.compute_barrier = moderngl.SHADER_STORAGE_BARRIER_BIT | moderngl.BUFFER_UPDATE_BARRIER_BIT
+        self.assertEqual(self.ctx.compute_barrier, 0x2200)
+
+        output = self.ctx.buffer(reserve=4)
+        output.clear()
+        output.bind_to_storage_buffer(0)
+
+        self.counter.run(3, 1, 1)
+        self.counter.run(2, 1, 1)
+        self.assertEqual(struct.unpack('I', output.read()), (5,))
+
+    def test_memory_barrier_bits(self):
+        self.ctx.memory_barrier(moderngl.ALL_BARRIER_BITS)
+        self.ctx.memory_barrier(moderngl.SHADER_IMAGE_ACCESS_BARRIER_BIT | moderngl.TEXTURE_FETCH_BARRIER_BIT)
+
+        if self.ctx.version_code >= 450:
+            self.ctx.memory_barrier(moderngl.SHADER_STORAGE_BARRIER_BIT, by_region=True)
+
+    def test_run_indirect_errors(self):
+        command = self.ctx.buffer(reserve=16)
+
+        with self.assertRaises(moderngl.Error):
+            self.counter.run_indirect(command, offset=2)
+
+        with self.assertRaises(moderngl.Error):
+            self.counter.run_indirect(command, offset=8)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,144 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 430:
+            raise unittest.SkipTest('OpenGL 4.3 is not supported')
+
+    def test_copy_whole_texture(self):
+        src = self.ctx.texture((4, 4), 4, bytes(range(64)))
+        dst = self.ctx.texture((4, 4), 4)
+        self.ctx.copy_texture(dst, src)
+        self.assertEqual(dst.read(), src.read())
+
+    def test_copy_region(self):
+        src = self.ctx.texture((4, 4), 1, bytes(range(16)))
+        dst = self.ctx.texture((4, 4), 1, bytes(16))
+        self.ctx.copy_texture(dst, src, (1, 1, 2, 2), (2, 0))
+        self.assertEqual(dst.read(), bytes([0, 0, 5, 6, 0, 0, 9, 10]) + bytes(8))
+
+    def test_copy_keeps_storage(self):
+        src = self.ctx.texture((2, 2), 4, b'\xff' * 16)
+        dst = self.ctx.texture((8, 8), 4, bytes(256), levels=-1)
+        self.ctx.copy_texture(dst, src, dst_offset=(6, 6))
+        self.assertEqual(dst.size, (8, 8))
+        self.assertEqual(dst.read()[-8:], b'\xff' * 8)
+        self.assertEqual(dst.read()[:8], bytes(8))
+
+    def test_copy_between_types(self):
+        layers = b'\x01' * 4 + b'\x02' * 4 + b'\x03' * 4
+        array = self.ctx.texture_array((2, 2, 3), 1, layers)
+        texture = self.ctx.texture((2, 2), 1)
+        self.ctx.copy_texture(texture, array, (0, 0, 2, 2, 2, 1))
+        self.assertEqual(texture.read(), b'\x03' * 4)
+
+        cube = self.ctx.texture_cube((2, 2), 1, bytes(24))
+        self.ctx.copy_texture(cube, array, (0, 0, 0, 2, 2, 3), (0, 0, 3))
+        self.assertEqual(cube.read(3) + cube.read(4) + cube.read(5), layers)
+
+        volume = self.ctx.texture3d((2, 2, 3), 1)
+        self.ctx.copy_texture(volume, array, (0, 0, 0, 2, 2, 3))
+        self.assertEqual(volume.read(), layers)
+
+    def test_copy_levels(self):
+        levels = b'\x01' * 64 + b'\x02' * 16 + b'\x03' * 4
+        src = self.ctx.texture((4, 4), 4, levels=-1)
+        src.write_levels(levels)
+        dst = self.ctx.texture((4, 4), 4, levels=-1, immutable=True)
+        self.ctx.copy_texture(dst, src, src_level=1, dst_level=1, levels=2)
+        self.assertEqual(dst.read(level=1), b'\x02' * 16)
+        self.assertEqual(dst.read(level=2), b'\x03' * 4)
+
+    def test_copy_reinterprets_same_size(self):
+        src = self.ctx.texture((2, 1), 4, struct.pack('8B', 0, 0, 128, 63, 0, 0, 0, 64))
+        dst = self.ctx.texture((2, 1), 1, dtype='f4')
+        self.ctx.copy_texture(dst, src)
+        self.assertEqual(struct.unpack('2f', dst.read()), (1.0, 2.0))
+
+    def test_copy_compressed(self):
+        block = struct.pack('<HHI', 0xffff, 0x0000, 0)
+        src = self.ctx.texture((8, 8), 4, block * 4, compression='bc1')
+        dst = self.ctx.texture((8, 8), 4, bytes(32), compression='bc1')
+        self.ctx.copy_texture(dst, src, (4, 4, 4, 4), (0, 0))
+        self.assertEqual(dst.read()[:16], b'\xff' * 16)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(dst, src, (2, 0, 4, 4))
+
+    def test_copy_errors(self):
+        src = self.ctx.texture((4, 4), 4)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(self.ctx.texture((4, 4), 2), src)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(self.ctx.texture((2, 2), 4), src)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(self.ctx.texture((4, 4), 4), src, (2, 2, 4, 4))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(self.ctx.texture((4, 4), 4), src, src_level=1)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.copy_texture(self.ctx.buffer(reserve=64), src)
+
+    def test_texture_view(self):
+        texture = self.ctx.texture((2, 1), 4, struct.pack('2f', 1.0, 2.0), immutable=True)
+        view = texture.view(1, 'f4')
+        self.assertEqual(view.components, 1)
+        self.assertEqual(view.dtype, 'f4')
+        self.assertEqual(struct.unpack('2f', view.read()), (1.0, 2.0))
+
+        view.write(struct.pack('2f', 3.0, 4.0))
+        self.assertEqual(texture.read(), struct.pack('2f', 3.0, 4.0))
+
+    def test_texture_view_levels(self):
+        texture = self.ctx.texture((4, 4), 1, levels=-1, immutable=True)
+        texture.write_levels(b'\x01' * 16 + b'\x02' * 4 + b'\x03')
+        view = texture.view(base_level=1)
+        self.assertEqual(view.size, (2, 2))
+        self.assertEqual(view.levels, 2)
+        self.assertEqual(view.read(), b'\x02' * 4)
+        self.assertEqual(view.read(level=1), b'\x03')
+
+    def test_texture_array_view(self):
+        layers = b'\x01' * 4 + b'\x02' * 4 + b'\x03' * 4
+        array = self.ctx.texture_array((2, 2, 3), 1, layers, immutable=True)
+        view = array.view(base_layer=1, layers=2)
+        self.assertEqual(view.size, (2, 2, 2))
+        self.assertEqual(view.read(), layers[4:])
+
+    def test_view_errors(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 4).view()
+
+        texture = self.ctx.texture((4, 4), 4, immutable=True)
+
+        with self.assertRaises(moderngl.Error):
+            texture.view(2)
+
+        with self.assertRaises(moderngl.Error):
+            texture.view(base_level=1)
+
+        with self.assertRaises(moderngl.Error):
+            texture.view(base_level=-1)
+
+        with self.assertRaises(moderngl.Error):
+            texture.view(base_level=-1, levels=1)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_array((2, 2, 2), 4, immutable=True).view(layers=3)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -37,6 +37,9 @@ class TestCase(unittest.TestCase):
     def test_program_docs(self):
         self.validate('program.rst', 'Program', ['release', 'mglo', 'glo', 'ctx'])
 
+    def test_program_pipeline_docs(self):
+        self.validate('program_pipeline.rst', 'ProgramPipeline', ['release', 'mglo', 'glo', 'ctx'])
+
     def test_vertex_array_docs(self):
         self.validate('vertex_array.rst', 'VertexArray', ['release', 'mglo', 'glo', 'ctx'])
 
@@ -79,6 +82,18 @@ class TestCase(unittest.TestCase):
     def test_uniform_block_docs(self):
         self.validate('uniform_block.rst', 'UniformBlock', ['mglo'])
 
+    def test_uniform_batch_docs(self):
+        self.validate('uniform_batch.rst', 'UniformBatch', ['mglo'])
+
+    def test_storage_block_docs(self):
+        self.validate('storage_block.rst', 'StorageBlock', ['mglo'])
+
+    def test_block_member_docs(self):
+        self.validate('block_member.rst', 'BlockMember', [])
+
+    def test_block_writer_docs(self):
+        self.validate('block_writer.rst', 'BlockWriter', ['mglo'])
+
     def test_varying_docs(self):
         self.validate('varying.rst', 'Varying', ['mglo'])
 
@@ -88,5 +103,26 @@ class TestCase(unittest.TestCase):
     def test_sampler_docs(self):
         self.validate('sampler.rst', 'Sampler', ['release', 'mglo', 'glo', 'ctx'])
 
+    def test_uniform_ring_docs(self):
+        self.validate('uniform_ring.rst', 'UniformRing', ['release', 'mglo', 'glo', 'ctx'])
+
+    def test_append_buffer_docs(self):
+        self.validate('append_buffer.rst', 'AppendBuffer', ['ctx'])
+
+    def test_indirect_buffer_docs(self):
+        self.validate('indirect_buffer.rst', 'IndirectBuffer', ['ctx'])
+
+    def test_parallel_primitives_docs(self):
+        self.validate('parallel_primitives.rst', 'ParallelPrimitives', ['ctx'])
+
+    def test_instance_culling_docs(self):
+        self.validate('instance_culling.rst', 'InstanceCulling', ['ctx'])
+
+    def test_query_pool_docs(self):
+        self.validate('query_pool.rst', 'QueryPool', ['mglo', 'ctx'])
+
+    def test_profiler_docs(self):
+        self.validate('profiler.rst', 'Profiler', ['ctx'])
+
 if __name__ == '__main__':
     unittest.main()
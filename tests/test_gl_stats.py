@@ -0,0 +1,173 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def tearDown(self):
+        self.ctx.gl_instrumentation = False
+
+    def test_calls_and_bytes(self):
+        self.ctx.gl_stats(reset=True)
+        self.ctx.gl_instrumentation = True
+        self.assertTrue(self.ctx.gl_instrumentation)
+
+        buf = self.ctx.buffer(reserve=64)
+        buf.write(b'\x01' * 16)
+        buf.read()
+
+        texture = self.ctx.texture((4, 4), 4)
+        texture.write(b'\x00' * 64)
+        texture.read()
+
+        self.ctx.gl_instrumentation = False
+        buf.write(b'\x02' * 16)
+
+        stats = self.ctx.gl_stats()
+        self.assertEqual(stats['functions']['glBufferSubData'], {
+            'calls': 1, 'time': stats['functions']['glBufferSubData']['time'], 'upload_bytes': 16, 'readback_bytes': 0,
+        })
+        self.assertEqual(stats['functions']['glMapBufferRange']['readback_bytes'], 64)
+        self.assertEqual(stats['functions']['glTexSubImage2D']['upload_bytes'], 64)
+        self.assertEqual(stats['functions']['glGetTexImage']['readback_bytes'], 64)
+
+        self.assertEqual(stats['calls'], sum(f['calls'] for f in stats['functions'].values()))
+        self.assertGreaterEqual(stats['upload_bytes'], 16 + 64)
+        self.assertGreaterEqual(stats['readback_bytes'], 64 + 64)
+        self.assertGreater(stats['time'], 0)
+
+        self.ctx.gl_stats(reset=True)
+        self.assertEqual(self.ctx.gl_stats()['calls'], 0)
+
+    def test_frames(self):
+        self.ctx.gl_stats(reset=True)
+        self.ctx.gl_instrumentation = True
+
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        self.ctx.mark_frame()
+
+        for clears in (1, 3, 3):
+            for _ in range(clears):
+                fbo.clear()
+            self.ctx.mark_frame()
+
+        stats = self.ctx.gl_stats(reset=True)
+        frames = [frame['calls'] for frame in stats['frames']]
+        self.assertEqual(len(frames), 4)
+        self.assertEqual(frames[2], frames[3])
+        self.assertGreater(frames[2], frames[1])
+        self.assertEqual(sum(stats['histogram'].values()), 4)
+        self.assertEqual(stats['functions']['glClear']['calls'], 7)
+
+    def test_frame_history(self):
+        self.ctx.gl_stats(reset=True)
+        self.ctx.gl_instrumentation = True
+
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        self.ctx.mark_frame()
+
+        fbo.clear()
+        self.ctx.mark_frame()
+
+        for _ in range(4095):
+            self.ctx.mark_frame()
+
+        fbo.clear()
+        fbo.clear()
+        self.ctx.mark_frame()
+
+        stats = self.ctx.gl_stats(reset=True)
+        frames = [frame['calls'] for frame in stats['frames']]
+        self.assertEqual(len(frames), 4096)
+        self.assertEqual(frames[0], 0)
+        self.assertGreater(frames[-1], 0)
+        self.assertEqual(sum(frames), frames[-1])
+        self.assertEqual(stats['functions']['glClear']['calls'], 3)
+
+    def test_objects_outlive_instrumentation(self):
+        self.ctx.gl_instrumentation = True
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+                uniform vec2 offset;
+                in vec2 in_vert;
+                void main() {
+                    gl_Position = vec4(in_vert + offset, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                out vec4 f_color;
+                void main() {
+                    f_color = vec4(1.0);
+                }
+            ''',
+        )
+        vbo = self.ctx.buffer(reserve=24)
+        vao = self.ctx.simple_vertex_array(prog, vbo, 'in_vert')
+        self.ctx.gl_instrumentation = False
+        self.ctx.gl_stats(reset=True)
+
+        prog['offset'].value = (0.5, 0.5)
+        vao.render()
+        self.assertEqual(prog['offset'].value, (0.5, 0.5))
+        self.assertEqual(self.ctx.gl_stats()['calls'], 0)
+
+    def test_null_context_after_real_context(self):
+        self.ctx.gl_instrumentation = True
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+                uniform float scale;
+                in float in_vert;
+                out float value;
+                void main() {
+                    value = in_vert + scale;
+                }
+            ''',
+            varyings=['value'],
+        )
+        vbo = self.ctx.buffer(struct.pack('f', 0.0))
+        vao = self.ctx.simple_vertex_array(prog, vbo, 'in_vert')
+        self.ctx.gl_instrumentation = False
+
+        null = moderngl.create_standalone_context(backend='null')
+        null.gl_instrumentation = True
+
+        try:
+            prog['scale'].value = 7.0
+            output = self.ctx.buffer(reserve=4)
+            vao.transform(output, moderngl.POINTS, 1)
+            self.assertEqual(struct.unpack('f', output.read()), (7.0,))
+            self.assertNotIn('glProgramUniform1fv', null.gl_stats()['functions'])
+        finally:
+            null.gl_instrumentation = False
+            null.release()
+
+    def test_release(self):
+        for _ in range(2):
+            ctx = moderngl.create_standalone_context(backend='null')
+            ctx.gl_instrumentation = True
+            ctx.buffer(reserve=4)
+            ctx.mark_frame()
+            ctx.release()
+
+            self.assertFalse(ctx.gl_instrumentation)
+            self.assertEqual(ctx.gl_stats()['frames'], [])
+
+    def test_disabled(self):
+        self.assertFalse(self.ctx.gl_instrumentation)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.gl_instrumentation = 1
+
+
+if __name__ == '__main__':
+    unittest.main()
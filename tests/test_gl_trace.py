@@ -0,0 +1,233 @@
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        fd, self.path = tempfile.mkstemp(suffix='.bin')
+        os.close(fd)
+
+    def tearDown(self):
+        os.remove(self.path)
+
+    def end_trace(self):
+        try:
+            self.ctx.end_trace()
+        except moderngl.Error:
+            pass
+
+    def record(self, frames):
+        self.ctx.begin_trace(self.path)
+        self.addCleanup(self.end_trace)
+
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                void main() {
+                    gl_Position = vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                uniform vec4 color;
+                out vec4 f_color;
+                void main() {
+                    f_color = color;
+                }
+            ''',
+        )
+
+        vbo = self.ctx.buffer(struct.pack('6f', -1.0, -1.0, 3.0, -1.0, -1.0, 3.0))
+        vao = self.ctx.simple_vertex_array(prog, vbo, 'in_vert')
+        fbo = self.ctx.simple_framebuffer((4, 4))
+
+        for i in range(frames):
+            fbo.use()
+            fbo.clear()
+            prog['color'].value = (i / 4.0, 0.5, 1.0, 1.0)
+            vao.render()
+            fbo.read()
+            self.ctx.mark_frame()
+
+        self.ctx.end_trace()
+        pixels = fbo.read()
+
+        for obj in (vao, vbo, prog, fbo):
+            obj.release()
+
+        return pixels
+
+    def test_replay(self):
+        pixels = self.record(3)
+
+        result = self.ctx.replay_trace(self.path)
+        self.assertEqual(len(result['frames']), 3)
+        self.assertGreater(result['calls'], 0)
+        self.assertEqual(result['skipped'], 0)
+
+        # The framebuffer of the last frame is still bound after the replay.
+        fbo = self.ctx.detect_framebuffer()
+        self.assertEqual(fbo.read(), pixels)
+        self.assertEqual(pixels[:3], bytes([128, 128, 255]))
+
+    def test_replay_stats(self):
+        self.record(2)
+
+        self.ctx.gl_instrumentation = True
+        self.ctx.gl_stats(reset=True)
+        self.ctx.replay_trace(self.path, finish=False)
+        stats = self.ctx.gl_stats(reset=True)
+        self.ctx.gl_instrumentation = False
+
+        self.assertEqual(stats['functions']['glBufferData']['upload_bytes'], 24)
+        self.assertEqual(stats['functions']['glReadPixels']['calls'], 2)
+        self.assertEqual(stats['functions']['glReadPixels']['readback_bytes'], 96)
+
+    def test_objects_outlive_trace(self):
+        self.ctx.begin_trace(self.path)
+        self.addCleanup(self.end_trace)
+
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                void main() {
+                    gl_Position = vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                uniform vec4 color;
+                out vec4 f_color;
+                void main() {
+                    f_color = color;
+                }
+            ''',
+        )
+
+        vbo = self.ctx.buffer(struct.pack('6f', -1.0, -1.0, 3.0, -1.0, -1.0, 3.0))
+        vao = self.ctx.simple_vertex_array(prog, vbo, 'in_vert')
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        self.ctx.end_trace()
+
+        fbo.use()
+        prog['color'].value = (1.0, 0.0, 1.0, 1.0)
+        vao.render()
+        self.assertEqual(fbo.read()[:3], bytes([255, 0, 255]))
+
+        for obj in (vao, vbo, prog, fbo):
+            obj.release()
+
+    def test_null_context_after_real_context(self):
+        self.ctx.begin_trace(self.path)
+        self.addCleanup(self.end_trace)
+
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+                uniform float scale;
+                in float in_vert;
+                out float value;
+                void main() {
+                    value = in_vert + scale;
+                }
+            ''',
+            varyings=['value'],
+        )
+        vbo = self.ctx.buffer(struct.pack('f', 0.0))
+        vao = self.ctx.simple_vertex_array(prog, vbo, 'in_vert')
+        self.ctx.end_trace()
+
+        null = moderngl.create_standalone_context(backend='null')
+        fd, path = tempfile.mkstemp(suffix='.bin')
+        os.close(fd)
+        null.begin_trace(path)
+
+        try:
+            prog['scale'].value = 7.0
+            output = self.ctx.buffer(reserve=4)
+            vao.transform(output, moderngl.POINTS, 1)
+            self.assertEqual(struct.unpack('f', output.read()), (7.0,))
+        finally:
+            null.end_trace()
+            null.release()
+            os.remove(path)
+
+    def test_trace_errors(self):
+        self.ctx.begin_trace(self.path)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.begin_trace(self.path)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.gl_instrumentation = True
+
+        self.ctx.end_trace()
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.end_trace()
+
+        with open(self.path, 'wb') as f:
+            f.write(b'not a trace')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.replay_trace(self.path)
+
+    def test_replay_invalid_pointers(self):
+        data = bytearray(b'MGLTRACE' + struct.pack('I', 1))
+
+        def define(record, name):
+            data.extend(struct.pack('3H', 0xFFFF, record, len(name)) + name)
+
+        def stored(payload):
+            data.extend(struct.pack('=BI', 2, len(payload)))
+            data.extend(bytes(-len(data) & 7) + payload)
+
+        define(0, b'glBufferSubData')
+        define(1, b'glGetBufferSubData')
+        define(2, b'glGenBuffers')
+
+        # Less data than the call reads.
+        data.extend(struct.pack('=HIqq', 0, 0x8892, 0, 1 << 20))
+        stored(bytes(4))
+
+        # An offset for a method that only records client memory.
+        data.extend(struct.pack('=HIqqBQ', 0, 0x8892, 0, 4, 1, 0))
+
+        # Stored data for an output.
+        data.extend(struct.pack('=HIqq', 1, 0x8892, 0, 4))
+        stored(bytes(4))
+
+        # Less names than generated.
+        data.extend(struct.pack('=Hi', 2, 4))
+        stored(bytes(4))
+
+        with open(self.path, 'wb') as f:
+            f.write(data)
+
+        result = self.ctx.replay_trace(self.path)
+        self.assertEqual(result['calls'], 0)
+        self.assertEqual(result['skipped'], 4)
+
+    def test_replay_command(self):
+        self.record(2)
+
+        output = subprocess.check_output([sys.executable, '-m', 'moderngl', 'replay', self.path, '--json'])
+        self.assertIn('"frames": 2', output.decode())
+
+
+if __name__ == '__main__':
+    unittest.main()
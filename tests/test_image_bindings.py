@@ -0,0 +1,169 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 430:
+            raise unittest.SkipTest('OpenGL 4.3 is not supported')
+
+    def test_write_texture(self):
+        compute_shader = self.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 4, local_size_y = 4) in;
+            layout (rgba8, binding = 2) writeonly uniform image2D image;
+
+            void main() {
+                ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+                imageStore(image, texel, vec4(texel.x, texel.y, 0.0, 255.0) / 255.0);
+            }
+        ''')
+
+        texture = self.ctx.texture((4, 4), 4)
+        texture.bind_to_image(2, read=False)
+        compute_shader.run()
+
+        expected = b''.join(bytes([x, y, 0, 255]) for y in range(4) for x in range(4))
+        self.assertEqual(texture.read(), expected)
+
+    def test_read_write_level(self):
+        compute_shader = self.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 2, local_size_y = 2) in;
+            layout (r32f, binding = 0) uniform image2D image;
+
+            void main() {
+                ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+                imageStore(image, texel, imageLoad(image, texel) * 2.0);
+            }
+        ''')
+
+        texture = self.ctx.texture((4, 4), 1, dtype='f4', levels=2)
+        texture.write(struct.pack('4f', 1.0, 2.0, 3.0, 4.0), level=1)
+        texture.bind_to_image(0, level=1)
+        compute_shader.run()
+
+        self.assertEqual(struct.unpack('4f', texture.read(level=1)), (2.0, 4.0, 6.0, 8.0))
+
+    def test_image_format(self):
+        compute_shader = self.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 4) in;
+            layout (r32ui, binding = 0) writeonly uniform uimage2D image;
+
+            void main() {
+                imageStore(image, ivec2(gl_GlobalInvocationID.x, 0), uvec4(0x04030201u * (gl_GlobalInvocationID.x + 1u)));
+            }
+        ''')
+
+        texture = self.ctx.texture((4, 1), 4)
+        texture.bind_to_image(0, read=False, format='r32ui')
+        compute_shader.run()
+
+        self.assertEqual(struct.unpack('4I', texture.read()), (0x04030201, 0x08060402, 0x0c090603, 0x100c0804))
+
+        texture = self.ctx.texture((4, 1), 1, dtype='u4')
+        texture.bind_to_image(0, read=False, format='u4')
+        compute_shader.run()
+
+        self.assertEqual(struct.unpack('4I', texture.read()), (0x04030201, 0x08060402, 0x0c090603, 0x100c0804))
+
+    def test_layers(self):
+        compute_shader = self.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 2, local_size_y = 2, local_size_z = 3) in;
+            layout (r32ui, binding = 1) writeonly uniform uimage2DArray image;
+
+            void main() {
+                imageStore(image, ivec3(gl_GlobalInvocationID), uvec4(gl_GlobalInvocationID.z + 1));
+            }
+        ''')
+
+        array = self.ctx.texture_array((2, 2, 3), 1, dtype='u4')
+        array.bind_to_image(1, read=False)
+        compute_shader.run()
+        self.assertEqual(struct.unpack('12I', array.read()), (1,) * 4 + (2,) * 4 + (3,) * 4)
+
+    def test_single_layer(self):
+        compute_shader = self.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 2, local_size_y = 2) in;
+            layout (r8, binding = 0) writeonly uniform image2D image;
+
+            void main() {
+                imageStore(image, ivec2(gl_GlobalInvocationID.xy), vec4(1.0));
+            }
+        ''')
+
+        cube = self.ctx.texture_cube((2, 2), 1, bytes(24))
+        cube.bind_to_image(0, read=False, layer=4)
+        compute_shader.run()
+
+        for face in range(6):
+            self.assertEqual(cube.read(face), (b'\xff' if face == 4 else b'\x00') * 4)
+
+    def test_scope(self):
+        compute_shader = self.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 2, local_size_y = 2, local_size_z = 2) in;
+            layout (r8ui, binding = 3) uniform uimage3D image;
+
+            void main() {
+                ivec3 texel = ivec3(gl_GlobalInvocationID);
+                imageStore(image, texel, imageLoad(image, texel) + 1u);
+            }
+        ''')
+
+        volume = self.ctx.texture3d((2, 2, 2), 1, bytes(range(8)), dtype='u1')
+        scope = self.ctx.scope(self.ctx.simple_framebuffer((4, 4)), images=[(volume, 3)])
+
+        with scope:
+            compute_shader.run()
+
+        self.assertEqual(volume.read(), bytes(range(1, 9)))
+
+    def test_scope_texture_array(self):
+        array = self.ctx.texture_array((2, 2, 2), 1)
+        self.ctx.scope(self.ctx.simple_framebuffer((4, 4)), textures=[(array, 0)])
+
+    def test_errors(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 4).bind_to_image(0, read=False, write=False)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 4).bind_to_image(0, level=1)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 3).bind_to_image(0)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 3).bind_to_image(0, format='f4')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 4).bind_to_image(0, format='rgb32f')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.depth_texture((4, 4)).bind_to_image(0)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_array((4, 4, 2), 4).bind_to_image(0, layer=2)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.scope(self.ctx.simple_framebuffer((4, 4)), images=[(self.ctx.buffer(reserve=4), 0)])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,123 @@
+import struct
+import unittest
+
+import moderngl
+import numpy as np
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 430:
+            raise unittest.SkipTest('OpenGL 4.3 is not supported')
+
+        # Every vertex is a point on its own pixel, the pixels count the draws with additive blending.
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in float in_index;
+
+                void main() {
+                    gl_Position = vec4((in_index + 0.5) / 4.0 - 1.0, 0.0, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+
+                out float color;
+
+                void main() {
+                    color = 1.0;
+                }
+            ''',
+        )
+
+        cls.vbo = cls.ctx.buffer(np.arange(8, dtype='f4'))
+        cls.ibo = cls.ctx.buffer(np.array([7, 6, 5, 4, 3, 2, 1, 0], dtype='i4'))
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, cls.vbo, 'in_index')
+        cls.indexed_vao = cls.ctx.simple_vertex_array(cls.prog, cls.vbo, 'in_index', index_buffer=cls.ibo)
+        cls.fbo = cls.ctx.framebuffer(cls.ctx.renderbuffer((8, 1), 1, dtype='f4'))
+
+    def draws(self, vao, *args, **kwargs):
+        self.fbo.use()
+        self.fbo.clear()
+        self.ctx.enable_only(moderngl.BLEND)
+        self.ctx.blend_func = moderngl.ONE, moderngl.ONE
+        vao.render_indirect(*args, mode=moderngl.POINTS, **kwargs)
+        self.ctx.enable_only(moderngl.NOTHING)
+        return [int(x) for x in struct.unpack('8f', self.fbo.read(components=1, dtype='f4'))]
+
+    def test_array_commands(self):
+        # count, instanceCount, first, baseInstance
+        commands = self.ctx.buffer(struct.pack('8I', 2, 1, 0, 0, 3, 2, 4, 0))
+        self.assertEqual(self.draws(self.vao, commands), [1, 1, 0, 0, 2, 2, 2, 0])
+        self.assertEqual(self.draws(self.vao, commands, first=1), [0, 0, 0, 0, 2, 2, 2, 0])
+
+        with self.assertRaises(moderngl.Error):
+            self.vao.render_indirect(commands, count=3)
+
+    def test_element_commands(self):
+        # count, instanceCount, firstIndex, baseVertex, baseInstance
+        commands = self.ctx.buffer(struct.pack('5I', 2, 1, 1, 0, 0) + struct.pack('3I1i1I', 1, 3, 0, -1, 0))
+        self.assertEqual(self.draws(self.indexed_vao, commands), [0, 0, 0, 0, 0, 1, 4, 0])
+
+    def test_builder(self):
+        commands = self.ctx.indirect_buffer(4)
+        self.assertEqual(commands.stride, 16)
+        self.assertEqual(commands.count, 0)
+
+        self.assertEqual(commands.write([1, 2], firsts=np.array([0, 3], dtype='i8')), 2)
+        self.assertEqual(commands.write(1, instances=3, firsts=7, offset=2), 1)
+        self.assertEqual(commands.count, 3)
+        self.assertEqual(struct.unpack('12I', commands.buffer.read(48)), (1, 1, 0, 0, 2, 1, 3, 0, 1, 3, 7, 0))
+        self.assertEqual(self.draws(self.vao, commands), [1, 0, 0, 1, 1, 0, 0, 3])
+
+        commands.count = 2
+        self.assertEqual(self.draws(self.vao, commands), [1, 0, 0, 1, 1, 0, 0, 0])
+
+        with self.assertRaises(ValueError):
+            self.indexed_vao.render_indirect(commands)
+
+        with self.assertRaises(ValueError):
+            commands.write([1, 2], offset=3)
+
+        with self.assertRaises(ValueError):
+            commands.write(1, base_vertices=2)
+
+        with self.assertRaises(moderngl.Error):
+            commands.write([1, 2], instances=[1, 2, 3])
+
+        with self.assertRaises(moderngl.Error):
+            commands.write(-1)
+
+    def test_indexed_builder(self):
+        commands = self.ctx.indirect_buffer(2, indexed=True)
+        self.assertEqual(commands.stride, 20)
+
+        commands.write(np.array([2, 1], dtype='u4'), firsts=[0, 0], base_vertices=[0, -7])
+        self.assertEqual(struct.unpack('5I5i', commands.buffer.read())[5:], (1, 1, 0, -7, 0))
+        self.assertEqual(self.draws(self.indexed_vao, commands), [1, 0, 0, 0, 0, 0, 1, 1])
+
+    def test_count_buffer(self):
+        commands = self.ctx.indirect_buffer(3)
+        commands.write([1, 1, 1], firsts=[0, 1, 2])
+        draw_count = self.ctx.buffer(struct.pack('2I', 0, 2))
+
+        try:
+            result = self.draws(self.vao, commands, count_buffer=draw_count, count_offset=4)
+        except moderngl.Error:
+            self.skipTest('ARB_indirect_parameters is not supported')
+
+        self.assertEqual(result, [1, 1, 0, 0, 0, 0, 0, 0])
+
+        with self.assertRaises(moderngl.Error):
+            self.vao.render_indirect(commands, count_buffer=draw_count, count_offset=2)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,138 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+IDENTITY = (1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0)
+
+
+def translation(x, y, z, scale=1.0):
+    return (scale, 0.0, 0.0, 0.0, 0.0, scale, 0.0, 0.0, 0.0, 0.0, scale, 0.0, x, y, z, 1.0)
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 430:
+            raise unittest.SkipTest('OpenGL 4.3 is not supported')
+
+        cls.culling = cls.ctx.instance_culling()
+
+    def transforms(self, *matrices):
+        return self.ctx.buffer(struct.pack('%df' % (len(matrices) * 16), *sum(matrices, ())))
+
+    def visible(self, commands, indices, command=0):
+        instances = struct.unpack('I', commands.buffer.read(4, offset=command * commands.stride + 4))[0]
+        return sorted(struct.unpack('%dI' % instances, indices.read(instances * 4)))
+
+    def test_frustum(self):
+        transforms = self.transforms(
+            translation(0.0, 0.0, 0.0),
+            translation(5.0, 0.0, 0.0),
+            translation(1.05, 0.0, 0.0),
+            translation(0.0, 0.0, 3.0),
+            translation(0.0, -1.3, 0.0, scale=4.0),
+            translation(0.0, -1.3, 0.0),
+        )
+
+        commands = self.ctx.indirect_buffer(2)
+        commands.write([36, 36], instances=[7, 7])
+        indices = self.ctx.buffer(reserve=6 * 4)
+
+        self.culling.cull(commands, transforms, (0.0, 0.0, 0.0, 0.1), IDENTITY, indices=indices, command=1)
+        self.assertEqual(self.visible(commands, indices, 1), [0, 2, 4])
+        self.assertEqual(struct.unpack('8I', commands.buffer.read()), (36, 7, 0, 0, 36, 3, 0, 0))
+
+        self.culling.cull(commands, transforms, (0.0, 0.0, 0.0, 0.1), IDENTITY, indices=indices, count=2)
+        self.assertEqual(self.visible(commands, indices), [0])
+
+    def test_bounds_and_visible_transforms(self):
+        transforms = self.transforms(translation(0.5, 0.0, 0.0), translation(-0.5, 0.0, 0.0), translation(0.0, 2.0, 0.0))
+        bounds = self.ctx.buffer(struct.pack('12f', 2.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.0, 1.5))
+
+        commands = self.ctx.indirect_buffer(1, indexed=True)
+        commands.write(6)
+        visible_transforms = self.ctx.buffer(reserve=3 * 64)
+
+        # The first sphere is moved out of the frustum, the last one is large enough to reach it.
+        view_projection = struct.pack('16f', *IDENTITY)
+        self.culling.cull(commands, transforms, bounds, view_projection, visible_transforms=visible_transforms)
+        self.assertEqual(struct.unpack('5I', commands.buffer.read())[1], 2)
+
+        offsets = sorted(struct.unpack('32f', visible_transforms.read(128))[i * 16 + 13] for i in range(2))
+        self.assertEqual(offsets, [0.0, 2.0])
+
+    def test_depth_pyramid(self):
+        depth = self.ctx.depth_texture((37, 20))
+        fbo = self.ctx.framebuffer(self.ctx.renderbuffer((37, 20)), depth)
+        fbo.clear(depth=0.25)
+        fbo.clear(depth=0.75, viewport=(36, 19, 1, 1))
+
+        pyramid = self.culling.build_depth_pyramid(fbo)
+        self.assertIs(self.culling.pyramid, pyramid)
+        self.assertEqual(pyramid.levels, 6)
+        self.assertEqual(depth.compare_func, '<=')
+
+        level0 = struct.unpack('%df' % (37 * 20), pyramid.read())
+        self.assertAlmostEqual(level0[0], 0.25, places=5)
+        self.assertAlmostEqual(level0[-1], 0.75, places=5)
+
+        # The odd column and row are kept by the last texel of every level.
+        for level in range(1, 6):
+            width, height = max(37 >> level, 1), max(20 >> level, 1)
+            values = struct.unpack('%df' % (width * height), pyramid.read(level=level))
+            self.assertAlmostEqual(values[-1], 0.75, places=5)
+            self.assertAlmostEqual(values[0], 0.25 if width * height > 1 else 0.75, places=5)
+
+        self.assertIs(self.culling.build_depth_pyramid(depth), pyramid)
+
+    def test_occlusion(self):
+        depth = self.ctx.depth_texture((64, 64))
+        fbo = self.ctx.framebuffer(self.ctx.renderbuffer((64, 64)), depth)
+
+        # The left half is covered by an occluder at depth 0.5.
+        fbo.clear(depth=1.0)
+        fbo.clear(depth=0.5, viewport=(0, 0, 32, 64))
+        self.culling.build_depth_pyramid(fbo)
+
+        transforms = self.transforms(
+            translation(-0.5, 0.0, 0.6),
+            translation(-0.5, 0.0, -0.6),
+            translation(0.5, 0.0, 0.6),
+            translation(0.0, 0.0, 0.6),
+        )
+
+        commands = self.ctx.indirect_buffer(1)
+        indices = self.ctx.buffer(reserve=4 * 4)
+        self.culling.cull(commands, transforms, (0.0, 0.0, 0.0, 0.1), IDENTITY, indices=indices, occlusion=True)
+        self.assertEqual(self.visible(commands, indices), [1, 2, 3])
+
+        self.culling.cull(commands, transforms, (0.0, 0.0, 0.0, 0.1), IDENTITY, indices=indices)
+        self.assertEqual(self.visible(commands, indices), [0, 1, 2, 3])
+
+    def test_errors(self):
+        transforms = self.transforms(IDENTITY)
+        commands = self.ctx.indirect_buffer(1)
+
+        with self.assertRaises(ValueError):
+            self.culling.cull(commands.buffer, transforms, (0.0, 0.0, 0.0, 1.0), IDENTITY)
+
+        with self.assertRaises(ValueError):
+            self.culling.cull(commands, transforms, (0.0, 0.0, 0.0, 1.0), IDENTITY, count=2)
+
+        with self.assertRaises(ValueError):
+            self.culling.cull(commands, transforms, (0.0, 0.0, 0.0, 1.0), IDENTITY, indices=self.ctx.buffer(reserve=2))
+
+        with self.assertRaises(ValueError):
+            self.culling.build_depth_pyramid(self.ctx.simple_framebuffer((4, 4)))
+
+        with self.assertRaises(ValueError):
+            self.ctx.instance_culling().cull(commands, transforms, (0.0, 0.0, 0.0, 1.0), IDENTITY, occlusion=True)
+
+
+if __name__ == '__main__':
+    unittest.main()
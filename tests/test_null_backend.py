@@ -0,0 +1,127 @@
+import struct
+import unittest
+
+import moderngl
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = moderngl.create_standalone_context(backend='null', size=(32, 16))
+
+    def test_info(self):
+        self.assertEqual(self.ctx.info['GL_RENDERER'], 'null')
+        self.assertEqual(self.ctx.version_code, 460)
+
+    def test_buffer(self):
+        buf = self.ctx.buffer(b'abcdefgh')
+        buf.write(b'XY', offset=2)
+        self.assertEqual(buf.read(), b'abXYefgh')
+
+        dst = self.ctx.buffer(reserve=8)
+        self.ctx.copy_buffer(dst, buf)
+        self.assertEqual(dst.read(), b'abXYefgh')
+
+    def test_program_reflection(self):
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                layout(location = 4) in vec3 in_color;
+                uniform mat4 mvp;
+                uniform float scale[3];
+                layout(std140) uniform Block {
+                    vec4 tint;
+                };
+                out vec3 v_color;
+                void main() {
+                    v_color = in_color * tint.rgb;
+                    gl_Position = mvp * vec4(in_vert * scale[0], 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                uniform sampler2D texture0;
+                in vec3 v_color;
+                out vec4 f_color;
+                void main() {
+                    f_color = vec4(v_color, 1.0) * texture(texture0, vec2(0.5));
+                }
+            ''',
+        )
+
+        self.assertEqual(sorted(prog), ['Block', 'in_color', 'in_vert', 'mvp', 'scale', 'texture0'])
+        self.assertEqual(prog['in_color'].location, 4)
+        self.assertEqual(prog['scale'].array_length, 3)
+
+        prog['mvp'].value = tuple(float(i) for i in range(16))
+        prog['scale'].value = [1.0, 2.0, 3.0]
+        self.assertEqual(prog['mvp'].value, tuple(float(i) for i in range(16)))
+        self.assertEqual(prog['scale'].value, [1.0, 2.0, 3.0])
+
+        vbo = self.ctx.buffer(struct.pack('15f', *range(15)))
+        vao = self.ctx.vertex_array(prog, [(vbo, '2f 3f', 'in_vert', 'in_color')])
+        vao.render()
+
+    def test_reads(self):
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        fbo.use()
+        fbo.clear(1.0, 1.0, 1.0, 1.0)
+        self.assertEqual(fbo.read(components=3), b'\x00' * 48)
+
+        texture = self.ctx.texture((5, 3), 3)
+        self.assertEqual(texture.read(), b'\x00' * 45)
+
+        pbo = self.ctx.buffer(b'\xff' * 48)
+        fbo.read_into(pbo, components=3)
+        self.assertEqual(pbo.read(), b'\x00' * 48)
+
+    def test_queries(self):
+        query = self.ctx.query(time=True)
+        with query:
+            pass
+        self.assertGreaterEqual(query.elapsed, 0)
+
+        pool = self.ctx.query_pool(2, kind='timestamp')
+        pool.timestamp(0)
+        pool.timestamp(1)
+        self.assertEqual(pool.poll(), 0)
+        first, second = struct.unpack('2q', pool.read())
+        self.assertLessEqual(first, second)
+
+    def test_call_counts(self):
+        buf = self.ctx.buffer(reserve=16)
+
+        self.ctx.gl_instrumentation = True
+        self.ctx.gl_stats(reset=True)
+        for _ in range(10):
+            buf.write(b'\x00' * 16)
+        stats = self.ctx.gl_stats(reset=True)
+        self.ctx.gl_instrumentation = False
+
+        self.assertEqual(stats['functions']['glBufferSubData']['calls'], 10)
+        self.assertEqual(stats['upload_bytes'], 160)
+
+    def test_compute_limits(self):
+        info = self.ctx.info
+        self.assertEqual(info['GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS'], 1024)
+        self.assertEqual(info['GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS'], 8)
+        self.assertEqual(info['GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS'], 1)
+
+        parallel = self.ctx.parallel_primitives()
+        self.assertEqual(parallel.group_size, 256)
+        src = self.ctx.buffer(struct.pack('64f', *range(64)))
+        parallel.reduce(src, dst=self.ctx.buffer(reserve=4))
+        parallel.release()
+
+        culling = self.ctx.instance_culling()
+        self.assertEqual(culling.group_size, 64)
+        commands = self.ctx.indirect_buffer(1)
+        transforms = self.ctx.buffer(reserve=64 * 4)
+        culling.cull(commands, transforms, (0.0, 0.0, 0.0, 1.0), (0.0,) * 16)
+        culling.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
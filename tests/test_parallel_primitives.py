@@ -0,0 +1,158 @@
+import random
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 430:
+            raise unittest.SkipTest('OpenGL 4.3 is not supported')
+
+        cls.prims = cls.ctx.parallel_primitives(group_size=64)
+        cls.random = random.Random(7)
+
+    def buffer(self, fmt, values):
+        return self.ctx.buffer(struct.pack('%d%s' % (len(values), fmt), *values))
+
+    def read(self, fmt, buffer, count):
+        return list(struct.unpack('%d%s' % (count, fmt), buffer.read(count * 4)))
+
+    def test_group_size_from_limits(self):
+        prims = self.ctx.parallel_primitives()
+        self.assertGreaterEqual(prims.group_size, 16)
+        self.assertLessEqual(prims.group_size, 256)
+        self.assertEqual(prims.group_size & (prims.group_size - 1), 0)
+
+        with self.assertRaises(ValueError):
+            self.ctx.parallel_primitives(group_size=48)
+
+    def test_reduce(self):
+        values = [self.random.randrange(-1000, 1000) for _ in range(70000)]
+        src = self.buffer('i', values)
+        self.assertEqual(self.prims.reduce(src, dtype='i4'), sum(values))
+        self.assertEqual(self.prims.reduce(src, 'min', dtype='i4'), min(values))
+        self.assertEqual(self.prims.reduce(src, 'max', dtype='i4'), max(values))
+        self.assertEqual(self.prims.reduce(src, 'max', dtype='i4', count=10), max(values[:10]))
+
+    def test_reduce_float_into_buffer(self):
+        values = [self.random.uniform(-1.0, 1.0) for _ in range(1000)]
+        values = list(struct.unpack('1000f', struct.pack('1000f', *values)))
+        src = self.buffer('f', values)
+        dst = self.ctx.buffer(reserve=8)
+        self.prims.reduce(src, 'min', dst=dst, offset=4)
+        self.assertEqual(self.read('f', dst, 2)[1], min(values))
+        self.assertAlmostEqual(self.prims.reduce(src), sum(values), places=3)
+
+    def test_scan(self):
+        values = [self.random.randrange(0, 100) for _ in range(5000)]
+        src = self.buffer('I', values)
+        dst = self.ctx.buffer(reserve=len(values) * 4)
+
+        self.prims.scan(dst, src, dtype='u4')
+        expected = [0]
+        for value in values[:-1]:
+            expected.append(expected[-1] + value)
+        self.assertEqual(self.read('I', dst, len(values)), expected)
+
+        self.prims.scan(src, src, dtype='u4', inclusive=True)
+        self.assertEqual(self.read('I', src, len(values)), expected[1:] + [expected[-1] + values[-1]])
+
+    def test_scan_float(self):
+        src = self.buffer('f', [1.0, 2.0, 0.5, 0.25])
+        self.prims.scan(src, src, inclusive=True)
+        self.assertEqual(self.read('f', src, 4), [1.0, 3.0, 3.5, 3.75])
+
+    def test_compact(self):
+        values = list(range(1, 3001))
+        flags = [self.random.randrange(0, 3) for _ in values]
+        src = self.buffer('I', values)
+        dst = self.ctx.buffer(reserve=len(values) * 4)
+
+        count = self.prims.compact(dst, src, self.buffer('I', flags), dtype='u4')
+        expected = [v for v, f in zip(values, flags) if f]
+        self.assertEqual(count, len(expected))
+        self.assertEqual(self.read('I', dst, count), expected)
+
+    def test_compact_nonzero_into_counter(self):
+        src = self.buffer('f', [0.0, 1.5, 0.0, -2.0, 3.0])
+        dst = self.ctx.buffer(reserve=20)
+        counter = self.ctx.buffer(reserve=8)
+        self.assertIsNone(self.prims.compact(dst, src, counter=counter, counter_offset=4))
+        self.assertEqual(self.read('I', counter, 2)[1], 3)
+        self.assertEqual(self.read('f', dst, 3), [1.5, -2.0, 3.0])
+
+    def test_sort(self):
+        keys = [self.random.randrange(0, 1 << 32) for _ in range(10000)]
+        buffer = self.buffer('I', keys)
+        self.prims.sort(buffer)
+        self.assertEqual(self.read('I', buffer, len(keys)), sorted(keys))
+
+    def test_sort_signed_and_float(self):
+        keys = [self.random.randrange(-1 << 31, 1 << 31) for _ in range(1000)]
+        buffer = self.buffer('i', keys)
+        self.prims.sort(buffer, dtype='i4')
+        self.assertEqual(self.read('i', buffer, len(keys)), sorted(keys))
+
+        keys = [self.random.uniform(-1e6, 1e6) for _ in range(1000)] + [float('inf'), float('-inf'), 0.0]
+        keys = list(struct.unpack('%df' % len(keys), struct.pack('%df' % len(keys), *keys)))
+        buffer = self.buffer('f', keys)
+        self.prims.sort(buffer, dtype='f4')
+        self.assertEqual(self.read('f', buffer, len(keys)), sorted(keys))
+
+    def test_sort_key_value_is_stable(self):
+        keys = [self.random.randrange(0, 8) for _ in range(500)]
+        keys_buffer = self.buffer('I', keys)
+        values_buffer = self.buffer('I', list(range(500)))
+        self.prims.sort(keys_buffer, values_buffer, count=400)
+
+        expected = sorted(range(400), key=lambda i: keys[i])
+        self.assertEqual(self.read('I', values_buffer, 400), expected)
+        self.assertEqual(self.read('I', keys_buffer, 500), [keys[i] for i in expected] + keys[400:])
+
+    def test_second_dispatch_row(self):
+        prims = self.ctx.parallel_primitives(group_size=16)
+
+        # A low limit moves the work groups to a second row with a partial last row.
+        prims._max_groups = 7
+
+        keys = [self.random.randrange(0, 1 << 32) for _ in range(1010)]
+        src = self.buffer('I', keys)
+        prims.sort(src, dtype='u4')
+        self.assertEqual(self.read('I', src, 1010), sorted(keys))
+
+        values = [self.random.randrange(0, 100) for _ in range(16 * 4 * 9 + 5)]
+        src = self.buffer('I', values)
+        self.assertEqual(prims.reduce(src, dtype='u4'), sum(values))
+
+        dst = self.ctx.buffer(reserve=len(values) * 4)
+        prims.scan(dst, src, dtype='u4')
+        self.assertEqual(self.read('I', dst, len(values)), [sum(values[:i]) for i in range(len(values))])
+
+        compacted = self.ctx.buffer(reserve=len(values) * 4)
+        kept = [value for value in values if value]
+        self.assertEqual(prims.compact(compacted, src, dtype='u4'), len(kept))
+        self.assertEqual(self.read('I', compacted, len(kept)), kept)
+        prims.release()
+
+    def test_errors(self):
+        src = self.ctx.buffer(reserve=16)
+
+        with self.assertRaises(ValueError):
+            self.prims.reduce(src, dtype='f8')
+
+        with self.assertRaises(ValueError):
+            self.prims.reduce(src, 'mean')
+
+        with self.assertRaises(ValueError):
+            self.prims.scan(src, src, count=5)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,97 @@
+import unittest
+
+import moderngl
+import numpy as np
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        try:
+            cls.ctx.query(statistics=True)
+        except moderngl.Error:
+            raise unittest.SkipTest('pipeline statistics are not supported')
+
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in vec2 in_vert;
+
+                void main() {
+                    gl_Position = vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+
+                out vec4 color;
+
+                void main() {
+                    color = vec4(1.0);
+                }
+            ''',
+        )
+
+        # Two full screen quads, the second one is drawn over the first.
+        quad = [-1.0, -1.0, 1.0, -1.0, 1.0, 1.0, -1.0, -1.0, 1.0, 1.0, -1.0, 1.0]
+        cls.vbo = cls.ctx.buffer(np.array(quad * 2, dtype='f4'))
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, cls.vbo, 'in_vert')
+        cls.fbo = cls.ctx.simple_framebuffer((16, 16))
+
+    def test_query(self):
+        self.fbo.use()
+        self.ctx.disable(moderngl.DEPTH_TEST)
+
+        query = self.ctx.query(samples=True, statistics=True)
+
+        with query:
+            self.vao.render()
+
+        self.ctx.finish()
+        self.assertTrue(query.ready)
+
+        stats = query.statistics
+        self.assertEqual(stats['vertices_submitted'], 12)
+        self.assertEqual(stats['primitives_submitted'], 4)
+        self.assertEqual(stats['clipping_input_primitives'], 4)
+        self.assertEqual(stats['compute_shader_invocations'], 0)
+        self.assertEqual(query.samples, 2 * 16 * 16)
+
+        # Implementations may count the helper invocations of the pixel quads along the edges.
+        self.assertGreaterEqual(stats['fragment_shader_invocations'], query.samples)
+
+        self.assertIsNone(self.ctx.query(samples=True).statistics)
+
+    def test_query_pool(self):
+        self.fbo.use()
+        self.ctx.disable(moderngl.DEPTH_TEST)
+
+        queries = self.ctx.query_pool(2, kind='fragment_shader_invocations')
+        queries.render(self.vao, vertices=6)
+        self.assertTrue(all(invocations >= 256 for invocations in queries.results(wait=True).tolist()))
+
+        if self.ctx.version_code < 430:
+            return
+
+        shader = self.ctx.compute_shader('''
+            #version 430
+
+            layout (local_size_x = 8, local_size_y = 4) in;
+
+            void main() {
+            }
+        ''')
+
+        queries = self.ctx.query_pool(1, kind='compute_shader_invocations')
+        queries.begin(0)
+        shader.run(3, 2)
+        queries.end()
+        self.assertEqual(queries.results(wait=True).tolist(), [8 * 4 * 3 * 2])
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,154 @@
+import json
+import os
+import tempfile
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 330:
+            raise unittest.SkipTest('OpenGL 3.3 is not supported')
+
+    def record(self, profiler, frames=2):
+        fbo = self.ctx.simple_framebuffer((4, 4))
+
+        for _ in range(frames):
+            profiler.begin_frame()
+            with profiler.scope('shadows'):
+                fbo.clear(1.0, 0.0, 0.0, 1.0)
+            with profiler.scope('scene'):
+                with profiler.scope('opaque'):
+                    fbo.clear(0.0, 1.0, 0.0, 1.0)
+            profiler.end_frame()
+
+        profiler.collect(wait=True)
+
+    def test_scopes(self):
+        profiler = self.ctx.profiler(frames=2)
+        self.record(profiler, 5)
+
+        self.assertEqual(profiler.frame, 5)
+        self.assertEqual([frame.index for frame in profiler.frames], [0, 1, 2, 3, 4])
+
+        for frame in profiler.frames:
+            self.assertEqual([(event.name, event.depth) for event in frame.events], [
+                ('frame', 0), ('shadows', 1), ('scene', 1), ('opaque', 2),
+            ])
+
+            root = frame.events[0]
+            for event in frame.events:
+                self.assertGreaterEqual(event.gpu_end, event.gpu_start)
+                self.assertGreaterEqual(event.cpu_end, event.cpu_start)
+                self.assertGreaterEqual(event.cpu_start, root.cpu_start)
+                self.assertLessEqual(event.cpu_end, root.cpu_end)
+
+        profiler.clear()
+        self.assertEqual(profiler.frames, [])
+        profiler.release()
+
+    def test_history(self):
+        profiler = self.ctx.profiler(history=2)
+        self.record(profiler, 4)
+        self.assertEqual([frame.index for frame in profiler.frames], [2, 3])
+        profiler.release()
+
+    def test_dropped(self):
+        profiler = self.ctx.profiler(capacity=6)
+        self.record(profiler, 1)
+
+        self.assertEqual(profiler.dropped, 1)
+        self.assertEqual([event.name for event in profiler.frames[0].events], ['frame', 'shadows', 'scene'])
+        profiler.release()
+
+    def test_chrome_trace(self):
+        profiler = self.ctx.profiler()
+        self.record(profiler)
+
+        trace = profiler.chrome_trace()
+        events = [event for event in trace['traceEvents'] if event['ph'] == 'X']
+        self.assertEqual(len(events), 2 * 2 * 4)
+        self.assertEqual({event['tid'] for event in events}, {1, 2})
+        self.assertTrue(all(event['dur'] >= 0.0 for event in events))
+
+        with tempfile.TemporaryDirectory() as folder:
+            path = os.path.join(folder, 'trace.json')
+            profiler.save_chrome_trace(path)
+            with open(path) as f:
+                self.assertEqual(json.load(f), trace)
+
+        profiler.release()
+
+    def test_save_load(self):
+        profiler = self.ctx.profiler()
+        self.record(profiler, 3)
+
+        with tempfile.TemporaryDirectory() as folder:
+            path = os.path.join(folder, 'frames.prof')
+            profiler.save(path)
+            self.assertEqual(moderngl.Profiler.load(path), profiler.frames)
+
+            with open(path, 'wb') as f:
+                f.write(b'not a profile')
+
+            with self.assertRaises(ValueError):
+                moderngl.Profiler.load(path)
+
+        profiler.release()
+
+    def test_errors(self):
+        profiler = self.ctx.profiler()
+
+        with self.assertRaises(ValueError):
+            profiler.push('scope')
+
+        with self.assertRaises(ValueError):
+            profiler.end_frame()
+
+        profiler.begin_frame()
+        profiler.push('scope')
+
+        with self.assertRaises(ValueError):
+            profiler.end_frame()
+
+        with self.assertRaises(ValueError):
+            profiler.begin_frame()
+
+        profiler.pop()
+        profiler.end_frame()
+        profiler.release()
+
+        with self.assertRaises(ValueError):
+            self.ctx.profiler(capacity=1)
+
+    def test_timestamp_queries(self):
+        queries = self.ctx.query_pool(2, kind='timestamp')
+
+        with self.assertRaises(moderngl.Error):
+            queries.begin(0)
+
+        start = self.ctx.gpu_time
+        queries.timestamp(0)
+        self.ctx.finish()
+        queries.timestamp(1)
+
+        first, second = queries.results(wait=True)
+        self.assertTrue(queries.ready())
+        self.assertGreaterEqual(first, 0)
+        self.assertGreaterEqual(second, first)
+        self.assertGreater(start, 0)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.query_pool(1).timestamp(0)
+
+        queries.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
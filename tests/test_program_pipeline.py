@@ -0,0 +1,106 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 410:
+            raise unittest.SkipTest('OpenGL 4.1 is not supported')
+
+        cls.vert = cls.ctx.separable_program('vertex', '''
+            #version 410
+
+            in vec2 vert;
+
+            out gl_PerVertex {
+                vec4 gl_Position;
+                float gl_PointSize;
+            };
+
+            uniform vec2 offset;
+
+            void main() {
+                gl_Position = vec4(vert + offset, 0.0, 1.0);
+            }
+        ''')
+
+        cls.red = cls.ctx.separable_program('fragment', '''
+            #version 410
+
+            out vec4 color;
+
+            void main() {
+                color = vec4(1.0, 0.0, 0.0, 1.0);
+            }
+        ''')
+
+        cls.tint = cls.ctx.separable_program('fragment', '''
+            #version 410
+
+            uniform vec4 tint;
+            out vec4 color;
+
+            void main() {
+                color = tint;
+            }
+        ''')
+
+        cls.vbo = cls.ctx.buffer(struct.pack('2f', 0.0, 0.0))
+        cls.fbo = cls.ctx.simple_framebuffer((1, 1))
+
+    def test_stages(self):
+        pipeline = self.ctx.program_pipeline(vertex=self.vert, fragment=self.red)
+        self.assertEqual(set(pipeline.stages), {'vertex', 'fragment'})
+        self.assertIs(pipeline['offset'], self.vert['offset'])
+        self.assertIs(pipeline.get('tint', None), None)
+
+    def test_render_combinations(self):
+        red = self.ctx.program_pipeline(vertex=self.vert, fragment=self.red)
+        tint = self.ctx.program_pipeline(vertex=self.vert, fragment=self.tint)
+
+        self.vert['offset'].value = (0.0, 0.0)
+        self.tint['tint'].value = (0.0, 1.0, 0.0, 1.0)
+
+        self.fbo.use()
+
+        self.fbo.clear()
+        self.ctx.simple_vertex_array(red, self.vbo, 'vert').render(moderngl.POINTS)
+        self.assertEqual(self.fbo.read(components=4), b'\xff\x00\x00\xff')
+
+        self.fbo.clear()
+        self.ctx.simple_vertex_array(tint, self.vbo, 'vert').render(moderngl.POINTS)
+        self.assertEqual(self.fbo.read(components=4), b'\x00\xff\x00\xff')
+
+        self.vert['offset'].value = (4.0, 0.0)
+        self.fbo.clear()
+        self.ctx.simple_vertex_array(tint, self.vbo, 'vert').render(moderngl.POINTS)
+        self.assertEqual(self.fbo.read(components=4), b'\x00\x00\x00\x00')
+        self.vert['offset'].value = (0.0, 0.0)
+
+    def test_not_separable(self):
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+                void main() {
+                    gl_Position = vec4(0.0);
+                }
+            '''
+        )
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.program_pipeline(vertex=prog)
+
+    def test_invalid_stage(self):
+        with self.assertRaises(ValueError):
+            self.ctx.separable_program('compute', '')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,149 @@
+import struct
+import unittest
+
+import moderngl
+import numpy as np
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in vec3 in_vert;
+
+                void main() {
+                    gl_Position = vec4(in_vert, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+
+                out vec4 color;
+
+                void main() {
+                    color = vec4(1.0);
+                }
+            ''',
+        )
+
+        # Three proxies of 6 vertices: the left half, the right half behind the occluder, the right half in front.
+        quads = []
+        for x0, x1, z in [(-1.0, 0.0, 0.0), (0.0, 1.0, 0.5), (0.0, 1.0, -0.5)]:
+            quads += [x0, -1.0, z, x1, -1.0, z, x1, 1.0, z, x0, -1.0, z, x1, 1.0, z, x0, 1.0, z]
+
+        cls.vbo = cls.ctx.buffer(np.array(quads, dtype='f4'))
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, cls.vbo, 'in_vert')
+        cls.fbo = cls.ctx.framebuffer(cls.ctx.renderbuffer((16, 16)), cls.ctx.depth_renderbuffer((16, 16)))
+
+    def draw_occluder(self):
+        # The right half of the framebuffer is covered at depth 0.5.
+        self.fbo.use()
+        self.fbo.clear(depth=1.0)
+        self.fbo.clear(depth=0.5, viewport=(8, 0, 8, 16))
+        self.ctx.enable_only(moderngl.DEPTH_TEST)
+
+    def test_samples(self):
+        self.draw_occluder()
+        queries = self.ctx.query_pool(3, kind='samples')
+        self.assertEqual(len(queries), 3)
+        self.assertEqual(queries.read(), struct.pack('3q', -1, -1, -1))
+
+        queries.render(self.vao, vertices=6)
+        self.assertEqual(queries.poll(wait=True), 0)
+        self.assertEqual(queries.results().tolist(), [128, 0, 128])
+        self.ctx.enable_only(moderngl.NOTHING)
+
+    def test_any_samples_begin_end(self):
+        self.draw_occluder()
+        queries = self.ctx.query_pool(1000)
+        self.assertEqual(queries.kind, 'any_samples')
+
+        queries.begin(10)
+        self.vao.render(vertices=6, first=6)
+        queries.end()
+        queries.begin(999)
+        self.vao.render(vertices=6, first=12)
+        queries.end()
+        self.assertEqual(queries.pending, 2)
+
+        results = queries.results(wait=True)
+        self.assertEqual(results.dtype, np.int64)
+        self.assertEqual(results[10], 0)
+        self.assertEqual(results[999], 1)
+        self.assertEqual(queries.pending, 0)
+        self.assertEqual(np.count_nonzero(results == -1), 998)
+
+        queries.reset()
+        self.assertEqual(queries.results(10, 1).tolist(), [-1])
+        self.ctx.enable_only(moderngl.NOTHING)
+
+    def test_results_without_waiting(self):
+        self.draw_occluder()
+        queries = self.ctx.query_pool(3)
+        queries.render(self.vao, vertices=6)
+        self.ctx.finish()
+
+        for _ in range(1000):
+            if not queries.poll():
+                break
+
+        self.assertEqual(queries.results().tolist(), [1, 0, 1])
+        self.ctx.enable_only(moderngl.NOTHING)
+
+    def test_conditional_render(self):
+        self.draw_occluder()
+        queries = self.ctx.query_pool(3)
+        queries.render(self.vao, vertices=6)
+
+        self.fbo.clear()
+        queries.begin_render(1, wait=True)
+        self.vao.render()
+        queries.end_render()
+        self.assertEqual(self.fbo.read(), b'\x00' * 16 * 16 * 3)
+        self.ctx.enable_only(moderngl.NOTHING)
+
+    def test_errors(self):
+        queries = self.ctx.query_pool(2, kind='time')
+
+        with self.assertRaises(ValueError):
+            self.ctx.query_pool(2, kind='timestamps')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.query_pool(0)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.query_pool(-1)
+
+        with self.assertRaises(moderngl.Error):
+            queries.begin(2)
+
+        with self.assertRaises(moderngl.Error):
+            queries.end()
+
+        with self.assertRaises(moderngl.Error):
+            queries.begin_render(0)
+
+        queries.begin(0)
+        with self.assertRaises(moderngl.Error):
+            queries.begin(1)
+        queries.end()
+
+        with self.assertRaises(moderngl.Error):
+            queries.read(1, 2)
+
+        with self.assertRaises(moderngl.Error):
+            queries.render(self.vao, vertices=12)
+
+        queries.poll(wait=True)
+        queries.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,116 @@
+import unittest
+
+import numpy as np
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def mosaic(self, height, width, components):
+        return np.arange(height * width * components, dtype='u1').reshape(height, width, components)
+
+    def test_texture_write_tile(self):
+        image = self.mosaic(16, 16, 4)
+        texture = self.ctx.texture((4, 4), 4)
+        texture.write(image[4:8, 8:12])
+        self.assertEqual(texture.read(), image[4:8, 8:12].tobytes())
+
+    def test_texture_write_viewport(self):
+        image = self.mosaic(8, 8, 4)
+        texture = self.ctx.texture((8, 8), 4, bytes(256))
+        texture.write(image[2:4, 1:6], (3, 5, 5, 2))
+        result = np.frombuffer(texture.read(), dtype='u1').reshape(8, 8, 4)
+        np.testing.assert_array_equal(result[5:7, 3:8], image[2:4, 1:6])
+        self.assertEqual(result[:5].sum(), 0)
+
+    def test_texture_write_rgb_rows(self):
+        # Rows of 5 RGB pixels padded to 16 bytes are described with the alignment.
+        padded = np.zeros((3, 16), dtype='u1')
+        padded[:, :15] = self.mosaic(3, 5, 3).reshape(3, 15)
+        view = np.lib.stride_tricks.as_strided(padded, shape=(3, 5, 3), strides=(16, 3, 1))
+        texture = self.ctx.texture((5, 3), 3)
+        texture.write(view)
+        self.assertEqual(texture.read(), self.mosaic(3, 5, 3).tobytes())
+
+    def test_texture_read_into_tile(self):
+        texture = self.ctx.texture((4, 4), 4, self.mosaic(4, 4, 4).tobytes())
+        target = np.zeros((16, 16, 4), dtype='u1')
+        texture.read_into(target[8:12, 4:8])
+        np.testing.assert_array_equal(target[8:12, 4:8], self.mosaic(4, 4, 4))
+        self.assertEqual(target.sum(), self.mosaic(4, 4, 4).astype(int).sum())
+
+    def test_texture_float(self):
+        image = np.arange(8 * 8 * 2, dtype='f4').reshape(8, 8, 2)
+        texture = self.ctx.texture((4, 2), 2, dtype='f4')
+        texture.write(image[3:5, 2:6])
+        self.assertEqual(texture.read(), image[3:5, 2:6].tobytes())
+
+    def test_texture_array(self):
+        volume = np.arange(3 * 8 * 8, dtype='u1').reshape(3, 8, 8, 1)
+        texture = self.ctx.texture_array((4, 4, 3), 1)
+        texture.write(volume[:, 2:6, 4:8])
+        self.assertEqual(texture.read(), volume[:, 2:6, 4:8].tobytes())
+
+        target = np.zeros((3, 6, 6, 1), dtype='u1')
+        texture.read_into(target[:, 1:5, 2:6])
+        np.testing.assert_array_equal(target[:, 1:5, 2:6], volume[:, 2:6, 4:8])
+
+    def test_texture3d(self):
+        volume = np.arange(4 * 4 * 4 * 2, dtype='u1').reshape(4, 4, 4, 2)
+        texture = self.ctx.texture3d((2, 2, 2), 2)
+        texture.write(volume[1:3, 1:3, 2:4])
+        self.assertEqual(texture.read(), volume[1:3, 1:3, 2:4].tobytes())
+
+    def test_texture_cube(self):
+        image = self.mosaic(8, 8, 4)
+        texture = self.ctx.texture_cube((4, 4), 4)
+        texture.write(2, image[4:, 4:])
+        self.assertEqual(texture.read(2), image[4:, 4:].tobytes())
+
+        target = np.zeros((8, 8, 4), dtype='u1')
+        texture.read_into(target[:4, 4:], 2)
+        np.testing.assert_array_equal(target[:4, 4:], image[4:, 4:])
+
+    def test_framebuffer_read_into_tile(self):
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        fbo.use()
+        fbo.clear(1.0, 0.0, 0.0, 1.0)
+        target = np.zeros((8, 8, 3), dtype='u1')
+        fbo.read_into(target[2:6, 2:6])
+        np.testing.assert_array_equal(target[2:6, 2:6], np.full((4, 4, 3), (255, 0, 0)))
+        self.assertEqual(target[:2].sum(), 0)
+
+    def test_contiguous_transfers_are_unchanged(self):
+        texture = self.ctx.texture((4, 4), 4)
+        texture.write(self.mosaic(4, 4, 4)[::-1].copy())
+        texture.write(self.mosaic(4, 4, 4).tobytes())
+        self.assertEqual(texture.read(), self.mosaic(4, 4, 4).tobytes())
+
+    def test_errors(self):
+        image = self.mosaic(8, 8, 4)
+        texture = self.ctx.texture((4, 4), 4)
+
+        with self.assertRaises(moderngl.Error):
+            texture.write(image[:4, :3])
+
+        with self.assertRaises(moderngl.Error):
+            texture.write(image[:4, ::2])
+
+        with self.assertRaises(moderngl.Error):
+            texture.write(image[:4, :4, :3])
+
+        with self.assertRaises(moderngl.Error):
+            texture.write(image[::-1][:4, :4])
+
+        with self.assertRaises(moderngl.Error):
+            texture.read_into(np.zeros((8, 8, 4), dtype='u1')[:4, :4], write_offset=4)
+
+
+if __name__ == '__main__':
+    unittest.main()
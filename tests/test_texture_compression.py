@@ -0,0 +1,83 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+WHITE = struct.pack('<HHI', 0xffff, 0x0000, 0)
+BLACK = struct.pack('<HHI', 0x0000, 0x0000, 0)
+RED = bytes([255, 0]) + bytes(6)
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 420:
+            raise unittest.SkipTest('OpenGL 4.2 is not supported')
+
+    def test_bc1(self):
+        texture = self.ctx.texture((8, 8), 4, WHITE * 4, compression='bc1')
+        self.assertEqual(texture.compression, 'bc1')
+        self.assertEqual(texture.read(), b'\xff' * 256)
+
+    def test_bc1_rgb_partial_blocks(self):
+        texture = self.ctx.texture((6, 6), 3, WHITE * 4, compression='bc1')
+        self.assertEqual(texture.read(), b'\xff' * 108)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((6, 6), 3, WHITE * 2, compression='bc1')
+
+    def test_write_compressed(self):
+        texture = self.ctx.texture((8, 4), 4, WHITE * 2, compression='bc1')
+        texture.write_compressed(BLACK, (4, 0, 4, 4))
+        row = b'\xff' * 16 + b'\x00\x00\x00\xff' * 4
+        self.assertEqual(texture.read(), row * 4)
+
+        with self.assertRaises(moderngl.Error):
+            texture.write_compressed(BLACK, (2, 0, 4, 4))
+
+        with self.assertRaises(moderngl.Error):
+            texture.write_compressed(BLACK * 2, (4, 0, 4, 4))
+
+        with self.assertRaises(moderngl.Error):
+            texture.write(b'\x00' * 128)
+
+        with self.assertRaises(moderngl.Error):
+            texture.build_mipmaps()
+
+    def test_compressed_levels(self):
+        for immutable in (False, True):
+            texture = self.ctx.texture((8, 8), 1, levels=-1, immutable=immutable, compression='bc4')
+            self.assertEqual(texture.levels, 4)
+            texture.write_levels(RED * 7)
+            self.assertEqual(texture.read(level=3), b'\xff')
+            texture.write_compressed(RED, level=2)
+
+    def test_invalid_compression(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 4, compression='bc9')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 3, compression='bc7')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((4, 4), 4).write_compressed(WHITE)
+
+    def test_texture_array(self):
+        texture = self.ctx.texture_array((4, 4, 2), 1, RED * 2, compression='bc4')
+        self.assertEqual(texture.read(), b'\xff' * 32)
+        texture.write_compressed(bytes(8), (0, 0, 1, 4, 4, 1))
+        self.assertEqual(texture.read(), b'\xff' * 16 + b'\x00' * 16)
+
+    def test_texture_cube(self):
+        texture = self.ctx.texture_cube((4, 4), 4, WHITE * 6, compression='bc1', levels=2, immutable=True)
+        texture.write_compressed(2, BLACK)
+        self.assertEqual(texture.read(1), b'\xff' * 64)
+        self.assertEqual(texture.read(2), b'\x00\x00\x00\xff' * 16)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,168 @@
+import os
+import struct
+import tempfile
+import unittest
+
+import moderngl
+from common import get_context
+
+KTX2_IDENTIFIER = b'\xabKTX 20\xbb\r\n\x1a\n'
+
+
+def ktx2(vk_format, size, levels, layers=0, faces=1, depth=0, supercompression=0):
+    header = KTX2_IDENTIFIER + struct.pack('<9I', vk_format, 1, size[0], size[1], depth, layers, faces, len(levels), supercompression)
+    header += struct.pack('<4I2Q', 0, 0, 0, 0, 0, 0)
+    offset = len(header) + 24 * len(levels)
+    index = b''
+    for level in levels:
+        index += struct.pack('<3Q', offset, len(level), len(level))
+        offset += len(level)
+    return header + index + b''.join(levels)
+
+
+def dds(size, images, levels=1, fourcc=None, dxgi=None, cube=False, array_size=1):
+    flags = 0x1007 | (0x20000 if levels > 1 else 0)
+    if fourcc or dxgi is not None:
+        pixel_format = struct.pack('<8I', 32, 0x4, struct.unpack('<I', fourcc or b'DX10')[0], 0, 0, 0, 0, 0)
+    else:
+        pixel_format = struct.pack('<8I', 32, 0x41, 0, 32, 0xff, 0xff00, 0xff0000, 0xff000000)
+    caps2 = 0xfe00 if cube else 0
+    header = b'DDS ' + struct.pack('<7I', 124, flags, size[1], size[0], 0, 0, levels) + bytes(44)
+    header += pixel_format + struct.pack('<5I', 0x1000, caps2, 0, 0, 0)
+    if dxgi is not None:
+        header += struct.pack('<5I', dxgi, 3, 0x4 if cube else 0, array_size, 0)
+    return header + b''.join(images)
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.tmp = tempfile.TemporaryDirectory()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.tmp.cleanup()
+
+    def save(self, name, content):
+        path = os.path.join(self.tmp.name, name)
+        with open(path, 'wb') as f:
+            f.write(content)
+        return path
+
+    def test_ktx2_texture(self):
+        levels = [bytes([i]) * (4 * (4 >> i) * (2 >> i or 1)) for i in range(3)]
+        for immutable in (False, True):
+            texture = self.ctx.load_texture(self.save('rgba.ktx2', ktx2(37, (4, 2), levels)), immutable=immutable)
+            self.assertIsInstance(texture, moderngl.Texture)
+            self.assertEqual(texture.size, (4, 2))
+            self.assertEqual(texture.components, 4)
+            self.assertEqual(texture.levels, 3)
+            self.assertEqual(texture.immutable, immutable)
+            for i in range(3):
+                self.assertEqual(texture.read(level=i), levels[i])
+
+    def test_ktx2_texture_array(self):
+        layers = b'\x01' * 8 + b'\x02' * 8 + b'\x03' * 8
+        texture = self.ctx.load_texture(self.save('array.ktx2', ktx2(9, (4, 2), [layers], layers=3)))
+        self.assertIsInstance(texture, moderngl.TextureArray)
+        self.assertEqual(texture.size, (4, 2, 3))
+        self.assertEqual(texture.read(), layers)
+
+    def test_ktx2_texture_cube(self):
+        faces = b''.join(bytes([i]) * 16 for i in range(6))
+        texture = self.ctx.load_texture(self.save('cube.ktx2', ktx2(37, (2, 2), [faces], faces=6)))
+        self.assertIsInstance(texture, moderngl.TextureCube)
+        for i in range(6):
+            self.assertEqual(texture.read(i), bytes([i]) * 16)
+
+    def test_ktx2_texture3d(self):
+        volume = bytes(range(2 * 2 * 3))
+        texture = self.ctx.load_texture(self.save('volume.ktx2', ktx2(9, (2, 2), [volume], depth=3)))
+        self.assertIsInstance(texture, moderngl.Texture3D)
+        self.assertEqual(texture.size, (2, 2, 3))
+        self.assertEqual(texture.read(), volume)
+
+    def test_dds_texture(self):
+        levels = [b'\x10' * 64, b'\x20' * 16, b'\x30' * 4]
+        texture = self.ctx.load_texture(self.save('rgba.dds', dds((4, 4), levels, levels=3)))
+        self.assertIsInstance(texture, moderngl.Texture)
+        self.assertEqual(texture.levels, 3)
+        for i in range(3):
+            self.assertEqual(texture.read(level=i), levels[i])
+
+    def test_dds_texture_array(self):
+        # Every layer stores its whole mipmap chain before the next layer.
+        images = [b'\x01' * 16, b'\x11' * 4, b'\x02' * 16, b'\x12' * 4]
+        texture = self.ctx.load_texture(self.save('array.dds', dds((2, 2), images, levels=2, dxgi=28, array_size=2)))
+        self.assertIsInstance(texture, moderngl.TextureArray)
+        self.assertEqual(texture.levels, 2)
+        self.assertEqual(texture.read(), b'\x01' * 16 + b'\x02' * 16)
+
+    def test_dds_texture_cube(self):
+        images = [bytes([i]) * 16 for i in range(6)]
+        texture = self.ctx.load_texture(self.save('cube.dds', dds((2, 2), images, cube=True)))
+        self.assertIsInstance(texture, moderngl.TextureCube)
+        for i in range(6):
+            self.assertEqual(texture.read(i), images[i])
+
+    def test_compressed(self):
+        if self.ctx.version_code < 420:
+            self.skipTest('OpenGL 4.2 is not supported')
+
+        pixels = bytes(range(256)) * 4
+        blocks = moderngl.compress(pixels, (16, 16), 'bc1')
+        expected = self.ctx.texture((16, 16), 4, blocks, compression='bc1').read()
+
+        texture = self.ctx.load_texture(self.save('bc1.dds', dds((16, 16), [blocks], fourcc=b'DXT1')))
+        self.assertEqual(texture.compression, 'bc1')
+        self.assertEqual(texture.read(), expected)
+
+        texture = self.ctx.load_texture(self.save('bc1.ktx2', ktx2(133, (16, 16), [blocks])))
+        self.assertEqual(texture.compression, 'bc1')
+        self.assertEqual(texture.read(), expected)
+
+    def test_errors(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.load_texture(os.path.join(self.tmp.name, 'missing.ktx2'))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.load_texture(self.save('empty.ktx2', b''))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.load_texture(self.save('image.png', b'\x89PNG\r\n\x1a\n' + bytes(64)))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.load_texture(self.save('truncated.ktx2', ktx2(37, (4, 4), [bytes(63)])))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.load_texture(self.save('truncated.dds', dds((4, 4), [bytes(63)])))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.load_texture(self.save('zstd.ktx2', ktx2(37, (1, 1), [bytes(4)], supercompression=2)))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.load_texture(self.save('astc.ktx2', ktx2(157, (4, 4), [bytes(16)])))
+
+    def test_oversized_header(self):
+        # The level is 4 GB as RGBA f4, it wraps to 0 in 32 bits.
+        with self.assertRaises(moderngl.Error):
+            self.ctx.load_texture(self.save('huge.ktx2', ktx2(109, (16384, 16384), [bytes(16)])))
+
+        limit = self.ctx.info['GL_MAX_TEXTURE_SIZE']
+        with self.assertRaises(moderngl.Error):
+            self.ctx.load_texture(self.save('limit.ktx2', ktx2(37, (limit * 2, 1), [bytes(16)])))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.load_texture(self.save('negative.ktx2', ktx2(37, (0x80000000, 1), [bytes(16)])))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.load_texture(self.save('zero.dds', dds((0, 4), [bytes(16)])))
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.load_texture(self.save('layers.dds', dds((1, 1), [bytes(16)], dxgi=28, array_size=0xffffffff)))
+
+
+if __name__ == '__main__':
+    unittest.main()
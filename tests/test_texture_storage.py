@@ -0,0 +1,87 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 420:
+            raise unittest.SkipTest('OpenGL 4.2 is not supported')
+
+    def test_full_chain(self):
+        texture = self.ctx.texture((16, 4), 4, levels=-1, immutable=True)
+        self.assertEqual(texture.levels, 5)
+        self.assertTrue(texture.immutable)
+        self.assertFalse(self.ctx.texture((16, 4), 4).immutable)
+
+    def test_invalid_levels(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((16, 4), 4, levels=6, immutable=True)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((16, 4), 4, levels=0)
+
+    def test_write_levels(self):
+        for immutable in (False, True):
+            texture = self.ctx.texture((4, 4), 1, levels=3, immutable=immutable)
+            texture.write_levels(b'\x01' * 16 + b'\x02' * 4 + b'\x03')
+            self.assertEqual(texture.read(level=0), b'\x01' * 16)
+            self.assertEqual(texture.read(level=1), b'\x02' * 4)
+            self.assertEqual(texture.read(level=2), b'\x03')
+
+    def test_write_level_range(self):
+        texture = self.ctx.texture((4, 4), 1, levels=3, immutable=True)
+        texture.write_levels(b'\x05' * 4 + b'\x06', base=1)
+        self.assertEqual(texture.read(level=1), b'\x05' * 4)
+        self.assertEqual(texture.read(level=2), b'\x06')
+
+        with self.assertRaises(moderngl.Error):
+            texture.write_levels(b'\x05' * 4 + b'\x06', base=2)
+
+        with self.assertRaises(moderngl.Error):
+            texture.write_levels(b'\x05' * 4, base=1)
+
+    def test_write_levels_from_buffer(self):
+        texture = self.ctx.texture((2, 2), 1, levels=2, immutable=True)
+        texture.write_levels(self.ctx.buffer(b'\x07' * 4 + b'\x08'))
+        self.assertEqual(texture.read(level=0), b'\x07' * 4)
+        self.assertEqual(texture.read(level=1), b'\x08')
+
+    def test_immutable_mipmaps(self):
+        texture = self.ctx.texture((4, 4), 4, b'\xff' * 64, levels=3, immutable=True)
+        texture.build_mipmaps()
+        self.assertEqual(texture.read(level=2), b'\xff' * 4)
+
+        with self.assertRaises(moderngl.Error):
+            texture.write(b'\x00' * 4, level=3)
+
+    def test_texture_array(self):
+        texture = self.ctx.texture_array((2, 2, 3), 1, levels=2, immutable=True)
+        self.assertEqual(texture.levels, 2)
+        texture.write_levels(b'\x01' * 12 + b'\x02' * 3)
+        texture.build_mipmaps()
+
+    def test_texture3d(self):
+        texture = self.ctx.texture3d((4, 2, 2), 1, levels=-1, immutable=True)
+        self.assertEqual(texture.levels, 3)
+        texture.write_levels(b'\x01' * 16 + b'\x02' * 2 + b'\x03')
+        self.assertEqual(texture.read(), b'\x01' * 16)
+
+        with self.assertRaises(moderngl.Error):
+            texture.write_levels(b'\x01' * 16)
+
+    def test_texture_cube(self):
+        texture = self.ctx.texture_cube((2, 2), 1, levels=2, immutable=True)
+        faces = b''.join(struct.pack('4B', *[face] * 4) for face in range(6))
+        texture.write_levels(faces + bytes(range(6)))
+        self.assertEqual(texture.read(3), b'\x03' * 4)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,71 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in float vert;
+                out float result;
+
+                uniform float scale;
+                uniform vec2 offset[2];
+                uniform int bias;
+
+                void main() {
+                    result = vert * scale + offset[0].x + offset[1].y + float(bias);
+                }
+            ''',
+            varyings=['result']
+        )
+
+        cls.vbo = cls.ctx.buffer(struct.pack('f', 3.0))
+        cls.res = cls.ctx.buffer(reserve=4)
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, cls.vbo, 'vert')
+
+    def transform(self):
+        self.vao.transform(self.res)
+        return struct.unpack('f', self.res.read())[0]
+
+    def test_size(self):
+        batch = self.prog.uniform_batch(['scale', 'offset', 'bias'])
+        self.assertEqual(batch.names, ('scale', 'offset', 'bias'))
+        self.assertEqual(batch.size, 4 + 16 + 4)
+
+    def test_write(self):
+        batch = self.prog.uniform_batch(['scale', 'offset', 'bias'])
+        batch.write(struct.pack('5fi', 2.0, 1.0, 0.0, 0.0, 0.5, 10))
+        self.assertAlmostEqual(self.prog['scale'].value, 2.0)
+        self.assertEqual(self.prog['offset'].value, [(1.0, 0.0), (0.0, 0.5)])
+        self.assertEqual(self.prog['bias'].value, 10)
+        self.assertAlmostEqual(self.transform(), 17.5)
+
+    def test_write_size_mismatch(self):
+        batch = self.prog.uniform_batch(['scale', 'bias'])
+        with self.assertRaises(moderngl.Error):
+            batch.write(struct.pack('f', 1.0))
+
+    def test_update(self):
+        batch = self.prog.uniform_batch(['scale', 'offset', 'bias'])
+        batch.write(struct.pack('5fi', 1.0, 0.0, 0.0, 0.0, 0.0, 0))
+        batch.update({'scale': 4.0, 'bias': 3})
+        self.assertEqual(self.prog['offset'].value, [(0.0, 0.0), (0.0, 0.0)])
+        self.assertAlmostEqual(self.transform(), 15.0)
+
+    def test_not_a_uniform(self):
+        with self.assertRaises(KeyError):
+            self.prog.uniform_batch(['vert'])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,117 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                layout (std140) uniform Object {
+                    vec4 position;
+                    vec4 color;
+                };
+
+                in float vert;
+
+                void main() {
+                    gl_Position = vec4(position.xy + vec2(vert), 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+
+                layout (std140) uniform Object {
+                    vec4 position;
+                    vec4 color;
+                };
+
+                out vec4 f_color;
+
+                void main() {
+                    f_color = color;
+                }
+            ''',
+        )
+
+        cls.prog['Object'].binding = 2
+        cls.vbo = cls.ctx.buffer(struct.pack('f', 0.0))
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, cls.vbo, 'vert')
+        cls.fbo = cls.ctx.simple_framebuffer((4, 1))
+
+    def push_pixels(self, ring, colors):
+        ring.reset()
+        for i, color in enumerate(colors):
+            x = (i + 0.5) / 2.0 - 1.0
+            ring.push(struct.pack('8f', x, 0.0, 0.0, 0.0, *color))
+
+    def test_alignment(self):
+        ring = self.ctx.uniform_ring(20, 8)
+        alignment = self.ctx.info['GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT']
+        self.assertEqual(ring.stride % alignment, 0)
+        self.assertGreaterEqual(ring.stride, 20)
+        self.assertEqual(ring.count, 8)
+        self.assertEqual(ring.block_size, 20)
+
+    def test_push_and_reset(self):
+        ring = self.ctx.uniform_ring(32, 2)
+        self.assertEqual(ring.push(bytes(32)), 0)
+        self.assertEqual(ring.push(bytes(16)), 1)
+        self.assertEqual(ring.used, 2)
+
+        with self.assertRaises(moderngl.Error):
+            ring.push(bytes(32))
+
+        ring.reset()
+        self.assertEqual(ring.used, 0)
+
+        with self.assertRaises(moderngl.Error):
+            ring.push(bytes(48))
+
+    def test_push_block_writer(self):
+        ring = self.ctx.uniform_ring(32, 4, binding=2)
+        writer = self.prog['Object'].writer()
+        writer['position'] = (0.25, 0.0, 0.0, 0.0)
+        writer['color'] = (0.0, 0.0, 1.0, 1.0)
+
+        self.assertEqual(ring.push(writer), 0)
+
+        self.fbo.use()
+        self.fbo.clear()
+        self.vao.render(moderngl.POINTS, ring=ring, slot=0)
+        self.assertEqual(self.fbo.read(components=4), bytes([0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0]))
+
+    def test_render_slot(self):
+        ring = self.ctx.uniform_ring(32, 4, binding=2)
+        self.push_pixels(ring, [(1.0, 0.0, 0.0, 1.0), (0.0, 1.0, 0.0, 1.0)])
+
+        self.fbo.use()
+        self.fbo.clear()
+        self.vao.render(moderngl.POINTS, ring=ring, slot=1)
+        self.assertEqual(self.fbo.read(components=4), bytes([0, 0, 0, 0, 0, 255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0]))
+
+        with self.assertRaises(moderngl.Error):
+            self.vao.render(moderngl.POINTS, ring=ring, slot=2)
+
+    def test_render_ring(self):
+        ring = self.ctx.uniform_ring(32, 4, binding=2)
+        colors = [(1.0, 0.0, 0.0, 1.0), (0.0, 1.0, 0.0, 1.0), (0.0, 0.0, 1.0, 1.0), (1.0, 1.0, 1.0, 1.0)]
+        self.push_pixels(ring, colors)
+
+        self.fbo.use()
+        self.fbo.clear()
+        self.vao.render_ring(ring, moderngl.POINTS)
+        expected = bytes(int(c * 255) for color in colors for c in color)
+        self.assertEqual(self.fbo.read(components=4), expected)
+
+
+if __name__ == '__main__':
+    unittest.main()
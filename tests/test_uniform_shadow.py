@@ -0,0 +1,115 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in float vert;
+                out float result;
+
+                uniform float scale = 2.0;
+                uniform vec2 offset[2];
+
+                void main() {
+                    result = vert * scale + offset[0].x + offset[1].y;
+                }
+            ''',
+            varyings=['result']
+        )
+
+    def test_initial_values(self):
+        self.assertAlmostEqual(self.prog['scale'].value, 2.0)
+        self.assertEqual(self.prog['offset'].value, [(0.0, 0.0), (0.0, 0.0)])
+
+    def test_read_after_write(self):
+        self.prog['offset'].value = [(1.0, 2.0), (3.0, 4.0)]
+        self.assertEqual(self.prog['offset'].value, [(1.0, 2.0), (3.0, 4.0)])
+        self.assertEqual(struct.unpack('4f', self.prog['offset'].read()), (1.0, 2.0, 3.0, 4.0))
+
+        self.prog['offset'].write(struct.pack('4f', 0.0, 0.0, 0.0, 0.0))
+        self.assertEqual(self.prog['offset'].value, [(0.0, 0.0), (0.0, 0.0)])
+
+    def test_flush_before_transform(self):
+        buf = self.ctx.buffer(struct.pack('f', 3.0))
+        res = self.ctx.buffer(reserve=4)
+        vao = self.ctx.simple_vertex_array(self.prog, buf, 'vert')
+
+        self.prog['scale'].value = 5.0
+        self.prog['offset'].value = [(1.0, 0.0), (0.0, 0.5)]
+        vao.transform(res)
+        self.assertAlmostEqual(struct.unpack('f', res.read())[0], 16.5)
+
+        self.prog['scale'].value = 5.0
+        self.prog['offset'].value = [(0.0, 0.0), (0.0, 0.0)]
+        vao.transform(res)
+        self.assertAlmostEqual(struct.unpack('f', res.read())[0], 15.0)
+
+        self.prog['scale'].value = 2.0
+
+    def test_released_program(self):
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in float vert;
+                out float result;
+
+                uniform float scale;
+
+                void main() {
+                    result = vert * scale;
+                }
+            ''',
+            varyings=['result']
+        )
+
+        scale = prog['scale']
+        batch = prog.uniform_batch(['scale'])
+        prog.release()
+
+        with self.assertRaises(moderngl.Error):
+            scale.value = 1.0
+
+        with self.assertRaises(moderngl.Error):
+            scale.value
+
+        with self.assertRaises(moderngl.Error):
+            scale.write(struct.pack('f', 1.0))
+
+        with self.assertRaises(moderngl.Error):
+            batch.update({'scale': 1.0})
+
+        compute_shader = self.ctx.compute_shader('''
+            #version 430
+            layout (local_size_x = 1) in;
+            uniform float scale;
+            layout (std430, binding = 0) buffer Output {
+                float value;
+            };
+            void main() {
+                value = scale;
+            }
+        ''') if self.ctx.version_code >= 430 else None
+
+        if compute_shader is not None:
+            scale = compute_shader['scale']
+            compute_shader.release()
+
+            with self.assertRaises(moderngl.Error):
+                scale.value = 1.0
+
+
+if __name__ == '__main__':
+    unittest.main()